@@ -20,6 +20,7 @@
 #include <geos/geom/GeometryFactory.h>
 #include <geos/io/WKTReader.h>
 #include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/Envelope.h>
 #include <geos/geom/Geometry.h>
 #include <geos/geom/Point.h>
 #include <geos/geom/LinearRing.h>
@@ -75,6 +76,7 @@ main()
     check(geom::MultiLineString);
     check(geom::MultiPolygon);
     check(geom::CoordinateSequence);
+    check(geom::Envelope);
     check(triangulate::quadedge::QuadEdge);
     check(triangulate::quadedge::QuadEdgeQuartet);
     check(triangulate::quadedge::Vertex);
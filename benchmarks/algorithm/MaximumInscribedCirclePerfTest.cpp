@@ -0,0 +1,75 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************
+ *
+ * - Monitor the time taken by MaximumInscribedCircle and
+ *   LargestEmptyCircle with several threads
+ *
+ **********************************************************************/
+
+#include <geos/algorithm/construct/LargestEmptyCircle.h>
+#include <geos/algorithm/construct/MaximumInscribedCircle.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/LineString.h>
+#include <geos/geom/Point.h>
+#include <geos/profiler.h>
+#include <geos/util/parallel.h>
+#include <BenchmarkUtils.h>
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+using namespace geos::geom;
+using geos::algorithm::construct::LargestEmptyCircle;
+using geos::algorithm::construct::MaximumInscribedCircle;
+
+std::size_t MAX_ITER = 5;
+std::size_t NUM_PTS = 20000;
+double TOLERANCE = 0.00001;
+
+template<typename Circle>
+void
+test(const Geometry& g, const std::string& name, std::size_t numThreads)
+{
+    geos::util::Profile sw(name);
+    sw.start();
+
+    double length = 0;
+    for (std::size_t i = 0; i < MAX_ITER; i++) {
+        Circle circle(&g, TOLERANCE);
+        circle.setNumThreads(numThreads);
+        length = circle.getRadiusLine()->getLength();
+    }
+
+    sw.stop();
+    std::cout << g.getNumPoints() << "," << name << "," << numThreads << ","
+              << length << "," << sw.getTot() / static_cast<double>(MAX_ITER) << std::endl;
+}
+
+/**
+ * Usage: perf_maximum_inscribed_circle [max_threads]
+ * The default is the number of hardware threads.
+ */
+int
+main(int argc, char** argv)
+{
+    std::size_t maxThreads = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : geos::util::defaultThreadCount();
+
+    auto polygon = geos::benchmark::createSineStar({0, 0}, 100, NUM_PTS);
+    auto boundary = polygon->getBoundary();
+
+    std::cout << "num_pts,case,threads,radius,time" << std::endl;
+    for (std::size_t numThreads = 1; numThreads <= maxThreads; numThreads *= 2) {
+        test<MaximumInscribedCircle>(*polygon, "mic", numThreads);
+        test<LargestEmptyCircle>(*boundary, "lec", numThreads);
+    }
+}
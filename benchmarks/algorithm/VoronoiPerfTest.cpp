@@ -47,6 +47,24 @@ static void BM_DelaunayFromSeq(benchmark::State& state) {
     }
 }
 
+static void BM_DelaunayRandomizedFromSeq(benchmark::State& state) {
+    Envelope e(0, 100, 0, 100);
+    auto gfact = geos::geom::GeometryFactory::getDefaultInstance();
+    std::default_random_engine eng(12345);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto nPts = static_cast<std::size_t>(state.range(0));
+        auto sites = geos::benchmark::createRandomCoords(e, nPts, eng);
+        state.ResumeTiming();
+
+        geos::triangulate::DelaunayTriangulationBuilder dtb;
+        dtb.setRandomizedInsertion(true);
+        dtb.setSites(*sites);
+        auto result = dtb.getTriangles(*gfact);
+    }
+}
+
 static void BM_DelaunayFromGeom(benchmark::State& state) {
     Envelope e(0, 100, 0, 100);
     auto gfact = geos::geom::GeometryFactory::getDefaultInstance();
@@ -81,6 +99,24 @@ static void BM_VoronoiFromSeq(benchmark::State& state) {
     }
 }
 
+static void BM_VoronoiRandomizedFromSeq(benchmark::State& state) {
+    Envelope e(0, 100, 0, 100);
+    auto gfact = geos::geom::GeometryFactory::getDefaultInstance();
+    std::default_random_engine eng(12345);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto nPts = static_cast<std::size_t>(state.range(0));
+        auto sites = geos::benchmark::createRandomCoords(e, nPts, eng);
+        state.ResumeTiming();
+
+        geos::triangulate::VoronoiDiagramBuilder vdb;
+        vdb.setRandomizedInsertion(true);
+        vdb.setSites(*sites);
+        auto result = vdb.getDiagram(*gfact);
+    }
+}
+
 static void BM_VoronoiFromGeom(benchmark::State& state) {
     Envelope e(0, 100, 0, 100);
     auto gfact = geos::geom::GeometryFactory::getDefaultInstance();
@@ -116,9 +152,11 @@ static void BM_OrderedVoronoiFromGeom(benchmark::State& state) {
     }
 }
 
-BENCHMARK(BM_DelaunayFromSeq)->Range(10, 1e6);
+BENCHMARK(BM_DelaunayFromSeq)->Range(10, 1e7)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_DelaunayRandomizedFromSeq)->Range(10, 1e7)->Unit(benchmark::kMillisecond);
 BENCHMARK(BM_DelaunayFromGeom)->Range(10, 1e6);
-BENCHMARK(BM_VoronoiFromSeq)->Range(10, 1e6);
+BENCHMARK(BM_VoronoiFromSeq)->Range(10, 1e7)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_VoronoiRandomizedFromSeq)->Range(10, 1e7)->Unit(benchmark::kMillisecond);
 BENCHMARK(BM_VoronoiFromGeom)->Range(10, 1e6);
 BENCHMARK(BM_OrderedVoronoiFromGeom)->Range(10, 1e6);
 
@@ -14,11 +14,13 @@
 
 #include <benchmark/benchmark.h>
 
+#include <geos/algorithm/locate/GridPointInAreaLocator.h>
 #include <geos/algorithm/locate/IndexedPointInAreaLocator.h>
 #include <geos/algorithm/locate/SimplePointInAreaLocator.h>
 
 #include <BenchmarkUtils.h>
 
+using geos::algorithm::locate::GridPointInAreaLocator;
 using geos::algorithm::locate::SimplePointInAreaLocator;
 using geos::algorithm::locate::IndexedPointInAreaLocator;
 
@@ -45,6 +47,7 @@ static void BM_PointInAreaLocator(benchmark::State& state) {
 }
 
 BENCHMARK_TEMPLATE(BM_PointInAreaLocator, IndexedPointInAreaLocator)->ArgsProduct({nPtsRange, nTestsRange});
+BENCHMARK_TEMPLATE(BM_PointInAreaLocator, GridPointInAreaLocator)->ArgsProduct({nPtsRange, nTestsRange});
 BENCHMARK_TEMPLATE(BM_PointInAreaLocator, SimplePointInAreaLocator)->ArgsProduct({nPtsRange, nTestsRange});
 
 BENCHMARK_MAIN();
@@ -18,6 +18,7 @@
 
 using geos::geom::Coordinate;
 using geos::geom::CoordinateSequence;
+using geos::geom::CoordinateXY;
 
 static void BM_Size(benchmark::State& state) {
     CoordinateSequence z(1533);
@@ -48,9 +49,81 @@ static void BM_HasRepeatedPoints(benchmark::State & state) {
     }
 }
 
+static CoordinateSequence createXY(std::size_t n) {
+    CoordinateSequence seq(n, false, false);
+    for (std::size_t i = 0; i < n; ++i) {
+        double di = static_cast<double>(i);
+        seq.setAt(CoordinateXY(di, di + 0.1), i);
+    }
+    return seq;
+}
+
+static void BM_GetAt(benchmark::State& state) {
+    CoordinateSequence seq = createXY(static_cast<std::size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        double sum = 0;
+        for (std::size_t i = 0; i < seq.size(); ++i) {
+            sum += seq.getAt<CoordinateXY>(i).x;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+
+static void BM_GetXY(benchmark::State& state) {
+    CoordinateSequence seq = createXY(static_cast<std::size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        double sum = 0;
+        for (std::size_t i = 0; i < seq.size(); ++i) {
+            sum += seq.getX(i) + seq.getY(i);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+
+static void BM_ForEach(benchmark::State& state) {
+    CoordinateSequence seq = createXY(static_cast<std::size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        double sum = 0;
+        seq.forEach<CoordinateXY>([&sum](const CoordinateXY& c) {
+            sum += c.x;
+        });
+        benchmark::DoNotOptimize(sum);
+    }
+}
+
+static void BM_Add(benchmark::State& state) {
+    std::size_t n = static_cast<std::size_t>(state.range(0));
+
+    for (auto _ : state) {
+        CoordinateSequence seq(0, false, false);
+        for (std::size_t i = 0; i < n; ++i) {
+            double di = static_cast<double>(i);
+            seq.add(CoordinateXY(di, di));
+        }
+        benchmark::DoNotOptimize(seq.data());
+    }
+}
+
+static void BM_Copy(benchmark::State& state) {
+    CoordinateSequence seq = createXY(static_cast<std::size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        CoordinateSequence copy(seq);
+        benchmark::DoNotOptimize(copy.data());
+    }
+}
+
 BENCHMARK(BM_Size);
 BENCHMARK(BM_Initialize);
 BENCHMARK(BM_HasRepeatedPoints);
+BENCHMARK(BM_GetAt)->Arg(1)->Arg(1000);
+BENCHMARK(BM_GetXY)->Arg(1)->Arg(1000);
+BENCHMARK(BM_ForEach)->Arg(1)->Arg(1000);
+BENCHMARK(BM_Add)->Arg(1)->Arg(5)->Arg(1000);
+BENCHMARK(BM_Copy)->Arg(1)->Arg(5)->Arg(1000);
 
 BENCHMARK_MAIN();
 
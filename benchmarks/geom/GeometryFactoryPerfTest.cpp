@@ -0,0 +1,51 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************
+ *
+ * - Cost of creating and destroying geometries, which adds and drops a
+ *   reference to the factory, from one or several threads
+ *
+ **********************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/Point.h>
+
+using geos::geom::CoordinateXY;
+using geos::geom::GeometryFactory;
+
+static void BM_CreateDestroyPoint(benchmark::State& state) {
+    const GeometryFactory* factory = GeometryFactory::getDefaultInstance();
+    double x = 0;
+
+    for (auto _ : state) {
+        auto pt = factory->createPoint(CoordinateXY(x, x));
+        benchmark::DoNotOptimize(pt.get());
+        x += 1;
+    }
+}
+
+static void BM_ClonePoint(benchmark::State& state) {
+    const GeometryFactory* factory = GeometryFactory::getDefaultInstance();
+    auto pt = factory->createPoint(CoordinateXY(1, 2));
+
+    for (auto _ : state) {
+        auto copy = pt->clone();
+        benchmark::DoNotOptimize(copy.get());
+    }
+}
+
+BENCHMARK(BM_CreateDestroyPoint)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_ClonePoint)->ThreadRange(1, 8)->UseRealTime();
+
+BENCHMARK_MAIN();
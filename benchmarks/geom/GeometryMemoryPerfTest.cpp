@@ -0,0 +1,133 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************
+ *
+ * - Monitor the heap memory held by simple geometries
+ *
+ **********************************************************************/
+
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/LineString.h>
+#include <geos/geom/LinearRing.h>
+#include <geos/geom/Point.h>
+#include <geos/geom/Polygon.h>
+#include <geos/profiler.h>
+#include <geos/util.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+using namespace geos::geom;
+
+namespace {
+
+//-- live heap allocations, tracked by the replacement operator new and delete
+std::size_t numAllocations = 0;
+std::size_t numBytes = 0;
+
+//-- each allocation is prefixed by its size
+constexpr std::size_t HEADER_SIZE = alignof(std::max_align_t);
+
+}
+
+void*
+operator new(std::size_t size)
+{
+    void* p = std::malloc(size + HEADER_SIZE);
+    if (p == nullptr) {
+        throw std::bad_alloc();
+    }
+    *static_cast<std::size_t*>(p) = size;
+    numAllocations++;
+    numBytes += size;
+    return static_cast<char*>(p) + HEADER_SIZE;
+}
+
+void
+operator delete(void* p) noexcept
+{
+    if (p == nullptr) {
+        return;
+    }
+    auto block = reinterpret_cast<std::size_t*>(reinterpret_cast<std::uintptr_t>(p) - HEADER_SIZE);
+    numAllocations--;
+    numBytes -= *block;
+    std::free(block);
+}
+
+void
+operator delete(void* p, std::size_t) noexcept
+{
+    operator delete(p);
+}
+
+constexpr std::size_t NUM_GEOMS = 1000000;
+
+template<typename F>
+void
+measure(const std::string& name, F&& create)
+{
+    std::vector<std::unique_ptr<Geometry>> geoms;
+    geoms.reserve(NUM_GEOMS);
+
+    std::size_t allocations = numAllocations;
+    std::size_t bytes = numBytes;
+    geos::util::Profile sw(name);
+    sw.start();
+    for (std::size_t i = 0; i < NUM_GEOMS; i++) {
+        geoms.push_back(create(static_cast<double>(i)));
+    }
+    sw.stop();
+
+    auto n = static_cast<double>(NUM_GEOMS);
+    std::cout << name
+              << ": " << static_cast<double>(numAllocations - allocations) / n << " allocations, "
+              << static_cast<double>(numBytes - bytes) / n << " bytes per geometry, "
+              << sw.getTotFormatted() << " usec" << std::endl;
+}
+
+int
+main()
+{
+    auto factory = GeometryFactory::create();
+
+    measure("Point XY", [&factory](double x) {
+        return factory->createPoint(CoordinateXY(x, x));
+    });
+
+    measure("Point XYZ", [&factory](double x) {
+        return factory->createPoint(Coordinate(x, x, x));
+    });
+
+    measure("LineString 2 points", [&factory](double x) {
+        auto seq = geos::detail::make_unique<CoordinateSequence>(2u, false, false);
+        seq->setAt(CoordinateXY(x, x), 0);
+        seq->setAt(CoordinateXY(x + 1, x), 1);
+        return factory->createLineString(std::move(seq));
+    });
+
+    measure("Polygon 5 points", [&factory](double x) {
+        CoordinateSequence seq(5u, false, false);
+        seq.setAt(CoordinateXY(x, x), 0);
+        seq.setAt(CoordinateXY(x + 1, x), 1);
+        seq.setAt(CoordinateXY(x + 1, x + 1), 2);
+        seq.setAt(CoordinateXY(x, x + 1), 3);
+        seq.setAt(CoordinateXY(x, x), 4);
+        return factory->createPolygon(std::move(seq));
+    });
+}
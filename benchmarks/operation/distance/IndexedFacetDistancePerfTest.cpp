@@ -0,0 +1,80 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/geom/Envelope.h>
+#include <geos/geom/Geometry.h>
+#include <geos/operation/distance/IndexedFacetDistance.h>
+#include <geos/profiler.h>
+#include <geos/util/parallel.h>
+#include <BenchmarkUtils.h>
+
+#include <cstdlib>
+#include <iostream>
+
+using namespace geos::geom;
+using geos::operation::distance::IndexedFacetDistance;
+
+std::size_t MAX_ITER = 5;
+std::size_t NUM_BASE_PTS = 20000;
+std::size_t NUM_QUERIES = 40000;
+std::size_t NUM_LINE_PTS = 20;
+
+void
+test(const IndexedFacetDistance& ifd, const std::vector<const Geometry*>& queries,
+     const std::string& name, std::size_t numThreads)
+{
+    geos::util::Profile sw("IndexedFacetDistance");
+    sw.start();
+
+    double sum = 0;
+    for (std::size_t i = 0; i < MAX_ITER; i++) {
+        for (double d : ifd.distance(queries, numThreads)) {
+            sum += d;
+        }
+    }
+
+    sw.stop();
+    std::cout << queries.size() << "," << name << "," << numThreads << ","
+              << sum << "," << sw.getTot() / static_cast<double>(MAX_ITER) << std::endl;
+}
+
+/**
+ * Usage: perf_indexed_facet_distance [max_threads]
+ * The default is the number of hardware threads.
+ */
+int
+main(int argc, char** argv)
+{
+    std::size_t maxThreads = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : geos::util::defaultThreadCount();
+
+    Envelope env(0, 1000, 0, 1000);
+    auto base = geos::benchmark::createSineStar({500, 500}, 600, NUM_BASE_PTS);
+    auto points = geos::benchmark::createPoints(env, NUM_QUERIES);
+    auto lines = geos::benchmark::createLines(env, NUM_QUERIES, 1000 / std::sqrt(static_cast<double>(NUM_QUERIES)), NUM_LINE_PTS);
+
+    std::vector<const Geometry*> pointQueries;
+    for (const auto& g : points) {
+        pointQueries.push_back(g.get());
+    }
+    std::vector<const Geometry*> lineQueries;
+    for (const auto& g : lines) {
+        lineQueries.push_back(g.get());
+    }
+
+    IndexedFacetDistance ifd(base.get());
+
+    std::cout << "num_queries,case,threads,sum,time" << std::endl;
+    for (std::size_t numThreads = 1; numThreads <= maxThreads; numThreads *= 2) {
+        test(ifd, pointQueries, "points", numThreads);
+        test(ifd, lineQueries, "lines", numThreads);
+    }
+}
@@ -0,0 +1,95 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/MultiPolygon.h>
+#include <geos/geom/Polygon.h>
+#include <geos/operation/valid/IsValidOp.h>
+#include <geos/profiler.h>
+#include <geos/util/parallel.h>
+#include <BenchmarkUtils.h>
+
+#include <iostream>
+
+using namespace geos::geom;
+using geos::operation::valid::IsValidOp;
+
+std::size_t MAX_ITER = 5;
+std::size_t NUM_POLYS = 40000;
+std::size_t NUM_POLY_PTS = 100;
+
+/**
+ * Creates a MultiPolygon of disjoint polygons on a grid.
+ * If requested, an extra polygon overlapping an existing one is added
+ * at the start or end of the collection, making it invalid.
+ */
+std::unique_ptr<Geometry>
+createMultiPolygon(std::size_t nPolys, std::size_t nPts, int invalidPosition)
+{
+    Envelope env(0, 1000, 0, 1000);
+    double cellSize = env.getWidth() / std::sqrt(static_cast<double>(nPolys));
+
+    auto geoms = geos::benchmark::createGeometriesOnGrid(env, nPolys, [cellSize, nPts](const CoordinateXY& base) {
+        return geos::benchmark::createSineStar(base, 0.8 * cellSize, nPts);
+    });
+
+    if (invalidPosition != 0) {
+        std::unique_ptr<Geometry> overlap = geos::benchmark::createSineStar({0.5 * cellSize, 0.5 * cellSize}, 0.8 * cellSize, nPts);
+        if (invalidPosition < 0) {
+            geoms.insert(geoms.begin(), std::move(overlap));
+        }
+        else {
+            geoms.push_back(std::move(overlap));
+        }
+    }
+
+    std::vector<std::unique_ptr<Polygon>> polys;
+    for (auto& g : geoms) {
+        polys.emplace_back(static_cast<Polygon*>(g.release()));
+    }
+    return GeometryFactory::getDefaultInstance()->createMultiPolygon(std::move(polys));
+}
+
+void
+test(const Geometry& g, const std::string& name, std::size_t numThreads)
+{
+    geos::util::Profile sw("IsValidOp");
+    sw.start();
+
+    bool isValid = false;
+    for (std::size_t i = 0; i < MAX_ITER; i++) {
+        IsValidOp op(&g);
+        op.setNumThreads(numThreads);
+        isValid = op.isValid();
+    }
+
+    sw.stop();
+    std::cout << g.getNumGeometries() << "," << g.getNumPoints() << "," << name << ","
+              << numThreads << "," << isValid << "," << sw.getTot() / static_cast<double>(MAX_ITER) << std::endl;
+}
+
+int
+main()
+{
+    std::size_t maxThreads = geos::util::defaultThreadCount();
+
+    auto valid = createMultiPolygon(NUM_POLYS, NUM_POLY_PTS, 0);
+    auto invalidFirst = createMultiPolygon(NUM_POLYS, NUM_POLY_PTS, -1);
+    auto invalidLast = createMultiPolygon(NUM_POLYS, NUM_POLY_PTS, 1);
+
+    std::cout << "num_polys,num_pts,case,threads,is_valid,time" << std::endl;
+    for (std::size_t numThreads = 1; numThreads <= maxThreads; numThreads *= 2) {
+        test(*valid, "valid", numThreads);
+        test(*invalidFirst, "invalid_first", numThreads);
+        test(*invalidLast, "invalid_last", numThreads);
+    }
+}
@@ -291,6 +291,43 @@ extern "C" {
         return GEOSDistanceIndexed_r(handle, g1, g2, dist);
     }
 
+    int
+    GEOSDistanceIndexedBatch(const Geometry* g, const Geometry* const geoms[], unsigned int ngeoms,
+                             unsigned int numThreads, double* dists)
+    {
+        return GEOSDistanceIndexedBatch_r(handle, g, geoms, ngeoms, numThreads, dists);
+    }
+
+    int
+    GEOSDistanceWithinJoin(const Geometry* const geomsA[], unsigned int ngeomsA,
+                           const Geometry* const geomsB[], unsigned int ngeomsB,
+                           double dist, unsigned int numThreads,
+                           GEOSJoinCallback callback, void* userdata)
+    {
+        return GEOSDistanceWithinJoin_r(handle, geomsA, ngeomsA, geomsB, ngeomsB,
+                                        dist, numThreads, callback, userdata);
+    }
+
+    int
+    GEOSSpatialJoin(const Geometry* const geomsA[], unsigned int ngeomsA,
+                    const Geometry* const geomsB[], unsigned int ngeomsB,
+                    int predicate, double dist, unsigned int numThreads,
+                    GEOSJoinCallback callback, void* userdata)
+    {
+        return GEOSSpatialJoin_r(handle, geomsA, ngeomsA, geomsB, ngeomsB,
+                                 predicate, dist, numThreads, callback, userdata);
+    }
+
+    int
+    GEOSSpatialJoinPairs(const Geometry* const geomsA[], unsigned int ngeomsA,
+                         const Geometry* const geomsB[], unsigned int ngeomsB,
+                         int predicate, double dist, unsigned int numThreads,
+                         unsigned int** indexesA, unsigned int** indexesB, unsigned int* npairs)
+    {
+        return GEOSSpatialJoinPairs_r(handle, geomsA, ngeomsA, geomsB, ngeomsB,
+                                      predicate, dist, numThreads, indexesA, indexesB, npairs);
+    }
+
     int
     GEOSHausdorffDistance(const Geometry* g1, const Geometry* g2, double* dist)
     {
@@ -303,6 +340,12 @@ extern "C" {
         return GEOSHausdorffDistanceDensify_r(handle, g1, g2, densifyFrac, dist);
     }
 
+    char
+    GEOSHausdorffDistanceWithin(const Geometry* g1, const Geometry* g2, double densifyFrac, double dist)
+    {
+        return GEOSHausdorffDistanceWithin_r(handle, g1, g2, densifyFrac, dist);
+    }
+
     int
     GEOSFrechetDistance(const Geometry* g1, const Geometry* g2, double* dist)
     {
@@ -531,6 +574,13 @@ extern "C" {
         return GEOSMaximumInscribedCircle_r(handle, g, tolerance);
     }
 
+    int
+    GEOSMaximumInscribedCircleBatch(const Geometry* const geoms[], unsigned int ngeoms, double tolerance,
+                                    unsigned int numThreads, Geometry* radiusLines[])
+    {
+        return GEOSMaximumInscribedCircleBatch_r(handle, geoms, ngeoms, tolerance, numThreads, radiusLines);
+    }
+
     Geometry*
     GEOSLargestEmptyCircle(const Geometry* g, const Geometry* boundary, double tolerance)
     {
@@ -1038,6 +1088,13 @@ extern "C" {
         return GEOSCoordSeq_copyFromBuffer_r(handle, buf, size, hasZ, hasM);
     }
 
+    CoordinateSequence*
+    GEOSCoordSeq_wrapBuffer(const double* buf, unsigned int size, int hasZ, int hasM,
+                            GEOSBufferReleaseCallback release, void* userdata)
+    {
+        return GEOSCoordSeq_wrapBuffer_r(handle, buf, size, hasZ, hasM, release, userdata);
+    }
+
     int
     GEOSCoordSeq_copyToBuffer(const CoordinateSequence* s, double* buf, int hasZ, int hasM)
     {
@@ -1593,6 +1650,18 @@ extern "C" {
         return GEOSPreparedDistanceWithin_r(handle, g1, g2, dist);
     }
 
+    char*
+    GEOSPreparedRelate(const geos::geom::prep::PreparedGeometry* pg1, const Geometry* g2)
+    {
+        return GEOSPreparedRelate_r(handle, pg1, g2);
+    }
+
+    char
+    GEOSPreparedRelatePattern(const geos::geom::prep::PreparedGeometry* pg1, const Geometry* g2, const char* imPattern)
+    {
+        return GEOSPreparedRelatePattern_r(handle, pg1, g2, imPattern);
+    }
+
     GEOSSTRtree*
     GEOSSTRtree_create(std::size_t nodeCapacity)
     {
@@ -1732,6 +1801,20 @@ extern "C" {
         return GEOSOrientationIndex_r(handle, Ax, Ay, Bx, By, Px, Py);
     }
 
+    int
+    GEOSClusterDBSCAN(const Geometry* const geoms[], unsigned int ngeoms, double eps,
+                      unsigned int minPoints, unsigned int numThreads, unsigned int* clusterIds)
+    {
+        return GEOSClusterDBSCAN_r(handle, geoms, ngeoms, eps, minPoints, numThreads, clusterIds);
+    }
+
+    int
+    GEOSClusterWithinDistance(const Geometry* const geoms[], unsigned int ngeoms, double distance,
+                              unsigned int numThreads, unsigned int* clusterIds)
+    {
+        return GEOSClusterWithinDistance_r(handle, geoms, ngeoms, distance, numThreads, clusterIds);
+    }
+
     GEOSGeometry*
     GEOSSharedPaths(const GEOSGeometry* g1, const GEOSGeometry* g2)
     {
@@ -1792,12 +1875,28 @@ extern "C" {
         return GEOSBufferWithParams_r(handle, g, p, w);
     }
 
+    int
+    GEOSBufferMany(const Geometry* const geoms[], unsigned int ngeoms,
+                   const GEOSBufferParams* p, double w, unsigned int numThreads,
+                   Geometry* results[])
+    {
+        return GEOSBufferMany_r(handle, geoms, ngeoms, p, w, numThreads, results);
+    }
+
     Geometry*
     GEOSDelaunayTriangulation(const Geometry* g, double tolerance, int onlyEdges)
     {
         return GEOSDelaunayTriangulation_r(handle, g, tolerance, onlyEdges);
     }
 
+    int
+    GEOSDelaunayTriangulationIndexed(const Geometry* g, double tolerance,
+                                     double** coords, unsigned int* numCoords,
+                                     unsigned int** triangles, unsigned int* numTriangles)
+    {
+        return GEOSDelaunayTriangulationIndexed_r(handle, g, tolerance, coords, numCoords, triangles, numTriangles);
+    }
+
     Geometry*
     GEOSConstrainedDelaunayTriangulation(const Geometry* g)
     {
@@ -66,8 +66,12 @@
 #include <geos/operation/buffer/BufferOp.h>
 #include <geos/operation/buffer/BufferParameters.h>
 #include <geos/operation/buffer/OffsetCurve.h>
+#include <geos/operation/cluster/DBSCANClusterFinder.h>
+#include <geos/operation/cluster/GeometryDistanceClusterFinder.h>
 #include <geos/operation/distance/DistanceOp.h>
+#include <geos/operation/distance/DistanceWithinJoin.h>
 #include <geos/operation/distance/IndexedFacetDistance.h>
+#include <geos/operation/join/SpatialJoin.h>
 #include <geos/operation/linemerge/LineMerger.h>
 #include <geos/operation/intersection/Rectangle.h>
 #include <geos/operation/intersection/RectangleIntersection.h>
@@ -186,7 +190,9 @@ using geos::algorithm::hull::ConcaveHullOfPolygons;
 using geos::operation::buffer::BufferBuilder;
 using geos::operation::buffer::BufferParameters;
 using geos::operation::buffer::OffsetCurve;
+using geos::operation::distance::DistanceWithinJoin;
 using geos::operation::distance::IndexedFacetDistance;
+using geos::operation::join::SpatialJoin;
 using geos::operation::geounion::CascadedPolygonUnion;
 using geos::operation::overlayng::OverlayNG;
 using geos::operation::overlayng::UnaryUnionNG;
@@ -849,6 +855,102 @@ extern "C" {
         });
     }
 
+    int
+    GEOSDistanceIndexedBatch_r(GEOSContextHandle_t extHandle, const Geometry* g, const Geometry* const geoms[],
+                               unsigned int ngeoms, unsigned int numThreads, double* dists)
+    {
+        return execute(extHandle, 0, [&]() {
+            IndexedFacetDistance ifd(g);
+            std::vector<const Geometry*> geomList(geoms, geoms + ngeoms);
+            std::vector<double> result = ifd.distance(geomList, numThreads);
+            std::copy(result.begin(), result.end(), dists);
+            return 1;
+        });
+    }
+
+    int
+    GEOSDistanceWithinJoin_r(GEOSContextHandle_t extHandle,
+                             const Geometry* const geomsA[], unsigned int ngeomsA,
+                             const Geometry* const geomsB[], unsigned int ngeomsB,
+                             double dist, unsigned int numThreads,
+                             GEOSJoinCallback callback, void* userdata)
+    {
+        return execute(extHandle, 0, [&]() {
+            std::vector<const Geometry*> listA(geomsA, geomsA + ngeomsA);
+            std::vector<const Geometry*> listB(geomsB, geomsB + ngeomsB);
+            DistanceWithinJoin dwj(listA, listB, dist);
+            dwj.setNumThreads(numThreads);
+            dwj.join([&](std::size_t i, std::size_t j) {
+                callback(static_cast<unsigned int>(i), static_cast<unsigned int>(j), userdata);
+            });
+            return 1;
+        });
+    }
+
+    static SpatialJoin
+    makeSpatialJoin(const Geometry* const geomsA[], unsigned int ngeomsA,
+                    const Geometry* const geomsB[], unsigned int ngeomsB,
+                    int predicate, double dist, unsigned int numThreads)
+    {
+        if (predicate < GEOS_JOIN_INTERSECTS || predicate > GEOS_JOIN_DWITHIN) {
+            throw IllegalArgumentException("Invalid spatial join predicate");
+        }
+        std::vector<const Geometry*> listA(geomsA, geomsA + ngeomsA);
+        std::vector<const Geometry*> listB(geomsB, geomsB + ngeomsB);
+        SpatialJoin sj(listA, listB, static_cast<SpatialJoin::Predicate>(predicate));
+        sj.setDistance(dist);
+        sj.setNumThreads(numThreads);
+        return sj;
+    }
+
+    int
+    GEOSSpatialJoin_r(GEOSContextHandle_t extHandle,
+                      const Geometry* const geomsA[], unsigned int ngeomsA,
+                      const Geometry* const geomsB[], unsigned int ngeomsB,
+                      int predicate, double dist, unsigned int numThreads,
+                      GEOSJoinCallback callback, void* userdata)
+    {
+        return execute(extHandle, 0, [&]() {
+            SpatialJoin sj = makeSpatialJoin(geomsA, ngeomsA, geomsB, ngeomsB, predicate, dist, numThreads);
+            sj.join([&](std::size_t i, std::size_t j) {
+                callback(static_cast<unsigned int>(i), static_cast<unsigned int>(j), userdata);
+            });
+            return 1;
+        });
+    }
+
+    int
+    GEOSSpatialJoinPairs_r(GEOSContextHandle_t extHandle,
+                           const Geometry* const geomsA[], unsigned int ngeomsA,
+                           const Geometry* const geomsB[], unsigned int ngeomsB,
+                           int predicate, double dist, unsigned int numThreads,
+                           unsigned int** indexesA, unsigned int** indexesB, unsigned int* npairs)
+    {
+        return execute(extHandle, 0, [&]() {
+            SpatialJoin sj = makeSpatialJoin(geomsA, ngeomsA, geomsB, ngeomsB, predicate, dist, numThreads);
+            std::vector<std::pair<std::size_t, std::size_t>> pairs = sj.join();
+            if (pairs.size() > std::numeric_limits<unsigned int>::max()) {
+                throw std::runtime_error("Too many pairs");
+            }
+
+            unsigned int* outA = nullptr;
+            unsigned int* outB = nullptr;
+            if (!pairs.empty()) {
+                outA = static_cast<unsigned int*>(malloc(pairs.size() * sizeof(unsigned int)));
+                outB = static_cast<unsigned int*>(malloc(pairs.size() * sizeof(unsigned int)));
+                for (std::size_t k = 0; k < pairs.size(); k++) {
+                    outA[k] = static_cast<unsigned int>(pairs[k].first);
+                    outB[k] = static_cast<unsigned int>(pairs[k].second);
+                }
+            }
+
+            *indexesA = outA;
+            *indexesB = outB;
+            *npairs = static_cast<unsigned int>(pairs.size());
+            return 1;
+        });
+    }
+
     int
     GEOSHausdorffDistance_r(GEOSContextHandle_t extHandle, const Geometry* g1, const Geometry* g2, double* dist)
     {
@@ -868,6 +970,19 @@ extern "C" {
         });
     }
 
+    char
+    GEOSHausdorffDistanceWithin_r(GEOSContextHandle_t extHandle, const Geometry* g1, const Geometry* g2,
+                                  double densifyFrac, double dist)
+    {
+        return execute(extHandle, 2, [&]() {
+            DiscreteHausdorffDistance dhd(*g1, *g2);
+            if (densifyFrac != 0) {
+                dhd.setDensifyFraction(densifyFrac);
+            }
+            return dhd.isWithinDistance(dist);
+        });
+    }
+
     int
     GEOSFrechetDistance_r(GEOSContextHandle_t extHandle, const Geometry* g1, const Geometry* g2, double* dist)
     {
@@ -1348,6 +1463,25 @@ extern "C" {
         });
     }
 
+    int
+    GEOSMaximumInscribedCircleBatch_r(GEOSContextHandle_t extHandle, const Geometry* const geoms[],
+                                      unsigned int ngeoms, double tolerance, unsigned int numThreads,
+                                      Geometry* radiusLines[])
+    {
+        return execute(extHandle, 0, [&]() {
+            std::vector<const Geometry*> geomList(geoms, geoms + ngeoms);
+            auto lines = geos::algorithm::construct::MaximumInscribedCircle::getRadiusLines(
+                             geomList, tolerance, numThreads);
+            for (std::size_t i = 0; i < lines.size(); i++) {
+                if (lines[i]) {
+                    lines[i]->setSRID(geoms[i]->getSRID());
+                }
+                radiusLines[i] = lines[i].release();
+            }
+            return 1;
+        });
+    }
+
     Geometry*
     GEOSLargestEmptyCircle_r(GEOSContextHandle_t extHandle, const Geometry* g, const GEOSGeometry* boundary, double tolerance)
     {
@@ -2547,6 +2681,26 @@ extern "C" {
         });
     }
 
+    CoordinateSequence*
+    GEOSCoordSeq_wrapBuffer_r(GEOSContextHandle_t extHandle, const double* buf, unsigned int size, int hasZ, int hasM,
+                              GEOSBufferReleaseCallback release, void* userdata)
+    {
+        if (!hasZ) {
+            // XY and XYM sequences are padded with Z, so the buffer cannot be used in place
+            CoordinateSequence* coords = GEOSCoordSeq_copyFromBuffer_r(extHandle, buf, size, hasZ, hasM);
+            if (coords && release) {
+                release(userdata);
+            }
+            return coords;
+        }
+
+        return execute(extHandle, [&]() {
+            auto coords = geos::detail::make_unique<CoordinateSequence>(
+                CoordinateSequence::wrapBuffer(buf, size, true, hasM != 0, release, userdata));
+            return coords.release();
+        });
+    }
+
     CoordinateSequence*
     GEOSCoordSeq_copyFromArrays_r(GEOSContextHandle_t extHandle, const double* x, const double* y, const double* z, const double* m, unsigned int size)
     {
@@ -3629,6 +3783,31 @@ extern "C" {
         });
     }
 
+    char*
+    GEOSPreparedRelate_r(GEOSContextHandle_t extHandle,
+                         const geos::geom::prep::PreparedGeometry* pg, const Geometry* g)
+    {
+        return execute(extHandle, [&]() {
+            auto im = pg->relate(g);
+            if(im == nullptr) {
+                return (char*) nullptr;
+            }
+
+            return gstrdup(im->toString());
+        });
+    }
+
+    char
+    GEOSPreparedRelatePattern_r(GEOSContextHandle_t extHandle,
+                         const geos::geom::prep::PreparedGeometry* pg, const Geometry* g,
+                         const char* imPattern)
+    {
+        return execute(extHandle, 2, [&]() {
+            std::string p(imPattern);
+            return pg->relate(g, p);
+        });
+    }
+
 //-----------------------------------------------------------------
 // STRtree
 //-----------------------------------------------------------------
@@ -3874,6 +4053,49 @@ extern "C" {
         });
     }
 
+    static int
+    clusterToIds(geos::operation::cluster::AbstractClusterFinder& finder,
+                 const Geometry* const geoms[], unsigned int ngeoms,
+                 unsigned int numThreads, unsigned int* clusterIds)
+    {
+        std::vector<const Geometry*> components(geoms, geoms + ngeoms);
+        finder.setNumThreads(numThreads);
+        auto clusters = finder.cluster(components);
+
+        std::vector<std::size_t> ids = clusters.getClusterIds();
+        for (unsigned int i = 0; i < ngeoms; i++) {
+            clusterIds[i] = ids[i] == std::numeric_limits<std::size_t>::max()
+                            ? GEOS_CLUSTER_NONE
+                            : static_cast<unsigned int>(ids[i]);
+        }
+        return static_cast<int>(clusters.getNumClusters());
+    }
+
+    int
+    GEOSClusterDBSCAN_r(GEOSContextHandle_t extHandle, const Geometry* const geoms[], unsigned int ngeoms,
+                        double eps, unsigned int minPoints, unsigned int numThreads,
+                        unsigned int* clusterIds)
+    {
+        using geos::operation::cluster::DBSCANClusterFinder;
+
+        return execute(extHandle, -1, [&]() {
+            DBSCANClusterFinder finder(eps, minPoints);
+            return clusterToIds(finder, geoms, ngeoms, numThreads, clusterIds);
+        });
+    }
+
+    int
+    GEOSClusterWithinDistance_r(GEOSContextHandle_t extHandle, const Geometry* const geoms[], unsigned int ngeoms,
+                                double distance, unsigned int numThreads, unsigned int* clusterIds)
+    {
+        using geos::operation::cluster::GeometryDistanceClusterFinder;
+
+        return execute(extHandle, -1, [&]() {
+            GeometryDistanceClusterFinder finder(distance);
+            return clusterToIds(finder, geoms, ngeoms, numThreads, clusterIds);
+        });
+    }
+
     GEOSGeometry*
     GEOSSharedPaths_r(GEOSContextHandle_t extHandle, const GEOSGeometry* g1, const GEOSGeometry* g2)
     {
@@ -4043,6 +4265,28 @@ extern "C" {
         });
     }
 
+    int
+    GEOSBufferMany_r(GEOSContextHandle_t extHandle, const Geometry* const geoms[], unsigned int ngeoms,
+                     const BufferParameters* bp, double width, unsigned int numThreads,
+                     Geometry* results[])
+    {
+        using geos::operation::buffer::BufferOp;
+
+        for (unsigned int i = 0; i < ngeoms; i++) {
+            results[i] = nullptr;
+        }
+
+        return execute(extHandle, 0, [&]() {
+            std::vector<const Geometry*> input(geoms, geoms + ngeoms);
+            std::vector<std::unique_ptr<Geometry>> buffers = BufferOp::bufferMany(input, width, *bp, numThreads);
+            for (unsigned int i = 0; i < ngeoms; i++) {
+                buffers[i]->setSRID(geoms[i]->getSRID());
+                results[i] = buffers[i].release();
+            }
+            return 1;
+        });
+    }
+
     Geometry*
     GEOSDelaunayTriangulation_r(GEOSContextHandle_t extHandle, const Geometry* g1, double tolerance, int onlyEdges)
     {
@@ -4066,6 +4310,50 @@ extern "C" {
         });
     }
 
+    int
+    GEOSDelaunayTriangulationIndexed_r(GEOSContextHandle_t extHandle, const Geometry* g1, double tolerance,
+                                       double** coords, unsigned int* numCoords,
+                                       unsigned int** triangles, unsigned int* numTriangles)
+    {
+        using geos::triangulate::DelaunayTriangulationBuilder;
+
+        return execute(extHandle, 0, [&]() {
+            DelaunayTriangulationBuilder builder;
+            builder.setTolerance(tolerance);
+            builder.setSites(*g1);
+
+            std::vector<std::size_t> indices = builder.getTriangleIndices();
+            const CoordinateSequence* sites = builder.getSiteCoordinates();
+            std::size_t nSites = sites ? sites->size() : 0;
+            if (nSites > std::numeric_limits<unsigned int>::max()) {
+                throw std::runtime_error("Too many sites");
+            }
+
+            double* outCoords = nullptr;
+            unsigned int* outTriangles = nullptr;
+            if (nSites > 0) {
+                outCoords = static_cast<double*>(malloc(2 * nSites * sizeof(double)));
+                for (std::size_t i = 0; i < nSites; i++) {
+                    const CoordinateXY& c = sites->getAt<CoordinateXY>(i);
+                    outCoords[2 * i] = c.x;
+                    outCoords[2 * i + 1] = c.y;
+                }
+            }
+            if (!indices.empty()) {
+                outTriangles = static_cast<unsigned int*>(malloc(indices.size() * sizeof(unsigned int)));
+                for (std::size_t i = 0; i < indices.size(); i++) {
+                    outTriangles[i] = static_cast<unsigned int>(indices[i]);
+                }
+            }
+
+            *coords = outCoords;
+            *numCoords = static_cast<unsigned int>(nSites);
+            *triangles = outTriangles;
+            *numTriangles = static_cast<unsigned int>(indices.size() / 3);
+            return 1;
+        });
+    }
+
     Geometry*
     GEOSConstrainedDelaunayTriangulation_r(GEOSContextHandle_t extHandle, const Geometry* g1)
     {
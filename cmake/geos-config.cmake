@@ -8,4 +8,7 @@
 # by the Free Software Foundation.
 # See the COPYING file for more information.
 ################################################################################
+include(CMakeFindDependencyMacro)
+# static builds of geos link Threads::Threads
+find_dependency(Threads)
 include("${CMAKE_CURRENT_LIST_DIR}/geos-targets.cmake")
@@ -25,6 +25,16 @@
 #include <geos/index/strtree/TemplateSTRtree.h>
 #include <geos/algorithm/locate/IndexedPointInAreaLocator.h>
 
+#include <limits>
+#include <memory>
+#include <vector>
+
+namespace geos {
+namespace geom {
+class CoordinateSequence;
+}
+}
+
 using geos::geom::Geometry;
 using geos::geom::CoordinateXY;
 using geos::geom::Location;
@@ -39,6 +49,9 @@ namespace construct { // geos::algorithm::construct
  * \brief Determines the location of a point in the polygonal elements of a geometry.
  * 
  * Uses spatial indexing to provide efficient performance.
+ *
+ * Large numbers of points can be located at once with locatePolygons(),
+ * which also determines the polygonal element containing each point.
  * 
  * \author Martin Davis
  */
@@ -62,6 +75,27 @@ public:
      */
     Location locate(const CoordinateXY* /*const*/ p);
 
+    /// Value returned by locatePolygons() for points not in any polygonal element
+    static constexpr std::size_t NOT_FOUND = std::numeric_limits<std::size_t>::max();
+
+    /** \brief
+     * Finds the polygonal element containing each of a list of points.
+     *
+     * The points are sorted along a Hilbert curve and processed in
+     * clusters of nearby points, each of which queries the polygon index once.
+     * The clusters are distributed over a number of threads.
+     * Once the indexes are built (by the first call to a locate method),
+     * this method may be called concurrently.
+     *
+     * @param pts the points to locate
+     * @param numThreads the number of threads (0 for the number of hardware threads)
+     * @return for each point, the index of the first polygonal element of
+     *         the geometry (in traversal order) which contains the point
+     *         in its interior or boundary, or NOT_FOUND if there is none
+     */
+    std::vector<std::size_t> locatePolygons(const geom::CoordinateSequence& pts,
+                                            std::size_t numThreads = 1);
+
 private:
     void init();
 
@@ -72,7 +106,9 @@ private:
     //-- members
     const Geometry& geom;
     bool isInitialized;
-    TemplateSTRtree<IndexedPointInAreaLocator*> index;
+    //-- indexes of the polygonal elements
+    TemplateSTRtree<std::size_t> index;
+    std::vector<const Geometry*> polys;
     std::vector<std::unique_ptr<IndexedPointInAreaLocator>> locators;
 };
 
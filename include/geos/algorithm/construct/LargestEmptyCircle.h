@@ -104,6 +104,22 @@ public:
 
     ~LargestEmptyCircle() = default;
 
+    /**
+    * Sets the number of threads used to compute the distances
+    * of the grid cells. The default is 1.
+    *
+    * With more than one thread the cells are refined in batches,
+    * so the center found may differ slightly (within the tolerance)
+    * from the single-threaded result.
+    * It does not depend on the number of threads.
+    *
+    * @param p_numThreads the number of threads (0 for the number of hardware threads)
+    */
+    void setNumThreads(std::size_t p_numThreads)
+    {
+        numThreads = p_numThreads;
+    }
+
     /**
     * Computes the center point of the Largest Empty Circle
     * within a set of obstacles, up to a given tolerance distance.
@@ -140,6 +156,7 @@ private:
     const geom::GeometryFactory* factory;
     geom::Envelope gridEnv;
     bool done;
+    std::size_t numThreads = 1;
     std::unique_ptr<algorithm::locate::IndexedPointInAreaLocator> boundaryPtLocater;
     IndexedDistanceToPoint obstacleDistance;
     std::unique_ptr<IndexedFacetDistance> boundaryDistance;
@@ -27,6 +27,7 @@
 
 #include <memory>
 #include <queue>
+#include <vector>
 
 
 
@@ -60,6 +61,22 @@ public:
     MaximumInscribedCircle(const geom::Geometry* polygonal, double tolerance);
     ~MaximumInscribedCircle() = default;
 
+    /**
+    * Sets the number of threads used to compute the distances
+    * of the grid cells. The default is 1.
+    *
+    * With more than one thread the cells are refined in batches,
+    * so the center found may differ slightly (within the tolerance)
+    * from the single-threaded result.
+    * It does not depend on the number of threads.
+    *
+    * @param p_numThreads the number of threads (0 for the number of hardware threads)
+    */
+    void setNumThreads(std::size_t p_numThreads)
+    {
+        numThreads = p_numThreads;
+    }
+
     /**
     * Gets the center point of the maximum inscribed circle
     * (up to the tolerance distance).
@@ -107,6 +124,23 @@ public:
     */
     static std::unique_ptr<geom::LineString> getRadiusLine(const geom::Geometry* polygonal, double tolerance);
 
+    /**
+    * Computes radius lines of the Maximum Inscribed Circles
+    * of a list of polygonal geometries (for instance the
+    * components of a MultiPolygon), up to a given tolerance distance.
+    * The geometries are distributed over a number of threads.
+    *
+    * @param polygonals a list of polygonal geometries
+    * @param tolerance the distance tolerance for computing the center points
+    * @param numThreads the number of threads (0 for the number of hardware threads)
+    * @return a line from the center to a point on the circle for each geometry,
+    *         or null for empty geometries
+    */
+    static std::vector<std::unique_ptr<geom::LineString>> getRadiusLines(
+        const std::vector<const geom::Geometry*>& polygonals,
+        double tolerance,
+        std::size_t numThreads = 1);
+
     /**
      * Computes the maximum number of iterations allowed.
      * Uses a heuristic based on the area of the input geometry
@@ -133,6 +167,7 @@ private:
     IndexedPointInAreaLocator ptLocator;
     const geom::GeometryFactory* factory;
     bool done;
+    std::size_t numThreads = 1;
     geom::CoordinateXY centerPt;
     geom::CoordinateXY radiusPt;
 
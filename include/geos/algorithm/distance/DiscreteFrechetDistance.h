@@ -101,6 +101,12 @@ namespace distance { // geos::algorithm::distance
  *   DFD(A, B)  = 200
  *   DFD(A, B') = 282.842712474619
  * </pre>
+ *
+ * The distance is computed by dynamic programming over the pairs of
+ * discrete points, keeping only one row of the table in memory.
+ * The columns of the table may be split into strips computed by
+ * several threads (see setNumThreads()), each strip following
+ * one row behind the strip on its left.
  */
 class GEOS_DLL DiscreteFrechetDistance {
 public:
@@ -130,6 +136,18 @@ public:
      */
     void setDensifyFraction(double dFrac);
 
+    /**
+     * Sets the number of threads used to compute the distance.
+     * The default is 1.
+     *
+     * @param p_numThreads the number of threads (0 for the number of hardware threads)
+     */
+    void
+    setNumThreads(std::size_t p_numThreads)
+    {
+        numThreads = p_numThreads;
+    }
+
     double
     distance()
     {
@@ -146,9 +164,6 @@ public:
 private:
     geom::Coordinate getSegmentAt(const geom::CoordinateSequence& seq, std::size_t index);
 
-    PointPairDistance& getFrechetDistance(std::vector< std::vector<PointPairDistance> >& ca, std::size_t i, std::size_t j,
-                                         const geom::CoordinateSequence& p, const geom::CoordinateSequence& q);
-
     void compute(const geom::Geometry& discreteGeom, const geom::Geometry& geom);
 
     const geom::Geometry& g0;
@@ -160,6 +175,8 @@ private:
     /// Value of 0.0 indicates that no densification should take place
     double densifyFrac; // = 0.0;
 
+    std::size_t numThreads = 1;
+
     // Declare type as noncopyable
     DiscreteFrechetDistance(const DiscreteFrechetDistance& other) = delete;
     DiscreteFrechetDistance& operator=(const DiscreteFrechetDistance& rhs) = delete;
@@ -95,6 +95,13 @@ namespace distance { // geos::algorithm::distance
  *   DHD(A, B) = 22.360679774997898
  *   HD(A, B) ~= 47.8
  * </pre>
+ *
+ * The distance from each discrete point to the other geometry is found
+ * using an STRtree of its segments.
+ * Points which are closer to the other geometry than the largest distance
+ * found so far are skipped without computing their exact distance.
+ * The points may be distributed over several threads
+ * (see setNumThreads()); the result does not depend on the number of threads.
  */
 class GEOS_DLL DiscreteHausdorffDistance {
 public:
@@ -124,6 +131,35 @@ public:
      */
     void setDensifyFraction(double dFrac);
 
+    /**
+     * Sets the number of threads used to compute the distance.
+     * The default is 1.
+     *
+     * @param p_numThreads the number of threads (0 for the number of hardware threads)
+     */
+    void
+    setNumThreads(std::size_t p_numThreads)
+    {
+        numThreads = p_numThreads;
+    }
+
+    /**
+     * Tests whether the discrete Hausdorff distance between
+     * the geometries is at most a given distance.
+     *
+     * This is faster than computing the distance, since no exact
+     * point distances are needed and the computation stops
+     * at the first point which is further away than the distance.
+     * The result is false if either geometry is empty.
+     *
+     * @param maxDistance the distance to test
+     * @return true if distance() <= maxDistance
+     */
+    bool isWithinDistance(double maxDistance) const;
+
+    static bool isWithinDistance(const geom::Geometry& g0,
+                                 const geom::Geometry& g1, double maxDistance);
+
     double
     distance()
     {
@@ -236,6 +272,10 @@ private:
                                  const geom::Geometry& geom,
                                  PointPairDistance& ptDist);
 
+    bool isOrientedWithinDistance(const geom::Geometry& discreteGeom,
+                                  const geom::Geometry& geom,
+                                  double maxDistance) const;
+
     const geom::Geometry& g0;
 
     const geom::Geometry& g1;
@@ -245,6 +285,8 @@ private:
     /// Value of 0.0 indicates that no densification should take place
     double densifyFrac; // = 0.0;
 
+    std::size_t numThreads = 1;
+
     // Declare type as noncopyable
     DiscreteHausdorffDistance(const DiscreteHausdorffDistance& other) = delete;
     DiscreteHausdorffDistance& operator=(const DiscreteHausdorffDistance& rhs) = delete;
@@ -115,7 +115,7 @@ public:
     }
 
     bool
-    getIsNull()
+    getIsNull() const
     {
         return isNull;
     }
@@ -0,0 +1,104 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/algorithm/locate/IndexedPointInAreaLocator.h> // composition
+#include <geos/algorithm/locate/PointOnGeometryLocator.h> // inherited
+#include <geos/geom/Envelope.h>
+#include <geos/geom/Location.h>
+
+#include <cstddef>
+#include <vector>
+
+namespace geos {
+namespace geom {
+class Geometry;
+class CoordinateSequence;
+}
+}
+
+namespace geos {
+namespace algorithm { // geos::algorithm
+namespace locate { // geos::algorithm::locate
+
+/** \brief
+ * Determines the location of [Coordinates](@ref geom::Coordinate) relative to
+ * an areal geometry, using a grid of precomputed cell locations.
+ *
+ * The envelope of the geometry is divided into a uniform grid of cells.
+ * Each cell which does not touch a segment of the geometry lies entirely
+ * in the interior or the exterior, and its location is computed when the
+ * grid is built.
+ * Points in these cells are located in constant time.
+ * Points in cells touched by the boundary are located by an
+ * IndexedPointInAreaLocator, so the results are identical to it.
+ *
+ * Building the grid costs more than building an IndexedPointInAreaLocator,
+ * so this locator suits geometries against which very many points are located.
+ *
+ * Polygonal and [LinearRing](@ref geom::LinearRing) geometries are supported.
+ *
+ * The grid is lazy-loaded, which allows creating instances even if they are not used.
+ */
+class GEOS_DLL GridPointInAreaLocator : public PointOnGeometryLocator {
+public:
+    /** \brief
+     * Creates a new locator for a given [Geometry](@ref geom::Geometry).
+     *
+     * Polygonal and [LinearRing](@ref geom::LinearRing) geometries are supported.
+     *
+     * @param g the Geometry to locate in
+     */
+    GridPointInAreaLocator(const geom::Geometry& g);
+
+    const geom::Geometry& getGeometry() const {
+        return areaGeom;
+    }
+
+    /** \brief
+     * Determines the [Location](@ref geom::Location) of a point in an areal
+     * [Geometry](@ref geom::Geometry).
+     *
+     * @param p the point to test
+     * @return the location of the point in the geometry
+     */
+    geom::Location locate(const geom::CoordinateXY* /*const*/ p) override;
+
+private:
+    const geom::Geometry& areaGeom;
+    IndexedPointInAreaLocator boundaryLocator;
+
+    bool isBuilt = false;
+    geom::Envelope extent;
+    std::size_t numCols = 0;
+    std::size_t numRows = 0;
+    double cellWidth = 0.0;
+    double cellHeight = 0.0;
+    //-- BOUNDARY for cells which must be located exactly
+    std::vector<geom::Location> cells;
+
+    void buildGrid();
+    void markSegment(const geom::CoordinateXY& p0, const geom::CoordinateXY& p1);
+    void classifyCells(const std::vector<const geom::CoordinateSequence*>& rings);
+
+    std::size_t cellCol(double x) const;
+    std::size_t cellRow(double y) const;
+
+    // Declare type as noncopyable
+    GridPointInAreaLocator(const GridPointInAreaLocator& other) = delete;
+    GridPointInAreaLocator& operator=(const GridPointInAreaLocator& rhs) = delete;
+};
+
+} // geos::algorithm::locate
+} // geos::algorithm
+} // geos
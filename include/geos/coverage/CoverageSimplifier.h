@@ -138,12 +138,27 @@ public:
     std::vector<std::unique_ptr<Geometry>> simplifyInner(
         double tolerance);
 
+    /**
+    * Sets the number of threads used to simplify the coverage edges.
+    * Edges which cannot affect each other are simplified concurrently.
+    * The result is deterministic, but may differ slightly
+    * from the single-threaded result.
+    * The default is 1.
+    *
+    * @param numThreads the number of threads (0 for the number of hardware threads)
+    */
+    void setNumThreads(std::size_t numThreads)
+    {
+        m_numThreads = numThreads;
+    }
+
 
 private:
 
     // Members
     std::vector<const Geometry*>& m_input; // TODO? make this const
     const GeometryFactory* m_geomFactory;
+    std::size_t m_numThreads = 1;
 
     // Methods
     void simplifyEdges(
@@ -61,6 +61,30 @@ public:
     */
     static std::unique_ptr<Geometry> Union(const Geometry* coverage);
 
+    /**
+    * Unions a polygonal coverage using multiple threads.
+    * The coverage is partitioned into spatially coherent groups
+    * (in Hilbert order) which are unioned concurrently.
+    * The group unions form a coverage in turn,
+    * so their shared boundaries are merged by a final coverage union.
+    *
+    * @param coverage a vector of polygons in the coverage
+    * @param numThreads the number of threads (0 for the number of hardware threads)
+    * @return the union of the coverage polygons
+    */
+    static std::unique_ptr<Geometry> Union(std::vector<const Geometry*>& coverage,
+                                           std::size_t numThreads);
+
+    /**
+    * Unions a polygonal coverage using multiple threads.
+    *
+    * @param coverage a collection of the polygons in the coverage
+    * @param numThreads the number of threads (0 for the number of hardware threads)
+    * @return the union of the coverage polygons
+    */
+    static std::unique_ptr<Geometry> Union(const Geometry* coverage,
+                                           std::size_t numThreads);
+
 };
 
 } // namespace geos::coverage
@@ -183,18 +183,40 @@ public:
     * @param freeRings flags indicating which ring edges do not have node endpoints
     * @param constraintLines the linear constraints
     * @param distanceTolerance the simplification tolerance
+    * @param numThreads the number of threads to use (see setNumThreads)
     * @return the simplified lines
     */
     static std::unique_ptr<MultiLineString> simplify(
         const MultiLineString* lines,
         std::vector<bool>& freeRings,
         const MultiLineString* constraintLines,
-        double distanceTolerance);
+        double distanceTolerance,
+        std::size_t numThreads = 1);
 
     // Constructor
     TPVWSimplifier(const MultiLineString* lines,
         double distanceTolerance);
 
+    /**
+    * Sets the number of threads used to simplify the lines.
+    *
+    * With more than one thread the lines are partitioned into
+    * groups of lines with disjoint envelopes, which cannot
+    * affect each other's simplification.
+    * The groups are simplified in turn, with the lines of a group
+    * simplified concurrently.
+    * The result is topologically valid and deterministic
+    * (independent of the number of threads), but may differ slightly
+    * from the single-threaded result, which simplifies
+    * lines strictly in input order.
+    *
+    * @param p_numThreads the number of threads (0 for the number of hardware threads)
+    */
+    void setNumThreads(std::size_t p_numThreads)
+    {
+        numThreads = p_numThreads;
+    }
+
 
 private:
 
@@ -204,6 +226,7 @@ private:
     double areaTolerance;
     const GeometryFactory* geomFactory;
     const MultiLineString* constraintLines;
+    std::size_t numThreads;
 
 
     // Methods
@@ -213,6 +236,10 @@ private:
 
     std::unique_ptr<MultiLineString> simplify();
 
+    std::vector<std::unique_ptr<CoordinateSequence>> simplifyParallel(
+        std::vector<Edge>& edges,
+        EdgeIndex& edgeIndex);
+
     std::vector<Edge> createEdges(
         const MultiLineString* lines,
         std::vector<bool>& freeRing);
@@ -0,0 +1,169 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+#include <geos/geom/Envelope.h>
+
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+// Forward declarations
+namespace geos {
+namespace geom {
+class Geometry;
+}
+}
+
+namespace geos {      // geos
+namespace coverage { // geos::coverage
+
+/**
+ * Validates a polygonal coverage in spatially coherent batches
+ * ("tiles"), so that only a part of the coverage needs to be held
+ * in memory at any time.
+ *
+ * The validator is given the envelopes of all coverage elements up front.
+ * The elements are ordered along a Hilbert curve
+ * and split into batches of consecutive elements.
+ * Each batch is validated against the elements it contains
+ * plus the neighbouring elements of other batches whose envelopes
+ * interact with it (within the gap width, if set).
+ * Element geometries are obtained on demand from a loader function,
+ * and are released as soon as no later batch needs them,
+ * so only the elements of the current batch and the neighbours
+ * shared with later batches are resident.
+ *
+ * The results are identical to those of CoverageValidator.
+ * They are reported incrementally, batch by batch, through a callback
+ * which receives the index of each invalid element and
+ * the linework of its invalid boundary segments.
+ * The elements of a batch can be validated concurrently.
+ */
+class GEOS_DLL TiledCoverageValidator {
+
+public:
+
+    /**
+     * Provides the geometry of the coverage element with a given index.
+     * It is called at most once for each element.
+     */
+    typedef std::function<std::unique_ptr<geom::Geometry>(std::size_t index)> GeometryLoader;
+
+    /**
+     * Receives the invalid boundary linework of a coverage element.
+     * It is called on the thread which called validate(),
+     * in batch order.
+     */
+    typedef std::function<void(std::size_t index, std::unique_ptr<geom::Geometry> invalidLines)> InvalidHandler;
+
+    /**
+     * Creates a validator for a coverage whose element geometries
+     * are loaded on demand.
+     *
+     * @param envelopes the envelopes of the coverage elements
+     * @param loader the function providing the element geometries
+     */
+    TiledCoverageValidator(std::vector<geom::Envelope> envelopes, GeometryLoader loader);
+
+    /**
+     * Creates a validator for a coverage held in memory.
+     * The vector is copied, but the coverage geometries
+     * must remain alive while validating.
+     *
+     * @param coverage the coverage elements
+     */
+    TiledCoverageValidator(const std::vector<const geom::Geometry*>& coverage);
+
+    /**
+     * Sets the maximum gap width, if narrow gaps are to be detected.
+     *
+     * @param gapWidth the maximum width of gaps to detect
+     */
+    void setGapWidth(double gapWidth)
+    {
+        m_gapWidth = gapWidth;
+    }
+
+    /**
+     * Sets the number of elements in each batch.
+     * Larger batches share more neighbours, smaller batches use less memory.
+     * The default is 1000.
+     *
+     * @param batchSize the number of elements per batch
+     */
+    void setBatchSize(std::size_t batchSize)
+    {
+        m_batchSize = batchSize > 0 ? batchSize : 1;
+    }
+
+    /**
+     * Sets the number of threads used to validate the elements of a batch.
+     * The default is 1.
+     *
+     * @param numThreads the number of threads (0 for the number of hardware threads)
+     */
+    void setNumThreads(std::size_t numThreads)
+    {
+        m_numThreads = numThreads;
+    }
+
+    /**
+     * Validates the coverage, reporting each invalid element to a handler.
+     *
+     * @param handler the handler for invalid elements
+     * @return true if the coverage is valid
+     */
+    bool validate(const InvalidHandler& handler);
+
+    /**
+     * Gets the largest number of element geometries which were
+     * resident at the same time during the last validation.
+     *
+     * @return the maximum number of resident geometries
+     */
+    std::size_t getMaxResident() const
+    {
+        return m_maxResident;
+    }
+
+private:
+
+    struct Element {
+        std::unique_ptr<geom::Geometry> owned;
+        const geom::Geometry* geom;
+    };
+
+    std::vector<geom::Envelope> m_envelopes;
+    GeometryLoader m_loader;
+    //-- the coverage elements, if not provided by m_loader
+    std::vector<const geom::Geometry*> m_coverage;
+    double m_gapWidth = 0.0;
+    std::size_t m_batchSize = 1000;
+    std::size_t m_numThreads = 1;
+    std::size_t m_maxResident = 0;
+
+    std::unordered_map<std::size_t, Element> resident;
+
+    std::vector<std::size_t> hilbertOrder() const;
+
+    geom::Envelope queryEnvelope(std::size_t index) const;
+
+    const geom::Geometry* getGeometry(std::size_t index);
+
+};
+
+} // namespace geos::coverage
+} // namespace geos
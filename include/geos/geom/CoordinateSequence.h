@@ -19,6 +19,7 @@
 
 #include <geos/geom/Coordinate.h> // for applyCoordinateFilter
 #include <geos/geom/CoordinateSequenceIterator.h>
+#include <geos/util/SmallVector.h>
 
 #include <cassert>
 #include <vector>
@@ -52,6 +53,8 @@ namespace geom { // geos::geom
  * If a high-dimension Coordinate coordinate is read from a low-dimension CoordinateSequence,
  * the higher dimensions will be populated with incorrect values or a segfault may occur.
  *
+ * A sequence holding a single coordinate stores it inline, without a separate allocation.
+ *
  */
 class GEOS_DLL CoordinateSequence {
 
@@ -156,6 +159,40 @@ public:
         return CoordinateSequence(size, false, true);
     }
 
+    /// Called with its user data when a wrapped buffer is no longer used
+    using ReleaseCallback = geos::util::SmallVector<double, 4>::ReleaseCallback;
+
+    /**
+     * \brief
+     * Create a CoordinateSequence which uses the coordinates of an
+     * external buffer in place, without copying them.
+     *
+     * The buffer must interleave the coordinates as the sequence stores
+     * them, which is the case for XYZ and XYZM coordinates.
+     * It is never modified: the mutators and apply_rw copy the
+     * coordinates into the sequence before changing them, after which
+     * the buffer is released. Until then, only const access is allowed:
+     * own() must be called before using the non-const accessors
+     * (getAt, operator[], front, back, items, data).
+     * Copies of the sequence do not share the buffer.
+     *
+     * @param buf the coordinates, which must stay valid until released
+     * @param size the number of coordinates
+     * @param hasz whether the coordinates have Z values
+     * @param hasm whether the coordinates have M values
+     * @param release called with `userdata` once the buffer is no longer
+     *        used (possibly from another thread), or null
+     * @param userdata passed to `release`
+     *
+     * @throws util::IllegalArgumentException if the sequence cannot store
+     *         coordinates of these dimensions in the layout of the buffer,
+     *         in which case `release` is not called
+     */
+    static CoordinateSequence wrapBuffer(const double* buf, std::size_t size,
+                                         bool hasz, bool hasm,
+                                         ReleaseCallback release = nullptr,
+                                         void* userdata = nullptr);
+
     /** \brief
      * Returns a heap-allocated deep copy of this CoordinateSequence.
      */
@@ -197,6 +234,18 @@ public:
         return m_vect.empty();
     }
 
+    /// Returns <code>true</code> if the coordinates are those of an
+    /// external buffer (see wrapBuffer).
+    bool isBorrowed() const {
+        return m_vect.isBorrowed();
+    }
+
+    /// Copies the coordinates of an external buffer into the sequence and
+    /// releases the buffer. Does nothing if the sequence owns its coordinates.
+    void own() {
+        m_vect.own();
+    }
+
     /** \brief
     * Tests whether an a {@link CoordinateSequence} forms a ring,
     * by checking length and closure. Self-intersection is not checked.
@@ -378,6 +427,7 @@ public:
     /// Copy Coordinate c to position pos
     template<typename T>
     void setAt(const T& c, std::size_t pos) {
+        m_vect.own();
         switch(getCoordinateType()) {
             case CoordinateType::XY: setAtImpl<CoordinateXY>(c, pos); break;
             case CoordinateType::XYZ: setAtImpl<Coordinate>(c, pos); break;
@@ -422,6 +472,7 @@ public:
     template<typename T>
     void add(const T& c, bool allowRepeated)
     {
+        m_vect.own();
         if(!allowRepeated && !isEmpty()) {
             const CoordinateXY& last = back<CoordinateXY>();
             if(last.equals2D(c)) {
@@ -469,6 +520,7 @@ public:
     template<typename T>
     void add(std::size_t i, const T& coord, bool allowRepeated)
     {
+        m_vect.own();
         // don't add duplicate coordinates
         if(! allowRepeated) {
             std::size_t sz = size();
@@ -620,6 +672,7 @@ public:
 
     template<typename Filter>
     void apply_rw(const Filter* filter) {
+        m_vect.own();
         switch(getCoordinateType()) {
             case CoordinateType::XY:
                 for (auto& c : items<CoordinateXY>()) {
@@ -766,7 +819,8 @@ public:
     }
 
 private:
-    std::vector<double> m_vect; // Vector to store values
+    //-- stores up to one XYZM coordinate inline, so that Points need no separate allocation
+    geos::util::SmallVector<double, 4> m_vect; // Vector to store values
 
     uint8_t m_stride;           // Stride of stored values, corresponding to underlying type
 
@@ -785,7 +839,7 @@ private:
     }
 
     void make_space(std::size_t pos, std::size_t n) {
-        m_vect.insert(std::next(m_vect.begin(), static_cast<std::ptrdiff_t>(pos * stride())),
+        m_vect.insert(std::next(m_vect.cbegin(), static_cast<std::ptrdiff_t>(pos * stride())),
                       m_stride * n,
                       DoubleNotANumber);
     }
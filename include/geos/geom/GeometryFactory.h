@@ -29,6 +29,7 @@
 #include <geos/util/IllegalArgumentException.h>
 #include <geos/export.h>
 
+#include <atomic>
 #include <vector>
 #include <memory>
 #include <cassert>
@@ -463,7 +464,10 @@ private:
     PrecisionModel precisionModel;
     int SRID;
 
-    mutable int _refCount;
+    //-- Every geometry holds a reference to its factory, and geometries
+    //-- sharing a factory (typically the default one) are created and
+    //-- destroyed concurrently by the multi-threaded operations.
+    mutable std::atomic<int> _refCount;
     bool _autoDestroy;
 
     friend class Geometry;
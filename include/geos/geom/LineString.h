@@ -218,7 +218,8 @@ protected:
 
     Envelope computeEnvelopeInternal() const;
 
-    CoordinateSequence::Ptr points;
+    //-- held by value, so that it needs no separate allocation
+    CoordinateSequence points;
 
     mutable Envelope envelope;
 
@@ -33,6 +33,11 @@ namespace geom {
 class Geometry;
 class Coordinate;
 }
+namespace operation {
+namespace relateng {
+class RelateNG;
+}
+}
 }
 
 
@@ -59,6 +64,7 @@ class BasicPreparedGeometry: public PreparedGeometry {
 private:
     const geom::Geometry* baseGeom;
     std::vector<const CoordinateXY*> representativePts;
+    mutable std::unique_ptr<operation::relateng::RelateNG> relateNG;
 
 protected:
     /**
@@ -85,10 +91,17 @@ protected:
      */
     bool envelopeCovers(const geom::Geometry* g) const;
 
+    /**
+     * Gets the (lazily created) prepared RelateNG
+     * for the base geometry, which caches the
+     * edge index and point locators it uses.
+     */
+    operation::relateng::RelateNG& getRelateNG() const;
+
 public:
     BasicPreparedGeometry(const Geometry* geom);
 
-    ~BasicPreparedGeometry() override = default;
+    ~BasicPreparedGeometry() override;
 
     const geom::Geometry&
     getGeometry() const override
@@ -185,6 +198,16 @@ public:
      */
     bool isWithinDistance(const geom::Geometry* geom, double dist) const override;
 
+    /**
+     * Default implementation, using RelateNG in prepared mode.
+     */
+    std::unique_ptr<geom::IntersectionMatrix> relate(const geom::Geometry* g) const override;
+
+    /**
+     * Default implementation, using RelateNG in prepared mode.
+     */
+    bool relate(const geom::Geometry* g, const std::string& pattern) const override;
+
     std::string toString();
 
 };
@@ -20,6 +20,7 @@
 
 #include <vector>
 #include <memory>
+#include <string>
 #include <geos/export.h>
 
 // Forward declarations
@@ -28,6 +29,7 @@ namespace geos {
         class Geometry;
         class Coordinate;
         class CoordinateSequence;
+        class IntersectionMatrix;
     }
 }
 
@@ -227,6 +229,29 @@ public:
      *
      */
     virtual bool isWithinDistance(const geom::Geometry* geom, double dist) const = 0;
+
+    /** \brief
+     * Compute the DE-9IM matrix of the topological relationship
+     * between the base {@link Geometry} and the given geometry.
+     *
+     * @param geom the Geometry to relate to
+     * @return the DE-9IM matrix of the relationship
+     *
+     * @see Geometry#relate(const Geometry*)
+     */
+    virtual std::unique_ptr<geom::IntersectionMatrix> relate(const geom::Geometry* geom) const = 0;
+
+    /** \brief
+     * Tests whether the topological relationship between the base
+     * {@link Geometry} and the given geometry matches a DE-9IM pattern.
+     *
+     * @param geom the Geometry to relate to
+     * @param pattern the DE-9IM pattern to match
+     * @return true if the relationship matches the pattern
+     *
+     * @see Geometry#relate(const Geometry*, const std::string&)
+     */
+    virtual bool relate(const geom::Geometry* geom, const std::string& pattern) const = 0;
 };
 
 
@@ -77,6 +77,22 @@ public:
         delete geom;
     }
 
+    /**
+     * Sets whether prepared polygonal geometries locate points with a
+     * algorithm::locate::GridPointInAreaLocator.
+     *
+     * The grid locator is more expensive to build than the default
+     * algorithm::locate::IndexedPointInAreaLocator, but locates most points
+     * in constant time, so it suits geometries tested against very many points.
+     * The default is false.
+     *
+     * @param p_useGridLocator whether to use a grid locator
+     */
+    void setUseGridLocator(bool p_useGridLocator)
+    {
+        useGridLocator = p_useGridLocator;
+    }
+
     /**
      * Creates a new {@link PreparedGeometry} appropriate for the argument {@link Geometry}.
      *
@@ -85,6 +101,10 @@ public:
      */
     std::unique_ptr<PreparedGeometry> create(const geom::Geometry* geom) const;
 
+private:
+
+    bool useGridLocator = false;
+
 };
 
 } // namespace geos::geom::prep
@@ -51,6 +51,7 @@ namespace prep { // geos::geom::prep
 class PreparedPolygon : public BasicPreparedGeometry {
 private:
     bool isRectangle;
+    bool useGridLocator;
     mutable std::unique_ptr<noding::FastSegmentSetIntersectionFinder> segIntFinder;
     mutable std::unique_ptr<algorithm::locate::PointOnGeometryLocator> ptOnGeomLoc;
     mutable std::unique_ptr<algorithm::locate::PointOnGeometryLocator> indexedPtOnGeomLoc;
@@ -59,7 +60,15 @@ private:
 
 protected:
 public:
-    PreparedPolygon(const geom::Geometry* geom);
+    /**
+     * Creates a prepared polygon.
+     *
+     * @param geom the polygonal geometry to prepare
+     * @param useGridLocator whether to locate points with a
+     *        algorithm::locate::GridPointInAreaLocator rather than an
+     *        algorithm::locate::IndexedPointInAreaLocator
+     */
+    PreparedPolygon(const geom::Geometry* geom, bool useGridLocator = false);
     ~PreparedPolygon() override;
 
     noding::FastSegmentSetIntersectionFinder* getIntersectionFinder() const;
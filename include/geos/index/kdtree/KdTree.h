@@ -19,10 +19,12 @@
 #include <geos/index/kdtree/KdNodeVisitor.h>
 #include <geos/index/kdtree/KdNode.h>
 
+#include <cstddef>
 #include <memory>
 #include <vector>
 #include <string>
 #include <deque>
+#include <utility>
 
 #ifdef _MSC_VER
 #pragma warning(push)
@@ -31,6 +33,9 @@
 
 
 namespace geos {
+namespace geom {
+class CoordinateSequence;
+}
 namespace index { // geos::index
 namespace kdtree { // geos::index::kdtree
 
@@ -49,6 +54,17 @@ namespace kdtree { // geos::index::kdtree
  * If more than one node in the tree is within tolerance of an inserted point,
  * the closest and then lowest node is snapped to.
  *
+ * The shape of the tree depends on the order in which points are inserted.
+ * Inserting spatially sorted or autocorrelated points one at a time
+ * produces a degenerate tree with linear query time.
+ * To avoid this a set of points can be bulk-loaded with
+ * {@link insert(const geom::CoordinateSequence&)},
+ * which inserts them in an order producing a balanced tree
+ * (see {@link balancedOrder}).
+ *
+ * As well as range queries the tree supports
+ * k-nearest-neighbour and radius queries.
+ *
  * @author David Skea
  * @author Martin Davis
  */
@@ -66,6 +82,8 @@ private:
 
     void queryNode(KdNode* currentNode, const geom::Envelope& queryEnv, bool odd, KdNodeVisitor& visitor);
     KdNode* queryNodePoint(KdNode* currentNode, const geom::Coordinate& queryPt, bool odd);
+    void queryNearest(const geom::CoordinateXY& queryPt, std::size_t k,
+                      std::vector<std::pair<double, KdNode*>>& heap);
 
     /**
     * Create a node on a locally managed deque to allow easy
@@ -151,14 +169,48 @@ public:
         tolerance(p_tolerance)
         {};
 
+    /**
+    * Computes an order in which to insert a set of points
+    * so that the resulting tree is balanced.
+    * The order lists the median point (alternately by X and Y)
+    * of each subset ahead of the points on either side of it,
+    * so the tree depth is logarithmic in the number of distinct points
+    * regardless of how the input is ordered.
+    *
+    * @param pts the points to be inserted
+    * @return the indexes of the points, in insertion order
+    */
+    static std::vector<std::size_t> balancedOrder(const geom::CoordinateSequence& pts);
+    static std::vector<std::size_t> balancedOrder(const std::vector<geom::Coordinate>& pts);
+
     bool isEmpty() { return root == nullptr; }
 
+    /**
+    * Gets the number of distinct nodes in the tree.
+    */
+    std::size_t size() const { return numberOfNodes; }
+
+    /**
+    * Computes the depth of the tree
+    * (the number of nodes on its longest root-to-leaf path).
+    */
+    std::size_t depth() const;
+
     /**
     * Inserts a new point in the kd-tree.
     */
     KdNode* insert(const geom::Coordinate& p);
     KdNode* insert(const geom::Coordinate& p, void* data);
 
+    /**
+    * Inserts all the points of a sequence into the kd-tree,
+    * in an order which keeps the tree balanced.
+    * Points are snapped to existing nodes as for a single insert.
+    *
+    * @param pts the points to insert
+    */
+    void insert(const geom::CoordinateSequence& pts);
+
     /**
     * Performs a range search of the points in the index and visits all nodes found.
     */
@@ -179,6 +231,33 @@ public:
     */
     KdNode* query(const geom::Coordinate& queryPt);
 
+    /**
+    * Finds the node nearest to a given point.
+    *
+    * @param queryPt the point to search from
+    * @return the nearest node, or nullptr if the tree is empty
+    */
+    KdNode* nearestNeighbor(const geom::CoordinateXY& queryPt);
+
+    /**
+    * Finds the k nodes nearest to a given point.
+    * Nodes at equal distance are ordered by coordinate.
+    *
+    * @param queryPt the point to search from
+    * @param k the number of nodes to find
+    * @return up to k nodes, in order of increasing distance
+    */
+    std::vector<KdNode*> nearestNeighbors(const geom::CoordinateXY& queryPt, std::size_t k);
+
+    /**
+    * Finds the nodes lying within a given distance of a point.
+    *
+    * @param center the point to search from
+    * @param radius the search distance
+    * @param result the vector to which the nodes found are added
+    */
+    void queryRadius(const geom::CoordinateXY& center, double radius, std::vector<KdNode*>& result);
+
 };
 
 } // namespace geos::index::kdtree
@@ -231,14 +231,16 @@ public:
 
     template<typename ItemDistance>
     ItemType nearestNeighbour(const BoundsType& env, const ItemType& item, ItemDistance& itemDist) {
-        build();
+        if (!built()) {
+            build();
+        }
 
-        if (getRoot() == nullptr) {
+        if (root == nullptr) {
             return nullptr;
         }
 
         TemplateSTRNode<ItemType, BoundsTraits> bnd(item, env);
-        TemplateSTRNodePair<ItemType, BoundsTraits, ItemDistance> pair(*getRoot(), bnd, itemDist);
+        TemplateSTRNodePair<ItemType, BoundsTraits, ItemDistance> pair(*root, bnd, itemDist);
 
         TemplateSTRtreeDistance<ItemType, BoundsTraits, ItemDistance> td(itemDist);
         return td.nearestNeighbour(pair).first;
@@ -369,7 +371,10 @@ public:
 
     /** Determine whether the tree has been built, and no more items may be added. */
     const Node* getRoot() {
-        build();
+        //-- only take the build lock if the tree has not been built
+        if (!built()) {
+            build();
+        }
         return root;
     }
 
@@ -0,0 +1,178 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+
+#include <geos/geom/Envelope.h>
+#include <geos/noding/Noder.h>
+
+#include <utility>
+#include <vector>
+
+// Forward declarations
+namespace geos {
+namespace noding {
+class SegmentString;
+}
+}
+
+namespace geos {
+namespace noding { // geos::noding
+
+/**
+ * A noder for the linework of a polygonal geometry overlaid with
+ * a rectangle, where the linework has been clipped to an envelope
+ * (e.g. with operation::overlayng::RingClipper).
+ *
+ * For valid polygonal input the only intersections between the
+ * linework lie on the sides of the rectangle and along the sides
+ * of the clipping envelope (where clipped rings may overlap),
+ * and at points where rings touch.
+ * All these sides are axis-parallel lines,
+ * so the noding reduces to a one-dimensional computation along each side:
+ *
+ *  - segments crossing a side of the rectangle are noded at
+ *    the intersection point, which is placed exactly on the side
+ *  - vertices lying on a side are nodes if other linework
+ *    meets them
+ *  - segments lying along a side are split at every
+ *    vertex or intersection point on that side
+ *
+ * Rings can only touch at a vertex of one of them,
+ * so the touching points off the sides are found with an index
+ * of the vertices off the sides, queried with each segment.
+ * Other segments are not noded.
+ * This avoids computing segment intersections,
+ * which dominates the cost of full noding.
+ *
+ * The input must satisfy these conditions for the output
+ * to be correctly noded. If required, this can be checked
+ * using a {@link ValidatingNoder}.
+ *
+ * The input SegmentStrings must be NodedSegmentStrings.
+ */
+class GEOS_DLL RectangleSideNoder : public Noder {
+
+public:
+
+    /**
+    * Creates a noder for linework overlaid with a rectangle.
+    *
+    * @param p_rectEnv the envelope of the rectangle
+    * @param p_clipEnv the envelope the linework has been clipped to, or null
+    */
+    RectangleSideNoder(const geom::Envelope& p_rectEnv, const geom::Envelope* p_clipEnv);
+
+    void computeNodes(std::vector<SegmentString*>* segStrings) override;
+
+    /**
+    * @return a Collection of SegmentString representing the
+    * substrings. Caller takes ownership over vector and contents.
+    */
+    std::vector<SegmentString*>* getNodedSubstrings() const override;
+
+private:
+
+    /**
+    * An axis-parallel side, with the positions along it
+    * of the points of the linework which lie on it.
+    */
+    struct Side {
+        bool isVertical;
+        double ordinate;
+        // set for rectangle sides, which linework may cross
+        bool isCrossable;
+        geom::CoordinateXY start;
+        geom::CoordinateXY end;
+        // positions of vertices and crossing points (with repeats)
+        std::vector<double> positions;
+        // extents of segments lying along the side, ordered by start
+        std::vector<std::pair<double, double>> runs;
+        // maximum end of the runs up to each index
+        std::vector<double> runMaxEnd;
+
+        Side(bool p_isVertical, double p_ordinate, bool p_isCrossable,
+             const geom::CoordinateXY& p_start, const geom::CoordinateXY& p_end)
+            : isVertical(p_isVertical)
+            , ordinate(p_ordinate)
+            , isCrossable(p_isCrossable)
+            , start(p_start)
+            , end(p_end)
+        {}
+
+        bool isOn(const geom::CoordinateXY& p) const
+        {
+            return isVertical ? p.x == ordinate : p.y == ordinate;
+        }
+
+        double position(const geom::CoordinateXY& p) const
+        {
+            return isVertical ? p.y : p.x;
+        }
+
+        geom::CoordinateXY point(double pos) const
+        {
+            return isVertical ? geom::CoordinateXY(ordinate, pos) : geom::CoordinateXY(pos, ordinate);
+        }
+
+        /**
+        * Tests whether a segment with no endpoint on the side line
+        * crosses the side (including passing through an end of it).
+        */
+        bool isCrossedBy(const geom::CoordinateXY& p0, const geom::CoordinateXY& p1) const;
+
+        /**
+        * Computes the position of the point where a segment crosses the side.
+        */
+        double crossingPosition(const geom::CoordinateXY& p0, const geom::CoordinateXY& p1) const;
+
+        /**
+        * Tests whether a vertex at a position on the side must be a node,
+        * because other linework has a point there
+        * or runs along the side through it.
+        */
+        bool isNode(double pos) const;
+    };
+
+    /**
+    * A vertex of the linework which does not lie on a side.
+    */
+    struct InteriorVertex {
+        SegmentString* segString;
+        std::size_t index;
+    };
+
+    std::vector<Side> sides;
+    // points strictly inside this do not lie on any side
+    geom::Envelope interiorEnv;
+    std::vector<SegmentString*>* nodedSegStrings;
+
+    void addSides(const geom::Envelope& env, bool isCrossable);
+    bool isVertexNode(const geom::CoordinateXY& p) const;
+
+    bool isInterior(const geom::CoordinateXY& p) const
+    {
+        return p.x > interiorEnv.getMinX() && p.x < interiorEnv.getMaxX()
+            && p.y > interiorEnv.getMinY() && p.y < interiorEnv.getMaxY();
+    }
+
+    void addCrossingNodes(SegmentString* ss);
+    void addSideNodes(SegmentString* ss) const;
+    void addTouchNodes(std::vector<SegmentString*>& segStrings) const;
+
+};
+
+} // namespace geos::noding
+} // namespace geos
+
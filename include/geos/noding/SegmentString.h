@@ -94,7 +94,7 @@ public:
 
     template<typename CoordType = geom::Coordinate>
     const CoordType& getCoordinate(std::size_t i) const {
-        return seq->getAt<CoordType>(i);
+        return getCoordinates()->getAt<CoordType>(i);
     }
 
     /// \brief
@@ -123,8 +123,9 @@ public:
         if (index >= size() - 1) {
             return -1;
         }
-        return safeOctant(seq->getAt<geom::CoordinateXY>(index),
-                          seq->getAt<geom::CoordinateXY>(index + 1));
+        const geom::CoordinateSequence* pts = getCoordinates();
+        return safeOctant(pts->getAt<geom::CoordinateXY>(index),
+                          pts->getAt<geom::CoordinateXY>(index + 1));
     };
 
     static int getSegmentOctant(const SegmentString& ss, std::size_t index) {
@@ -132,7 +133,8 @@ public:
     }
 
     bool isClosed() const {
-        return seq->front<geom::CoordinateXY>().equals(seq->back<geom::CoordinateXY>());
+        const geom::CoordinateSequence* pts = getCoordinates();
+        return pts->front<geom::CoordinateXY>().equals(pts->back<geom::CoordinateXY>());
     }
 
     virtual std::ostream& print(std::ostream& os) const;
@@ -71,6 +71,7 @@ private:
     // Members
     double snapTolerance;
     SnappingPointIndex snapIndex;
+    bool isBalancedSeed;
     std::vector<SegmentString*>* nodedResult;
 
     // Methods
@@ -103,8 +104,23 @@ public:
     SnappingNoder(double p_snapTolerance)
         : snapTolerance(p_snapTolerance)
         , snapIndex(p_snapTolerance)
+        , isBalancedSeed(false)
         {}
 
+    /**
+     * Sets whether the points which seed the snap index
+     * are added in one batch, in an order which keeps the index
+     * balanced even if the input is spatially sorted.
+     * This can change which points become snap targets,
+     * so it is not enabled by default.
+     *
+     * @param p_isBalancedSeed true to seed the index in balanced order
+     */
+    void setBalancedSeed(bool p_isBalancedSeed)
+    {
+        isBalancedSeed = p_isBalancedSeed;
+    }
+
     /**
     * @return a Collection of NodedSegmentStrings representing the substrings
     */
@@ -52,6 +52,20 @@ public:
     */
     const geom::Coordinate& snap(const geom::Coordinate& p);
 
+    /**
+    * Snaps a set of coordinates into the index,
+    * in an order which keeps the index balanced
+    * even if the coordinates are spatially sorted.
+    *
+    * @param pts the points to add
+    */
+    void addAll(const geom::CoordinateSequence& pts);
+
+    /**
+    * Computes the depth of the index.
+    */
+    std::size_t depth() const;
+
 };
 
 } // namespace geos::noding::snap
@@ -175,6 +175,29 @@ public:
         double distance,
         BufferParameters& bufParms);
 
+    /** \brief
+     * Computes the buffers of a set of geometries,
+     * using the same distance and parameters for each.
+     *
+     * The buffers of non-empty Points are generated directly
+     * as the buffer curve of the point, since they cannot
+     * require noding. Other geometries are buffered as by bufferOp.
+     * The geometries are distributed over a number of threads.
+     *
+     * If buffering any geometry fails the first exception is rethrown.
+     *
+     * @param geoms the geometries to buffer
+     * @param distance the buffer distance
+     * @param bufParams the buffer parameters
+     * @param numThreads the number of threads (0 for the number of hardware threads)
+     * @return the buffers of the input geometries, in input order
+     */
+    static std::vector<std::unique_ptr<geom::Geometry>> bufferMany(
+        const std::vector<const geom::Geometry*>& geoms,
+        double distance,
+        const BufferParameters& bufParams,
+        std::size_t numThreads = 1);
+
     /** \brief
      * Initializes a buffer computation for the given geometry.
      *
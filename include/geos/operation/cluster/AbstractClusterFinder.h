@@ -95,6 +95,20 @@ public:
      */
     std::unique_ptr<geom::Geometry> clusterToCollection(const geom::Geometry & g);
 
+    /**
+     * Set the number of threads used to find the neighbours of each geometry.
+     * Finders which do not support multiple threads (see supportsParallel())
+     * ignore this setting.
+     * The clusters found do not depend on the number of threads.
+     *
+     * @param numThreads the number of threads (0 for the number of hardware threads)
+     */
+    void setNumThreads(std::size_t numThreads) {
+        m_numThreads = numThreads;
+    }
+
+    virtual ~AbstractClusterFinder() = default;
+
 protected:
     /**
      * Determine whether two geometries should be considered in the same cluster.
@@ -123,7 +137,40 @@ protected:
                  index::strtree::TemplateSTRtree<std::size_t> & index,
                  UnionFind & uf);
 
+    /**
+     * Determine whether this finder can cluster with multiple threads,
+     * i.e. whether it implements createWorker().
+     *
+     * @return `true` if multiple threads are supported
+     */
+    virtual bool supportsParallel() const {
+        return false;
+    }
+
+    /**
+     * Create an independent finder with the same parameters, which is used
+     * by a single worker thread when clustering with multiple threads.
+     * Since shouldJoin() and queryEnvelope() may keep state, a finder
+     * cannot be shared between threads.
+     * Only called if supportsParallel() returns `true`.
+     *
+     * @return a new finder, or nullptr if multiple threads are not supported
+     */
+    virtual std::unique_ptr<AbstractClusterFinder> createWorker() const {
+        return nullptr;
+    }
+
+    bool isParallel() const {
+        return m_numThreads != 1;
+    }
+
+    std::size_t m_numThreads = 1;
+
 private:
+    Clusters processParallel(const std::vector<const geom::Geometry*> & components,
+                             index::strtree::TemplateSTRtree<std::size_t> & index,
+                             UnionFind & uf);
+
     static std::vector<std::unique_ptr<geom::Geometry>> getComponents(std::unique_ptr<geom::Geometry>&& g);
 };
 
@@ -0,0 +1,129 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#ifndef GEOS_OPERATION_CLUSTER_CONCURRENTUNIONFIND
+#define GEOS_OPERATION_CLUSTER_CONCURRENTUNIONFIND
+
+#include <atomic>
+#include <vector>
+
+#include <geos/export.h>
+
+namespace geos {
+namespace operation {
+namespace cluster {
+
+class UnionFind;
+
+/** ConcurrentUnionFind provides a lock-free disjoint set data structure
+ * which can be updated from multiple threads at once.
+ *
+ * Roots are always linked beneath the root with the smaller index,
+ * so the root of each set is its smallest element, independent of
+ * the order in which sets were joined.
+ * Paths are compressed by path halving.
+ */
+class GEOS_DLL ConcurrentUnionFind {
+
+public:
+    /** Create a ConcurrentUnionFind object
+     *
+     * @param n the number of elements to be clustered (fixed size)
+     */
+    explicit ConcurrentUnionFind(std::size_t n) : parents(n) {
+        for (std::size_t i = 0; i < n; i++) {
+            parents[i].store(i, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * Return the ID of the set containing an item,
+     * which is the smallest item in the set at the time of the call.
+     *
+     * @param i index of the item to lookup
+     * @return a numeric set ID
+     */
+    std::size_t find(std::size_t i) {
+        std::size_t parent = parents[i].load(std::memory_order_acquire);
+        while (parent != i) {
+            std::size_t grandparent = parents[parent].load(std::memory_order_acquire);
+            if (grandparent != parent) {
+                parents[i].compare_exchange_weak(parent, grandparent, std::memory_order_acq_rel);
+            }
+            i = grandparent;
+            parent = parents[i].load(std::memory_order_acquire);
+        }
+        return i;
+    }
+
+    // Are two elements in the same set?
+    bool same(std::size_t i, std::size_t j) {
+        for (;;) {
+            std::size_t a = find(i);
+            std::size_t b = find(j);
+            if (a == b) {
+                return true;
+            }
+            // a may have been linked since it was found
+            if (parents[a].load(std::memory_order_acquire) == a) {
+                return false;
+            }
+        }
+    }
+
+    // Are two elements in a different set?
+    bool different(std::size_t i, std::size_t j) {
+        return !same(i, j);
+    }
+
+    /**
+     * Merge the sets associated with two items
+     * @param i ID of an item associated with the first set
+     * @param j ID of an item associated with the second set
+     */
+    void join(std::size_t i, std::size_t j) {
+        for (;;) {
+            std::size_t a = find(i);
+            std::size_t b = find(j);
+            if (a == b) {
+                return;
+            }
+            if (a < b) {
+                std::swap(a, b);
+            }
+            // link the larger root beneath the smaller one,
+            // unless it has been linked by another thread meanwhile
+            std::size_t expected = a;
+            if (parents[a].compare_exchange_strong(expected, b, std::memory_order_acq_rel)) {
+                return;
+            }
+        }
+    }
+
+    /**
+     * Join the sets of a (sequential) UnionFind
+     * in the same way as the sets of this object.
+     * This must not be called concurrently with updates.
+     *
+     * @param uf a UnionFind of the same size
+     */
+    void copyTo(UnionFind& uf);
+
+private:
+    std::vector<std::atomic<std::size_t>> parents;
+};
+
+}
+}
+}
+
+#endif
@@ -25,6 +25,10 @@ namespace cluster {
 
 /** DBSCANClusterFinder clusters geometries according to the DBSCAN algorithm.
  *
+ * A border point (one within eps of a core point, but not itself a core point)
+ * is assigned to the cluster of the first core point (in input order) within eps.
+ * When multiple threads are used, core points and their neighbours are
+ * determined concurrently, and the same clusters are found.
  */
 class GEOS_DLL DBSCANClusterFinder : public AbstractClusterFinder {
 public:
@@ -47,6 +51,10 @@ protected:
     }
 
 private:
+    Clusters processParallel(const std::vector<const geom::Geometry*> & components,
+                             index::strtree::TemplateSTRtree<std::size_t> & index,
+                             UnionFind & uf);
+
     double m_eps;
     size_t m_minPoints;
     geom::Envelope m_envelope;
@@ -40,6 +40,14 @@ protected:
         return a->getEnvelopeInternal()->distanceSquared(*b->getEnvelopeInternal()) <= m_distance_squared;
     }
 
+    bool supportsParallel() const override {
+        return true;
+    }
+
+    std::unique_ptr<AbstractClusterFinder> createWorker() const override {
+        return std::unique_ptr<AbstractClusterFinder>(new EnvelopeDistanceClusterFinder(m_distance));
+    }
+
 private:
     geom::Envelope m_envelope;
     double m_distance;
@@ -35,6 +35,14 @@ protected:
         return a->getEnvelopeInternal()->intersects(b->getEnvelopeInternal());
     }
 
+    bool supportsParallel() const override {
+        return true;
+    }
+
+    std::unique_ptr<AbstractClusterFinder> createWorker() const override {
+        return std::unique_ptr<AbstractClusterFinder>(new EnvelopeIntersectsClusterFinder());
+    }
+
 };
 
 }
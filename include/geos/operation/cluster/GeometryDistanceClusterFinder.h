@@ -46,6 +46,14 @@ protected:
         return m_envelope;
     }
 
+    bool supportsParallel() const override {
+        return true;
+    }
+
+    std::unique_ptr<AbstractClusterFinder> createWorker() const override {
+        return std::unique_ptr<AbstractClusterFinder>(new GeometryDistanceClusterFinder(m_distance));
+    }
+
 private:
     std::unique_ptr<geom::prep::PreparedGeometry> m_prep;
     double m_distance;
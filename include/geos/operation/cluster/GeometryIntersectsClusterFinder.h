@@ -41,6 +41,14 @@ protected:
         return m_prep->intersects(b);
     }
 
+    bool supportsParallel() const override {
+        return true;
+    }
+
+    std::unique_ptr<AbstractClusterFinder> createWorker() const override {
+        return std::unique_ptr<AbstractClusterFinder>(new GeometryIntersectsClusterFinder());
+    }
+
 private:
     std::unique_ptr<geom::prep::PreparedGeometry> m_prep;
 };
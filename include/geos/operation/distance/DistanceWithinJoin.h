@@ -0,0 +1,139 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+
+#include <cstddef>
+#include <functional>
+#include <utility>
+#include <vector>
+
+// Forward declarations
+namespace geos {
+namespace geom {
+class Geometry;
+}
+}
+
+namespace geos {
+namespace operation {
+namespace distance {
+
+/** \brief
+ * Finds all pairs of geometries from two sets which lie
+ * within a given distance of each other.
+ *
+ * The B geometries are loaded into an STRtree, which is queried with the
+ * envelope of each A geometry expanded by the distance.
+ * Each candidate pair is then tested using the cheapest exact test:
+ *
+ *  - pairs of points are tested directly
+ *  - if either geometry has at least the
+ *    \ref setIndexThreshold "index threshold" number of points,
+ *    an IndexedFacetDistance is used.
+ *    The index of a B geometry is built on first use and re-used for all
+ *    subsequent A geometries.
+ *  - otherwise DistanceOp::isWithinDistance is used.
+ *
+ * The A geometries are distributed over a number of threads.
+ * Matching pairs are passed to the visitor on the calling thread,
+ * ordered by the index of the A geometry and then of the B geometry,
+ * so the visitor does not need to be thread-safe
+ * and the result does not depend on the number of threads.
+ *
+ * Empty geometries are not within any distance of another geometry.
+ * The input geometries must remain alive and unmodified
+ * while the join is running.
+ */
+class GEOS_DLL DistanceWithinJoin {
+
+public:
+
+    /**
+     * Creates a join between two sets of geometries.
+     *
+     * @param geomsA the A geometries
+     * @param geomsB the B geometries
+     * @param distance the maximum distance between joined geometries
+     */
+    DistanceWithinJoin(const std::vector<const geom::Geometry*>& geomsA,
+                       const std::vector<const geom::Geometry*>& geomsB,
+                       double distance);
+
+    /**
+     * Sets the number of threads used to test the A geometries.
+     * The default is 1.
+     *
+     * @param numThreads the number of threads (0 for the number of hardware threads)
+     */
+    void setNumThreads(std::size_t numThreads)
+    {
+        m_numThreads = numThreads;
+    }
+
+    /**
+     * Sets the number of points at which a geometry is considered large
+     * enough to be tested with an IndexedFacetDistance.
+     *
+     * @param numPoints the minimum number of points of an indexed geometry
+     */
+    void setIndexThreshold(std::size_t numPoints)
+    {
+        m_indexThreshold = numPoints;
+    }
+
+    /**
+     * Computes the join, passing the indexes of each
+     * matching pair of A and B geometries to a visitor.
+     *
+     * @param visitor the function to call for each matching pair
+     */
+    void join(const std::function<void(std::size_t indexA, std::size_t indexB)>& visitor) const;
+
+    /**
+     * Computes the join, returning the indexes of the matching pairs.
+     *
+     * @return the (A, B) index pairs, ordered by A and then B
+     */
+    std::vector<std::pair<std::size_t, std::size_t>> join() const;
+
+    /**
+     * Finds all pairs of geometries from two sets which lie
+     * within a given distance of each other.
+     *
+     * @param geomsA the A geometries
+     * @param geomsB the B geometries
+     * @param distance the maximum distance between joined geometries
+     * @param numThreads the number of threads (0 for the number of hardware threads)
+     * @return the (A, B) index pairs, ordered by A and then B
+     */
+    static std::vector<std::pair<std::size_t, std::size_t>> join(
+        const std::vector<const geom::Geometry*>& geomsA,
+        const std::vector<const geom::Geometry*>& geomsB,
+        double distance,
+        std::size_t numThreads = 1);
+
+private:
+
+    std::vector<const geom::Geometry*> m_geomsA;
+    std::vector<const geom::Geometry*> m_geomsB;
+    double m_distance;
+    std::size_t m_numThreads = 1;
+    std::size_t m_indexThreshold = 64;
+
+};
+
+} // namespace geos::operation::distance
+} // namespace geos::operation
+} // namespace geos
@@ -42,6 +42,11 @@ namespace distance {
 /// or both input geometries are large, or when evaluating many distance
 /// computations against a single geometry.
 ///
+/// The index is built when the instance is created,
+/// so the (const) query methods may be called concurrently from
+/// multiple threads.
+/// Batch methods are provided which do this for a list of geometries.
+///
 /// \author Martin Davis
 class GEOS_DLL IndexedFacetDistance {
 public:
@@ -94,6 +99,32 @@ public:
     /// \return true of the geometry lies within the specified distance
     bool isWithinDistance(const geom::Geometry* g, double maxDistance) const;
 
+    /// \brief Computes the distances from the base geometry to each of a list of geometries.
+    ///
+    /// The geometries are distributed over a number of threads.
+    ///
+    /// \param geoms the geometries to compute the distance to
+    /// \param numThreads the number of threads (0 for the number of hardware threads)
+    ///
+    /// \return the distance to each geometry, in input order
+    /// \throws util::GEOSException if the base geometry or any of the geometries is empty
+    std::vector<double> distance(const std::vector<const geom::Geometry*>& geoms,
+                                 std::size_t numThreads = 1) const;
+
+    /// \brief Tests whether the base geometry lies within a specified distance
+    /// of each of a list of geometries.
+    ///
+    /// The geometries are distributed over a number of threads.
+    ///
+    /// \param geoms the geometries to test
+    /// \param maxDistance the maximum distance to test
+    /// \param numThreads the number of threads (0 for the number of hardware threads)
+    ///
+    /// \return for each geometry (in input order), whether it lies within the distance
+    std::vector<bool> isWithinDistance(const std::vector<const geom::Geometry*>& geoms,
+                                       double maxDistance,
+                                       std::size_t numThreads = 1) const;
+
     /// \brief Computes the nearest locations on the base geometry and the given geometry.
     ///
     /// \param g the geometry to compute the nearest location to
@@ -114,6 +145,14 @@ private:
         }
     };
 
+    /// Computes the distance to a non-empty point
+    /// without building an index for it.
+    double pointDistance(const geom::Geometry* pt) const;
+
+    /// Tests whether a non-empty point lies within a distance,
+    /// stopping at the first facet found within the distance.
+    bool isPointWithinDistance(const geom::Geometry* pt, double maxDistance) const;
+
     std::unique_ptr<geos::index::strtree::TemplateSTRtree<const FacetSequence*>> cachedTree;
     const geom::Geometry& baseGeometry;
 
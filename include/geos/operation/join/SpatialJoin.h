@@ -0,0 +1,169 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+
+#include <cstddef>
+#include <functional>
+#include <utility>
+#include <vector>
+
+// Forward declarations
+namespace geos {
+namespace geom {
+class Geometry;
+}
+}
+
+namespace geos {
+namespace operation {
+namespace join {
+
+/** \brief
+ * Finds all pairs of geometries from two sets which satisfy
+ * a spatial predicate.
+ *
+ * A pair (a, b) is reported if `predicate(a, b)` is true,
+ * e.g. for SpatialJoin::CONTAINS, if `a` contains `b`.
+ *
+ * The geometries of one side are loaded into an STRtree,
+ * and are prepared (see geom::prep::PreparedGeometry) on first use.
+ * For the asymmetric predicates the containing side is indexed,
+ * since only that side benefits from preparation.
+ * For the symmetric predicates the side with the larger average
+ * number of points is indexed.
+ *
+ * The geometries of the other side are processed in Hilbert order
+ * of their envelopes, so that consecutive queries tend to hit the same
+ * indexed geometries.
+ * They are distributed over a number of threads in blocks,
+ * with each thread keeping its own cache of prepared geometries.
+ * Matching pairs are passed to the visitor on the calling thread.
+ * The order in which they are visited is unspecified,
+ * but does not depend on the number of threads.
+ *
+ * SpatialJoin::DWITHIN joins are computed by
+ * operation::distance::DistanceWithinJoin.
+ *
+ * Empty geometries do not satisfy any of the predicates.
+ * The input geometries must remain alive and unmodified
+ * while the join is running.
+ */
+class GEOS_DLL SpatialJoin {
+
+public:
+
+    /// The spatial predicates which may be used to join geometries
+    enum Predicate {
+        /// a intersects b
+        INTERSECTS,
+        /// a contains b
+        CONTAINS,
+        /// a covers b
+        COVERS,
+        /// a is within b
+        WITHIN,
+        /// a is covered by b
+        COVEREDBY,
+        /// the distance between a and b is at most the join distance
+        DWITHIN
+    };
+
+    /**
+     * Creates a join between two sets of geometries.
+     *
+     * @param geomsA the A geometries
+     * @param geomsB the B geometries
+     * @param predicate the predicate to join on
+     */
+    SpatialJoin(const std::vector<const geom::Geometry*>& geomsA,
+                const std::vector<const geom::Geometry*>& geomsB,
+                Predicate predicate);
+
+    /**
+     * Sets the maximum distance between joined geometries,
+     * for SpatialJoin::DWITHIN joins.
+     *
+     * @param distance the maximum distance
+     */
+    void setDistance(double distance)
+    {
+        m_distance = distance;
+    }
+
+    /**
+     * Sets the number of threads used to test candidate pairs.
+     * The default is 1.
+     *
+     * @param numThreads the number of threads (0 for the number of hardware threads)
+     */
+    void setNumThreads(std::size_t numThreads)
+    {
+        m_numThreads = numThreads;
+    }
+
+    /**
+     * Computes the join, passing the indexes of each
+     * matching pair of A and B geometries to a visitor.
+     *
+     * @param visitor the function to call for each matching pair
+     */
+    void join(const std::function<void(std::size_t indexA, std::size_t indexB)>& visitor) const;
+
+    /**
+     * Computes the join, returning the indexes of the matching pairs.
+     *
+     * @return the (A, B) index pairs, ordered by A and then B
+     */
+    std::vector<std::pair<std::size_t, std::size_t>> join() const;
+
+    /**
+     * Finds all pairs of geometries from two sets which satisfy
+     * a spatial predicate.
+     *
+     * @param geomsA the A geometries
+     * @param geomsB the B geometries
+     * @param predicate the predicate to join on
+     * @param numThreads the number of threads (0 for the number of hardware threads)
+     * @return the (A, B) index pairs, ordered by A and then B
+     */
+    static std::vector<std::pair<std::size_t, std::size_t>> join(
+        const std::vector<const geom::Geometry*>& geomsA,
+        const std::vector<const geom::Geometry*>& geomsB,
+        Predicate predicate,
+        std::size_t numThreads = 1);
+
+private:
+
+    std::vector<const geom::Geometry*> m_geomsA;
+    std::vector<const geom::Geometry*> m_geomsB;
+    Predicate m_predicate;
+    double m_distance = 0.0;
+    std::size_t m_numThreads = 1;
+
+    bool isIndexA() const;
+
+    /*
+     * Tests a query geometry against the indexed geometries,
+     * visiting matches as (query index, indexed index) pairs.
+     */
+    void joinIndexed(const std::vector<const geom::Geometry*>& query,
+                     const std::vector<const geom::Geometry*>& indexed,
+                     const std::function<void(std::size_t, std::size_t)>& visitor) const;
+
+};
+
+} // namespace geos::operation::join
+} // namespace geos::operation
+} // namespace geos
@@ -45,6 +45,7 @@
 #include <geos/operation/overlayng/OverlayUtil.h>
 #include <geos/operation/overlayng/RingClipper.h>
 #include <geos/operation/valid/RepeatedPointRemover.h>
+#include <geos/util/Arena.h>
 
 
 #include <geos/export.h>
@@ -100,8 +101,9 @@ private:
     std::unique_ptr<Noder> internalNoder;
     std::unique_ptr<Noder> spareInternalNoder;
     // EdgeSourceInfo*, Edge* owned by EdgeNodingBuilder, stored in deque
-    std::deque<EdgeSourceInfo> edgeSourceInfoQue;
-    std::deque<Edge> edgeQue;
+    // (backed by the arena, if one is provided)
+    std::deque<EdgeSourceInfo, geos::util::ArenaAllocator<EdgeSourceInfo>> edgeSourceInfoQue;
+    std::deque<Edge, geos::util::ArenaAllocator<Edge>> edgeQue;
     bool inputHasZ;
     bool inputHasM;
 
@@ -195,14 +197,18 @@ public:
     * Creates a new builder, with an optional custom noder.
     * If the noder is not provided, a suitable one will
     * be used based on the supplied precision model.
+    * If an arena is provided, the created Edges and
+    * their source information are allocated from it.
     */
-    EdgeNodingBuilder(const PrecisionModel* p_pm, Noder* p_customNoder)
+    EdgeNodingBuilder(const PrecisionModel* p_pm, Noder* p_customNoder, geos::util::Arena* p_arena = nullptr)
         : pm(p_pm)
         , inputEdges(new std::vector<SegmentString*>)
         , customNoder(p_customNoder)
         , hasEdges{{false,false}}
         , clipEnv(nullptr)
         , intAdder(lineInt)
+        , edgeSourceInfoQue(geos::util::ArenaAllocator<EdgeSourceInfo>(p_arena))
+        , edgeQue(geos::util::ArenaAllocator<Edge>(p_arena))
         , inputHasZ(false)
         , inputHasM(false)
         {};
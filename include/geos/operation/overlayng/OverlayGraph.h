@@ -19,7 +19,9 @@
 #include <geos/operation/overlayng/OverlayEdge.h>
 #include <geos/operation/overlayng/OverlayLabel.h>
 #include <geos/geom/CoordinateSequence.h>
+#include <geos/util/Arena.h>
 
+#include <functional>
 #include <unordered_map>
 #include <vector>
 #include <deque>
@@ -55,13 +57,19 @@ class GEOS_DLL OverlayGraph {
 
 private:
 
+    using NodeMap = std::unordered_map<Coordinate, OverlayEdge*,
+                                       geom::Coordinate::HashCode,
+                                       std::equal_to<Coordinate>,
+                                       geos::util::ArenaAllocator<std::pair<const Coordinate, OverlayEdge*>>>;
+
     // Members
-    std::unordered_map<Coordinate, OverlayEdge*, geom::Coordinate::HashCode> nodeMap;
+    NodeMap nodeMap;
     std::vector<OverlayEdge*> edges;
 
-    // Locally store the OverlayEdge and OverlayLabel
-    std::deque<OverlayEdge> ovEdgeQue;
-    std::deque<OverlayLabel> ovLabelQue;
+    // Locally store the OverlayEdge and OverlayLabel,
+    // in the arena if one is provided
+    std::deque<OverlayEdge, geos::util::ArenaAllocator<OverlayEdge>> ovEdgeQue;
+    std::deque<OverlayLabel, geos::util::ArenaAllocator<OverlayLabel>> ovLabelQue;
 
     std::vector<std::unique_ptr<const geom::CoordinateSequence>> csQue;
 
@@ -87,8 +95,14 @@ public:
 
     /**
     * Creates a new graph for a set of noded, labelled {@link Edge}s.
+    *
+    * If an arena is provided, the graph nodes, edges and labels
+    * are allocated from it. The arena must outlive the graph,
+    * and should only be reset after the graph is destroyed.
+    *
+    * @param arena the arena to allocate from (may be null)
     */
-    OverlayGraph();
+    explicit OverlayGraph(geos::util::Arena* arena = nullptr);
 
     OverlayGraph(const OverlayGraph& g) = delete;
     OverlayGraph& operator=(const OverlayGraph& g) = delete;
@@ -35,6 +35,9 @@ class PrecisionModel;
 namespace noding {
 class Noder;
 }
+namespace util {
+class Arena;
+}
 namespace operation {
 namespace overlayng {
 }
@@ -127,15 +130,24 @@ private:
     const geom::GeometryFactory* geomFact;
     int opCode;
     noding::Noder* noder;
+    geos::util::Arena* arena;
     bool isStrictMode;
     bool isOptimized;
     bool isAreaResultOnly;
     bool isOutputEdges;
     bool isOutputResultEdges;
     bool isOutputNodedEdges;
+    bool isRectangleClipMode;
 
     // Methods
     std::unique_ptr<geom::Geometry> computeEdgeOverlay();
+    std::unique_ptr<geom::Geometry> computeEdgeOverlay(const geom::Envelope* rectEnv);
+
+    /**
+    * Tests whether the overlay can be computed using the
+    * rectangle fast path, and if so provides the rectangle envelope.
+    */
+    bool isRectangleClipped(geom::Envelope& rectEnv) const;
     void labelGraph(OverlayGraph* graph);
 
     /**
@@ -185,12 +197,14 @@ public:
         , geomFact(p_geomFact)
         , opCode(p_opCode)
         , noder(nullptr)
+        , arena(nullptr)
         , isStrictMode(STRICT_MODE_DEFAULT)
         , isOptimized(true)
         , isAreaResultOnly(false)
         , isOutputEdges(false)
         , isOutputResultEdges(false)
         , isOutputNodedEdges(false)
+        , isRectangleClipMode(false)
     {}
 
     /**
@@ -204,12 +218,14 @@ public:
         , geomFact(geom0->getFactory())
         , opCode(p_opCode)
         , noder(nullptr)
+        , arena(nullptr)
         , isStrictMode(STRICT_MODE_DEFAULT)
         , isOptimized(true)
         , isAreaResultOnly(false)
         , isOutputEdges(false)
         , isOutputResultEdges(false)
         , isOutputNodedEdges(false)
+        , isRectangleClipMode(false)
     {}
 
     /**
@@ -248,6 +264,47 @@ public:
     void setOutputResultEdges(bool p_isOutputResultEdges) { isOutputResultEdges = p_isOutputResultEdges; }
     void setNoder(noding::Noder* p_noder) { noder = p_noder; }
 
+    /**
+    * Sets an arena from which the overlay topology graph
+    * (the noded Edges, OverlayEdges, OverlayLabels and node map)
+    * is allocated.
+    *
+    * The arena is not reset by the overlay, so that the
+    * caller controls when its memory is reclaimed
+    * (typically by calling geos::util::Arena::reset() after each overlay
+    * of a batch). The arena must not be used concurrently
+    * by other threads.
+    *
+    * If no arena is set, a thread-local arena is used,
+    * which is reset after each overlay computation.
+    *
+    * @param p_arena the arena to use
+    */
+    void setArena(geos::util::Arena* p_arena) { arena = p_arena; }
+
+    /**
+    * Sets whether the intersection of a polygonal geometry
+    * with a rectangle uses a fast path.
+    *
+    * If set, and the operation is an INTERSECTION of a
+    * rectangular Polygon with a polygonal geometry,
+    * using floating precision and the default noder,
+    * the linework is noded with a {@link noding::RectangleSideNoder}.
+    * Since the intersections of valid polygonal linework with a rectangle
+    * all lie on the rectangle sides (or along the sides of the clipping envelope)
+    * this avoids the cost of a general noding, and gives
+    * the same result as the full overlay.
+    * This is much faster for inputs with many
+    * short monotone chains (such as detailed coastlines).
+    *
+    * The polygonal input must be valid.
+    * If the optimized computation fails the full overlay is used.
+    * Default is FALSE.
+    *
+    * @param p_isRectangleClipMode whether to use the rectangle fast path
+    */
+    void setRectangleClipMode(bool p_isRectangleClipMode) { isRectangleClipMode = p_isRectangleClipMode; }
+
     void setOutputNodedEdges(bool p_isOutputNodedEdges)
     {
         isOutputEdges = true;
@@ -0,0 +1,170 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+#include <geos/geom/Envelope.h>
+#include <geos/index/chain/MonotoneChain.h>
+#include <geos/index/strtree/TemplateSTRtree.h>
+
+#include <memory>
+#include <vector>
+
+// Forward declarations
+namespace geos {
+namespace geom {
+class Geometry;
+class GeometryFactory;
+}
+namespace algorithm {
+namespace locate {
+class IndexedPointInAreaLocator;
+}
+}
+}
+
+namespace geos {      // geos.
+namespace operation { // geos.operation
+namespace overlayng { // geos.operation.overlayng
+
+/**
+ * Computes overlays of many geometries against a single fixed
+ * "mask" geometry, caching the information about the mask
+ * which can be reused between overlays.
+ *
+ * The mask linework is indexed once using monotone chains,
+ * and for polygonal masks an {@link algorithm::locate::IndexedPointInAreaLocator}
+ * is created. For each overlay only the mask segments
+ * lying within a clip envelope around the other operand are extracted
+ * and noded, and the resulting clipped mask is overlaid using {@link OverlayNGRobust}.
+ * The clip envelope is chosen (as in {@link RobustClipEnvelopeComputer})
+ * so that mask segments which may intersect the operand are not altered.
+ * Since the clipped mask is identical to the mask within the envelope,
+ * the result is the same as overlaying with the full mask,
+ * but the cost is proportional to the size of the
+ * local portion of the mask rather than the whole of it.
+ * This makes the class suitable for intersecting a large
+ * polygon with many small features.
+ *
+ * Only the overlay operations whose result lies within the
+ * other operand are supported (INTERSECTION and DIFFERENCE with the
+ * mask as the second argument).
+ *
+ * Polygonal and lineal masks are optimized. Other masks
+ * are supported, but are overlaid in full.
+ *
+ * The mask geometry must remain valid for the lifetime of this object.
+ * Once constructed, the object may be used concurrently from multiple threads.
+ */
+class GEOS_DLL PreparedOverlay {
+
+public:
+
+    /**
+     * Creates a new overlay against the given mask geometry.
+     *
+     * @param mask the geometry to overlay others against
+     */
+    explicit PreparedOverlay(const geom::Geometry& mask);
+
+    ~PreparedOverlay();
+
+    PreparedOverlay(const PreparedOverlay&) = delete;
+    PreparedOverlay& operator=(const PreparedOverlay&) = delete;
+
+    const geom::Geometry& getMask() const
+    {
+        return mask;
+    }
+
+    /**
+     * Computes the intersection of a geometry with the mask.
+     *
+     * @param geom the geometry to intersect
+     * @return the intersection of geom and the mask
+     */
+    std::unique_ptr<geom::Geometry> intersection(const geom::Geometry* geom) const;
+
+    /**
+     * Computes the difference of a geometry and the mask.
+     *
+     * @param geom the geometry to subtract the mask from
+     * @return the part of geom not in the mask
+     */
+    std::unique_ptr<geom::Geometry> difference(const geom::Geometry* geom) const;
+
+    /**
+     * Computes an overlay of a geometry with the mask.
+     *
+     * @param geom the first operand
+     * @param opCode OverlayNG::INTERSECTION or OverlayNG::DIFFERENCE
+     * @return the result of the overlay
+     *
+     * @throws util::IllegalArgumentException if the operation is not supported
+     */
+    std::unique_ptr<geom::Geometry> overlay(const geom::Geometry* geom, int opCode) const;
+
+    /**
+     * Computes a geometry which is identical to the mask
+     * within the given envelope. Outside the envelope it
+     * has no points.
+     *
+     * The result is null if the mask is not polygonal or lineal,
+     * or if the local part of the mask is so large that
+     * clipping is not worthwhile.
+     *
+     * @param clipEnv the envelope to clip to
+     * @return the clipped mask, or null
+     */
+    std::unique_ptr<geom::Geometry> clipMask(const geom::Envelope& clipEnv) const;
+
+private:
+
+    /**
+     * If more than this fraction of the mask segments lie
+     * in the envelope of an operand the mask is used in full.
+     */
+    static constexpr double MAX_CLIP_SEGMENT_FRACTION = 0.5;
+
+    /**
+     * The clip envelope is expanded by this fraction of
+     * its size, so that the clip boundary does not interact
+     * with the operand.
+     */
+    static constexpr double CLIP_ENV_EXPANSION_FACTOR = 0.1;
+
+    const geom::Geometry& mask;
+    const geom::GeometryFactory* geomFact;
+    bool isPolygonal;
+    bool isLineal;
+    std::size_t numSegments;
+
+    std::vector<index::chain::MonotoneChain> chains;
+    mutable index::strtree::TemplateSTRtree<const index::chain::MonotoneChain*> chainIndex;
+    std::unique_ptr<algorithm::locate::IndexedPointInAreaLocator> locator;
+
+    void addLinework(const geom::Geometry& g);
+
+    geom::Envelope computeClipEnvelope(const geom::Envelope& env) const;
+
+    std::unique_ptr<geom::Geometry> clipPolygonal(
+        const geom::Envelope& clipEnv,
+        std::vector<std::unique_ptr<geom::Geometry>>& lines) const;
+
+};
+
+
+} // namespace geos.operation.overlayng
+} // namespace geos.operation
+} // namespace geos
+
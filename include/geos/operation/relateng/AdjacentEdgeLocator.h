@@ -0,0 +1,76 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/Location.h>
+
+#include <memory>
+#include <vector>
+
+// Forward declarations
+namespace geos {
+namespace geom {
+class Geometry;
+class LinearRing;
+}
+}
+
+namespace geos {      // geos.
+namespace operation { // geos.operation
+namespace relateng {  // geos.operation.relateng
+
+class NodeSections;
+
+/**
+ * Determines the location for a point which is known to lie
+ * on at least one edge of a set of polygons.
+ * This provides the union-semantics for determining
+ * point location in a GeometryCollection, which may
+ * have polygons with adjacent edges which are effectively
+ * in the interior of the geometry.
+ * Note that it is also possible to have adjacent edges which lie on the boundary of the geometry
+ * (e.g. a polygon contained within another polygon with adjacent edges).
+ */
+class GEOS_DLL AdjacentEdgeLocator {
+
+private:
+
+    std::vector<std::unique_ptr<geom::CoordinateSequence>> ringList;
+
+    void addSections(const geom::CoordinateXY& p,
+                     const geom::CoordinateSequence& ring,
+                     NodeSections& sections) const;
+
+    void init(const geom::Geometry& geom);
+
+    void addRings(const geom::Geometry& geom);
+
+    void addRing(const geom::LinearRing* ring, bool requireCW);
+
+public:
+
+    explicit AdjacentEdgeLocator(const geom::Geometry& geom)
+    {
+        init(geom);
+    }
+
+    geom::Location locate(const geom::CoordinateXY& p) const;
+
+};
+
+} // namespace geos.operation.relateng
+} // namespace geos.operation
+} // namespace geos
@@ -0,0 +1,94 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+#include <geos/operation/relateng/TopologyPredicate.h>
+
+namespace geos {      // geos.
+namespace operation { // geos.operation
+namespace relateng {  // geos.operation.relateng
+
+/**
+ * The base class for relate predicate evaluation.
+ * Provides a tri-state value (unknown, false, true),
+ * which once known can no longer be changed.
+ */
+class GEOS_DLL BasicPredicate : public TopologyPredicate {
+
+private:
+
+    static constexpr int VALUE_UNKNOWN = -1;
+    static constexpr int VALUE_FALSE = 0;
+    static constexpr int VALUE_TRUE = 1;
+
+    int m_value = VALUE_UNKNOWN;
+
+    static bool isKnown(int val)
+    {
+        return val > VALUE_UNKNOWN;
+    }
+
+    static bool toBoolean(int val)
+    {
+        return val == VALUE_TRUE;
+    }
+
+    static int toValue(bool val)
+    {
+        return val ? VALUE_TRUE : VALUE_FALSE;
+    }
+
+protected:
+
+    /**
+     * Updates the predicate value to the given state
+     * if it is currently unknown.
+     *
+     * @param val the predicate value to update
+     */
+    void setValue(bool val);
+
+    void setValueIf(bool val, bool cond);
+
+    void require(bool cond);
+
+    void requireCovers(const geom::Envelope& a, const geom::Envelope& b);
+
+public:
+
+    /**
+     * Tests if two geometries intersect
+     * based on an interaction at given locations.
+     *
+     * @param locA the location on geometry A
+     * @param locB the location on geometry B
+     * @return true if the geometries intersect
+     */
+    static bool isIntersection(geom::Location locA, geom::Location locB);
+
+    bool isKnown() const override
+    {
+        return isKnown(m_value);
+    }
+
+    bool value() const override
+    {
+        return toBoolean(m_value);
+    }
+
+};
+
+} // namespace geos.operation.relateng
+} // namespace geos.operation
+} // namespace geos
@@ -0,0 +1,65 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+#include <geos/geom/Location.h>
+
+namespace geos {      // geos.
+namespace operation { // geos.operation
+namespace relateng {  // geos.operation.relateng
+
+/**
+ * Codes which combine a topological location with the dimension
+ * of the geometry element the location lies in.
+ * This allows a single value to report e.g. that a point
+ * lies in the interior of a line, or on the boundary of an area.
+ */
+class GEOS_DLL DimensionLocation {
+
+public:
+
+    enum DimensionLocationType {
+        EXTERIOR = 2,        // == Location::EXTERIOR
+        POINT_INTERIOR = 103,
+        LINE_INTERIOR = 110,
+        LINE_BOUNDARY = 111,
+        AREA_INTERIOR = 120,
+        AREA_BOUNDARY = 121
+    };
+
+    static int locationArea(geom::Location loc);
+
+    static int locationLine(geom::Location loc);
+
+    static int locationPoint(geom::Location loc);
+
+    static geom::Location location(int dimLoc);
+
+    static int dimension(int dimLoc);
+
+    /**
+     * Gets the dimension of a dimension location,
+     * using a given dimension for the exterior.
+     *
+     * @param dimLoc the dimension location
+     * @param exteriorDim the dimension to report for the exterior
+     * @return the dimension
+     */
+    static int dimension(int dimLoc, int exteriorDim);
+
+};
+
+} // namespace geos.operation.relateng
+} // namespace geos.operation
+} // namespace geos
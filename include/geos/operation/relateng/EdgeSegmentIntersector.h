@@ -0,0 +1,57 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+#include <geos/algorithm/LineIntersector.h>
+#include <geos/noding/SegmentIntersector.h>
+
+namespace geos {      // geos.
+namespace operation { // geos.operation
+namespace relateng {  // geos.operation.relateng
+
+class RelateSegmentString;
+class TopologyComputer;
+
+/**
+ * Tests segments of {@link RelateSegmentString}s
+ * and if they intersect adds the intersection(s)
+ * to the {@link TopologyComputer}.
+ */
+class GEOS_DLL EdgeSegmentIntersector : public noding::SegmentIntersector {
+
+private:
+
+    algorithm::LineIntersector li;
+    TopologyComputer& topoComputer;
+
+    void addIntersections(RelateSegmentString* ssA, std::size_t segIndexA,
+                          RelateSegmentString* ssB, std::size_t segIndexB);
+
+public:
+
+    explicit EdgeSegmentIntersector(TopologyComputer& p_topoComputer)
+        : topoComputer(p_topoComputer)
+    {}
+
+    void processIntersections(
+        noding::SegmentString* ss0, std::size_t segIndex0,
+        noding::SegmentString* ss1, std::size_t segIndex1) override;
+
+    bool isDone() const override;
+
+};
+
+} // namespace geos.operation.relateng
+} // namespace geos.operation
+} // namespace geos
@@ -0,0 +1,67 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+#include <geos/index/chain/MonotoneChain.h>
+#include <geos/index/strtree/TemplateSTRtree.h>
+
+#include <memory>
+#include <vector>
+
+// Forward declarations
+namespace geos {
+namespace geom {
+class Envelope;
+}
+}
+
+namespace geos {      // geos.
+namespace operation { // geos.operation
+namespace relateng {  // geos.operation.relateng
+
+class EdgeSegmentIntersector;
+class RelateSegmentString;
+
+/**
+ * Finds all intersections between the edges of both inputs
+ * (including self-intersections), using monotone chains
+ * indexed in an STRtree.
+ * Only chains intersecting the interaction envelope are indexed.
+ */
+class GEOS_DLL EdgeSetIntersector {
+
+private:
+
+    std::vector<index::chain::MonotoneChain> monoChains;
+    index::strtree::TemplateSTRtree<const index::chain::MonotoneChain*> index;
+    const geom::Envelope* envelope;
+
+    void addEdges(const std::vector<std::unique_ptr<RelateSegmentString>>& segStrings);
+
+    void addToIndex(RelateSegmentString* segStr);
+
+public:
+
+    EdgeSetIntersector(
+        const std::vector<std::unique_ptr<RelateSegmentString>>& edgesA,
+        const std::vector<std::unique_ptr<RelateSegmentString>>& edgesB,
+        const geom::Envelope* env);
+
+    void process(EdgeSegmentIntersector& intersector);
+
+};
+
+} // namespace geos.operation.relateng
+} // namespace geos.operation
+} // namespace geos
@@ -0,0 +1,88 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+#include <geos/geom/IntersectionMatrix.h>
+#include <geos/operation/relateng/IMPredicate.h>
+
+#include <string>
+
+namespace geos {      // geos.
+namespace operation { // geos.operation
+namespace relateng {  // geos.operation.relateng
+
+/**
+ * A predicate that matches a DE-9IM pattern.
+ *
+ * The evaluation is short-circuited (as false)
+ * as soon as a computed matrix entry exceeds the
+ * corresponding pattern entry, or if the input dimensions
+ * cannot provide an entry the pattern requires.
+ * It is short-circuited (as true) as soon as
+ * all constrained entries are satisfied and cannot change further
+ * (e.g. for patterns containing only T and * entries).
+ *
+ * The pattern also determines whether the envelope of one input
+ * must cover the other, and whether the locations of
+ * input elements in the exterior of the other input are needed.
+ */
+class GEOS_DLL IMPatternMatcher : public IMPredicate {
+
+private:
+
+    std::string imPattern;
+    geom::IntersectionMatrix patternMatrix;
+
+    static bool requireInteraction(const geom::IntersectionMatrix& im);
+
+    static bool isInteraction(int imDim);
+
+    static int maxDimension(geom::Location loc, int dim);
+
+    bool isDimsCompatible() const;
+
+protected:
+
+    bool isDetermined() const override;
+
+    bool valueIM() const override;
+
+public:
+
+    /**
+     * Creates a matcher for a DE-9IM pattern.
+     *
+     * @param p_imPattern the pattern to match
+     *
+     * @throws util::IllegalArgumentException if the pattern is not valid
+     */
+    explicit IMPatternMatcher(const std::string& p_imPattern);
+
+    std::string name() const override;
+
+    void init(int dA, int dB) override;
+
+    void init(const geom::Envelope& envA, const geom::Envelope& envB) override;
+
+    bool requireInteraction() const override;
+
+    bool requireCovers(bool isSourceA) const override;
+
+    bool requireExteriorCheck(bool isSourceA) const override;
+
+};
+
+} // namespace geos.operation.relateng
+} // namespace geos.operation
+} // namespace geos
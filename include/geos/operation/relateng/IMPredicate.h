@@ -0,0 +1,100 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+#include <geos/geom/IntersectionMatrix.h>
+#include <geos/operation/relateng/BasicPredicate.h>
+
+namespace geos {      // geos.
+namespace operation { // geos.operation
+namespace relateng {  // geos.operation.relateng
+
+/**
+ * A base class for predicates which are
+ * determined using entries in a {@link geom::IntersectionMatrix}.
+ *
+ * Matrix entries only ever increase in dimension as topology is computed,
+ * so subclasses can often determine the predicate value
+ * before the matrix is fully computed.
+ */
+class GEOS_DLL IMPredicate : public BasicPredicate {
+
+protected:
+
+    int dimA = 0;
+    int dimB = 0;
+    geom::IntersectionMatrix intMatrix;
+
+    /**
+     * Tests whether predicate evaluation can be short-circuited
+     * due to the current state of the matrix providing
+     * enough information to determine the predicate value.
+     *
+     * If this value is true then valueIM()
+     * must provide the correct result of the predicate.
+     *
+     * @return true if the predicate value is determined
+     */
+    virtual bool isDetermined() const = 0;
+
+    /**
+     * Gets the value of the predicate according to the current
+     * intersection matrix state.
+     *
+     * @return the current predicate value
+     */
+    virtual bool valueIM() const = 0;
+
+    /**
+     * Tests whether the exterior of the specified input geometry
+     * is intersected by any part of the other input.
+     *
+     * @param isA the input geometry
+     * @return true if the input geometry exterior is intersected
+     */
+    bool intersectsExteriorOf(bool isA) const;
+
+    bool isIntersects(geom::Location locA, geom::Location locB) const;
+
+    bool isDimension(geom::Location locA, geom::Location locB, int dimension) const
+    {
+        return intMatrix.get(locA, locB) == dimension;
+    }
+
+    int getDimension(geom::Location locA, geom::Location locB) const
+    {
+        return intMatrix.get(locA, locB);
+    }
+
+public:
+
+    IMPredicate();
+
+    static bool isDimsCompatibleWithCovers(int dim0, int dim1);
+
+    using TopologyPredicate::init;
+
+    void init(int dA, int dB) override;
+
+    void updateDimension(geom::Location locA, geom::Location locB, int dimension) override;
+
+    bool isDimChanged(geom::Location locA, geom::Location locB, int dimension) const;
+
+    void finish() override;
+
+};
+
+} // namespace geos.operation.relateng
+} // namespace geos.operation
+} // namespace geos
@@ -0,0 +1,72 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+#include <geos/geom/Coordinate.h>
+
+#include <unordered_map>
+#include <vector>
+
+// Forward declarations
+namespace geos {
+namespace algorithm {
+class BoundaryNodeRule;
+}
+namespace geom {
+class LineString;
+}
+}
+
+namespace geos {      // geos.
+namespace operation { // geos.operation
+namespace relateng {  // geos.operation.relateng
+
+/**
+ * Determines the boundary points of a linear geometry,
+ * using a {@link algorithm::BoundaryNodeRule}.
+ */
+class GEOS_DLL LinearBoundary {
+
+private:
+
+    using VertexDegreeMap = std::unordered_map<geom::CoordinateXY, int, geom::CoordinateXY::HashCode>;
+
+    VertexDegreeMap vertexDegree;
+    bool m_hasBoundary;
+    const algorithm::BoundaryNodeRule& boundaryNodeRule;
+
+    bool checkBoundary() const;
+
+    static void computeBoundaryPoints(const std::vector<const geom::LineString*>& lines,
+                                      VertexDegreeMap& degree);
+
+    static void addEndpoint(const geom::CoordinateXY& p, VertexDegreeMap& degree);
+
+public:
+
+    LinearBoundary(const std::vector<const geom::LineString*>& lines,
+                   const algorithm::BoundaryNodeRule& bnRule);
+
+    bool hasBoundary() const
+    {
+        return m_hasBoundary;
+    }
+
+    bool isBoundary(const geom::CoordinateXY& pt) const;
+
+};
+
+} // namespace geos.operation.relateng
+} // namespace geos.operation
+} // namespace geos
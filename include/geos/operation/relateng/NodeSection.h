@@ -0,0 +1,187 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+#include <geos/geom/Coordinate.h>
+
+#include <string>
+
+// Forward declarations
+namespace geos {
+namespace geom {
+class Geometry;
+}
+}
+
+namespace geos {      // geos.
+namespace operation { // geos.operation
+namespace relateng {  // geos.operation.relateng
+
+/**
+ * Represents a computed node along with the incident edges on either side of
+ * it (if they exist).
+ * This captures the information about a node in a geometry component
+ * required to determine the component's contribution to the node topology.
+ * A node in an area geometry always has edges on both sides of the node.
+ * A node in a linear geometry may have one or other incident edge missing, if
+ * the node occurs at an endpoint of the line.
+ * The edges of an area node are assumed to be provided
+ * with CW-shell orientation (as per JTS norm).
+ * This must be enforced by the caller.
+ *
+ * The vertex pointers refer to the coordinates of
+ * the segment strings the section was created from,
+ * which must outlive the section.
+ */
+class GEOS_DLL NodeSection {
+
+private:
+
+    bool m_isA;
+    int m_dim;
+    int m_id;
+    int m_ringId;
+    const geom::Geometry* m_poly;
+    bool m_isNodeAtVertex;
+    const geom::CoordinateXY* m_v0;
+    geom::CoordinateXY m_nodePt;
+    const geom::CoordinateXY* m_v1;
+
+    static int compareWithNull(const geom::CoordinateXY* v0, const geom::CoordinateXY* v1);
+
+    static int compare(int a, int b)
+    {
+        if (a < b) return -1;
+        if (a > b) return 1;
+        return 0;
+    }
+
+public:
+
+    NodeSection(
+        bool isA,
+        int dimension,
+        int id,
+        int ringId,
+        const geom::Geometry* poly,
+        bool isNodeAtVertex,
+        const geom::CoordinateXY* v0,
+        const geom::CoordinateXY& nodePt,
+        const geom::CoordinateXY* v1)
+        : m_isA(isA)
+        , m_dim(dimension)
+        , m_id(id)
+        , m_ringId(ringId)
+        , m_poly(poly)
+        , m_isNodeAtVertex(isNodeAtVertex)
+        , m_v0(v0)
+        , m_nodePt(nodePt)
+        , m_v1(v1)
+    {}
+
+    /**
+     * Compares sections by the angle the entering edge makes with the positive X axis.
+     */
+    struct EdgeAngleComparator {
+        bool operator()(const NodeSection& ns1, const NodeSection& ns2) const;
+    };
+
+    static bool isAreaArea(const NodeSection& a, const NodeSection& b);
+
+    static bool isProper(const NodeSection& a, const NodeSection& b);
+
+    const geom::CoordinateXY* getVertex(int i) const
+    {
+        return i == 0 ? m_v0 : m_v1;
+    }
+
+    const geom::CoordinateXY& nodePt() const
+    {
+        return m_nodePt;
+    }
+
+    int dimension() const
+    {
+        return m_dim;
+    }
+
+    int id() const
+    {
+        return m_id;
+    }
+
+    int ringId() const
+    {
+        return m_ringId;
+    }
+
+    /**
+     * Gets the polygon this section is part of.
+     * Will be null if section is not on a polygon boundary.
+     *
+     * @return the associated polygon, or null
+     */
+    const geom::Geometry* getPolygonal() const
+    {
+        return m_poly;
+    }
+
+    bool isShell() const
+    {
+        return m_ringId == 0;
+    }
+
+    bool isArea() const;
+
+    bool isA() const
+    {
+        return m_isA;
+    }
+
+    bool isSameGeometry(const NodeSection& ns) const
+    {
+        return isA() == ns.isA();
+    }
+
+    bool isSamePolygon(const NodeSection& ns) const
+    {
+        return isA() == ns.isA() && id() == ns.id();
+    }
+
+    bool isNodeAtVertex() const
+    {
+        return m_isNodeAtVertex;
+    }
+
+    bool isProper() const
+    {
+        return ! m_isNodeAtVertex;
+    }
+
+    /**
+     * Compares sections by geometry, dimension,
+     * element and ring id, and finally by the edge vertices.
+     *
+     * @param o the section to compare to
+     * @return a negative, zero or positive value
+     */
+    int compareTo(const NodeSection& o) const;
+
+    std::string toString() const;
+
+};
+
+} // namespace geos.operation.relateng
+} // namespace geos.operation
+} // namespace geos
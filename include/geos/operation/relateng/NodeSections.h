@@ -0,0 +1,90 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/operation/relateng/NodeSection.h>
+
+#include <memory>
+#include <vector>
+
+// Forward declarations
+namespace geos {
+namespace geom {
+class Geometry;
+}
+}
+
+namespace geos {      // geos.
+namespace operation { // geos.operation
+namespace relateng {  // geos.operation.relateng
+
+class RelateNode;
+
+/**
+ * The sections of the edges of both input geometries
+ * which are incident on a single node.
+ */
+class GEOS_DLL NodeSections {
+
+private:
+
+    geom::CoordinateXY nodePt;
+    std::vector<NodeSection> sections;
+
+    /**
+     * Sorts the sections so that:
+     *  - lines are before areas
+     *  - edges from the same polygon are contiguous
+     */
+    void prepareSections();
+
+    static bool hasMultiplePolygonSections(const std::vector<NodeSection>& secs, std::size_t i);
+
+    static std::vector<NodeSection> collectPolygonSections(const std::vector<NodeSection>& secs, std::size_t i);
+
+public:
+
+    explicit NodeSections(const geom::CoordinateXY& pt)
+        : nodePt(pt)
+    {}
+
+    const geom::CoordinateXY& getCoordinate() const
+    {
+        return nodePt;
+    }
+
+    void addNodeSection(const NodeSection& e)
+    {
+        sections.push_back(e);
+    }
+
+    bool hasInteractionAB() const;
+
+    const geom::Geometry* getPolygonal(bool isA) const;
+
+    /**
+     * Creates the topological node from the sections,
+     * converting the sections of polygons with multiple
+     * rings incident on the node to a maximal-ring structure.
+     *
+     * @return the node with its incident edges
+     */
+    std::unique_ptr<RelateNode> createNode();
+
+};
+
+} // namespace geos.operation.relateng
+} // namespace geos.operation
+} // namespace geos
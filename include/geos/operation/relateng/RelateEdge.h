@@ -0,0 +1,140 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/Location.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace geos {      // geos.
+namespace operation { // geos.operation
+namespace relateng {  // geos.operation.relateng
+
+class RelateNode;
+
+/**
+ * An edge incident on a {@link RelateNode},
+ * recording the dimension of the input geometries
+ * it is part of and the topological locations on its left and right sides
+ * and along the edge itself.
+ */
+class GEOS_DLL RelateEdge {
+
+private:
+
+    /**
+     * Indicates that the location is currently unknown
+     */
+    static constexpr geom::Location LOC_UNKNOWN = geom::Location::NONE;
+
+    const RelateNode* node;
+    const geom::CoordinateXY* dirPt;
+
+    int aDim = DIM_UNKNOWN;
+    geom::Location aLocLeft = LOC_UNKNOWN;
+    geom::Location aLocRight = LOC_UNKNOWN;
+    geom::Location aLocLine = LOC_UNKNOWN;
+
+    int bDim = DIM_UNKNOWN;
+    geom::Location bLocLeft = LOC_UNKNOWN;
+    geom::Location bLocRight = LOC_UNKNOWN;
+    geom::Location bLocLine = LOC_UNKNOWN;
+
+    void setLocationsLine(bool isA);
+
+    void setLocationsArea(bool isA, bool isForward);
+
+    /**
+     * Area edges override Line edges.
+     * Merging edges of same dimension is a no-op for
+     * the dimension and on location.
+     * But merging an area edge into a line edge
+     * sets the dimension to A and the location to BOUNDARY.
+     */
+    void mergeDimEdgeLoc(bool isA, geom::Location locEdge);
+
+    void mergeSideLocation(bool isA, int pos, geom::Location loc);
+
+    void setDimension(bool isA, int dimension);
+
+    void setLeft(bool isA, geom::Location loc);
+
+    void setRight(bool isA, geom::Location loc);
+
+    void setOn(bool isA, geom::Location loc);
+
+    int dimension(bool isA) const
+    {
+        return isA ? aDim : bDim;
+    }
+
+    bool isKnown(bool isA) const
+    {
+        if (isA)
+            return aDim != DIM_UNKNOWN;
+        return bDim != DIM_UNKNOWN;
+    }
+
+    bool isKnown(bool isA, int pos) const
+    {
+        return location(isA, pos) != LOC_UNKNOWN;
+    }
+
+public:
+
+    /**
+     * The dimension of an input geometry which is not known
+     */
+    static constexpr int DIM_UNKNOWN = -1;
+
+    RelateEdge(const RelateNode* p_node, const geom::CoordinateXY* pt, bool isA, bool isForward);
+
+    RelateEdge(const RelateNode* p_node, const geom::CoordinateXY* pt, bool isA);
+
+    static std::unique_ptr<RelateEdge> create(const RelateNode* node, const geom::CoordinateXY* dirPt,
+        bool isA, int dim, bool isForward);
+
+    static int findKnownEdgeIndex(const std::vector<std::unique_ptr<RelateEdge>>& edges, bool isA);
+
+    static void setAreaInterior(const std::vector<std::unique_ptr<RelateEdge>>& edges, bool isA);
+
+    int compareToEdge(const geom::CoordinateXY* edgeDirPt) const;
+
+    void merge(bool isA, int dim, bool isForward);
+
+    void setLocation(bool isA, int pos, geom::Location loc);
+
+    void setAllLocations(bool isA, geom::Location loc);
+
+    void setUnknownLocations(bool isA, geom::Location loc);
+
+    geom::Location location(bool isA, int position) const;
+
+    bool isInterior(bool isA, int position) const
+    {
+        return location(isA, position) == geom::Location::INTERIOR;
+    }
+
+    void setAreaInterior(bool isA);
+
+    std::string toString() const;
+
+};
+
+} // namespace geos.operation.relateng
+} // namespace geos.operation
+} // namespace geos
@@ -0,0 +1,251 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/Dimension.h>
+#include <geos/geom/Envelope.h>
+#include <geos/geom/Location.h>
+
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+// Forward declarations
+namespace geos {
+namespace algorithm {
+class BoundaryNodeRule;
+}
+namespace geom {
+class Geometry;
+class LinearRing;
+class LineString;
+class Point;
+}
+}
+
+namespace geos {      // geos.
+namespace operation { // geos.operation
+namespace relateng {  // geos.operation.relateng
+
+class RelatePointLocator;
+class RelateSegmentString;
+
+/**
+ * An input geometry to {@link RelateNG}, along with
+ * the cached metadata and (lazily-created) point locator
+ * used to evaluate its topology.
+ */
+class GEOS_DLL RelateGeometry {
+
+private:
+
+    const geom::Geometry& geom;
+    bool m_isPrepared;
+    geom::Envelope geomEnv;
+    const algorithm::BoundaryNodeRule& boundaryNodeRule;
+    int geomDim = geom::Dimension::False;
+    bool isLineZeroLen = false;
+    bool isGeomEmpty = false;
+    std::unique_ptr<std::unordered_set<geom::CoordinateXY, geom::CoordinateXY::HashCode>> uniquePoints;
+    std::unique_ptr<RelatePointLocator> locator;
+    int elementId = 0;
+    bool hasPoints = false;
+    bool hasLines = false;
+    bool hasAreas = false;
+
+    void analyzeDimensions();
+
+    void analyzeElementDimensions(const geom::Geometry& g);
+
+    bool isZeroLengthLine(const geom::Geometry& g) const;
+
+    /**
+     * Tests if all geometry linear elements are zero-length.
+     * For efficiency the test avoids computing actual length.
+     */
+    static bool isZeroLength(const geom::Geometry& g);
+
+    static bool isZeroLength(const geom::LineString* line);
+
+    RelatePointLocator* getLocator();
+
+    void createUniquePoints();
+
+    void extractSegmentStrings(bool isA, const geom::Envelope* env, const geom::Geometry& g,
+                               std::vector<std::unique_ptr<RelateSegmentString>>& segStrings);
+
+    void extractSegmentStringsFromAtomic(bool isA, const geom::Geometry& g,
+                                         const geom::Geometry* parentPolygonal,
+                                         const geom::Envelope* env,
+                                         std::vector<std::unique_ptr<RelateSegmentString>>& segStrings);
+
+    void extractRingToSegmentString(bool isA, const geom::LinearRing* ring, int ringId,
+                                    const geom::Envelope* env, const geom::Geometry* parentPoly,
+                                    std::vector<std::unique_ptr<RelateSegmentString>>& segStrings);
+
+public:
+
+    static constexpr bool GEOM_A = true;
+    static constexpr bool GEOM_B = false;
+
+    static std::string name(bool isA)
+    {
+        return isA ? "A" : "B";
+    }
+
+    RelateGeometry(const geom::Geometry& input, bool isPrepared,
+                   const algorithm::BoundaryNodeRule& bnRule);
+
+    RelateGeometry(const geom::Geometry& input,
+                   const algorithm::BoundaryNodeRule& bnRule);
+
+    explicit RelateGeometry(const geom::Geometry& input);
+
+    ~RelateGeometry();
+
+    /**
+     * Orients the coordinates of a ring and removes repeated points.
+     *
+     * @param seq the ring coordinates
+     * @param orientCW true if the ring should be oriented clockwise
+     * @return the oriented coordinates
+     */
+    static std::unique_ptr<geom::CoordinateSequence> orientAndRemoveRepeated(
+        const geom::CoordinateSequence* seq, bool orientCW);
+
+    static std::unique_ptr<geom::CoordinateSequence> removeRepeated(
+        const geom::CoordinateSequence* seq);
+
+    const geom::Geometry& getGeometry() const
+    {
+        return geom;
+    }
+
+    bool isPrepared() const
+    {
+        return m_isPrepared;
+    }
+
+    const geom::Envelope& getEnvelope() const
+    {
+        return geomEnv;
+    }
+
+    int getDimension() const
+    {
+        return geomDim;
+    }
+
+    bool hasDimension(int dim) const;
+
+    bool hasAreaAndLine() const
+    {
+        return hasAreas && hasLines;
+    }
+
+    /**
+     * Gets the actual non-empty dimension of the geometry.
+     * Zero-length LineStrings are treated as Points.
+     *
+     * @return the real (non-empty) dimension
+     */
+    int getDimensionReal() const;
+
+    bool hasEdges() const
+    {
+        return hasLines || hasAreas;
+    }
+
+    bool isNodeInArea(const geom::CoordinateXY& nodePt, const geom::Geometry* parentPolygonal);
+
+    int locateLineEndWithDim(const geom::CoordinateXY& p);
+
+    /**
+     * Locates a vertex of a polygon.
+     * A vertex of a Polygon or MultiPolygon is on the Boundary.
+     * But a vertex of an overlapped polygon in a GeometryCollection
+     * may be in the Interior.
+     *
+     * @param pt the polygon vertex
+     * @return the location of the vertex
+     */
+    geom::Location locateAreaVertex(const geom::CoordinateXY& pt);
+
+    geom::Location locateNode(const geom::CoordinateXY& pt, const geom::Geometry* parentPolygonal);
+
+    int locateWithDim(const geom::CoordinateXY& pt);
+
+    /**
+     * Indicates whether the geometry requires self-noding
+     * for correct evaluation of specific spatial predicates.
+     * Self-noding is required for geometries which may self-cross
+     * - i.e. lines, and overlapping elements in GeometryCollections.
+     * Self-noding is not required for polygonal geometries,
+     * since they can only touch at vertices.
+     * This ensures that the locations of nodes created by
+     * crossing segments are computed explicitly.
+     * This ensures that node locations match in situations
+     * where a self-crossing and mutual crossing occur at the same logical location.
+     * E.g. a self-crossing line tested against a single segment
+     * identical to one of the crossed segments.
+     *
+     * @return true if self-noding is required
+     */
+    bool isSelfNodingRequired() const;
+
+    /**
+     * Tests whether the geometry has polygonal topology.
+     * This is not the case if it is a GeometryCollection
+     * containing more than one polygon (since they may overlap
+     * or be adjacent).
+     * The significance is that polygonal topology allows more assumptions
+     * about the location of boundary vertices.
+     *
+     * @return true if the geometry has polygonal topology
+     */
+    bool isPolygonal() const;
+
+    bool isEmpty() const
+    {
+        return isGeomEmpty;
+    }
+
+    bool hasBoundary();
+
+    const std::unordered_set<geom::CoordinateXY, geom::CoordinateXY::HashCode>& getUniquePoints();
+
+    std::vector<const geom::Point*> getEffectivePoints();
+
+    /**
+     * Extract RelateSegmentStrings from the geometry which
+     * intersect a given envelope.
+     * If the envelope is null all edges are extracted.
+     *
+     * @param isA true if the geometry is A
+     * @param env the envelope to extract around (may be null)
+     * @param segStrings the list to add the extracted segment strings to
+     */
+    void extractSegmentStrings(bool isA, const geom::Envelope* env,
+                               std::vector<std::unique_ptr<RelateSegmentString>>& segStrings);
+
+    std::string toString() const;
+
+};
+
+} // namespace geos.operation.relateng
+} // namespace geos.operation
+} // namespace geos
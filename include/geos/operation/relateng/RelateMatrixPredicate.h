@@ -0,0 +1,74 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+#include <geos/geom/IntersectionMatrix.h>
+#include <geos/operation/relateng/IMPredicate.h>
+
+#include <memory>
+#include <string>
+
+namespace geos {      // geos.
+namespace operation { // geos.operation
+namespace relateng {  // geos.operation.relateng
+
+/**
+ * Evaluates the full relate {@link geom::IntersectionMatrix}.
+ * The predicate is never determined early, so that
+ * every matrix entry is computed.
+ */
+class GEOS_DLL RelateMatrixPredicate : public IMPredicate {
+
+protected:
+
+    bool isDetermined() const override
+    {
+        //-- ensure entire matrix is computed
+        return false;
+    }
+
+    bool valueIM() const override
+    {
+        //-- indicates full matrix is being evaluated
+        return false;
+    }
+
+public:
+
+    std::string name() const override
+    {
+        return "relateMatrix";
+    }
+
+    bool requireInteraction() const override
+    {
+        //-- ensure entire matrix is computed
+        return false;
+    }
+
+    /**
+     * Gets the current state of the IM matrix (which may only be partially complete).
+     *
+     * @return the IM matrix
+     */
+    std::unique_ptr<geom::IntersectionMatrix> getIM() const
+    {
+        return std::unique_ptr<geom::IntersectionMatrix>(new geom::IntersectionMatrix(intMatrix));
+    }
+
+};
+
+} // namespace geos.operation.relateng
+} // namespace geos.operation
+} // namespace geos
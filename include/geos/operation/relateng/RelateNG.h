@@ -0,0 +1,274 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+#include <geos/noding/SegmentString.h>
+#include <geos/operation/relateng/RelateGeometry.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+// Forward declarations
+namespace geos {
+namespace algorithm {
+class BoundaryNodeRule;
+}
+namespace geom {
+class Envelope;
+class Geometry;
+class IntersectionMatrix;
+class LinearRing;
+}
+namespace noding {
+class MCIndexSegmentSetMutualIntersector;
+}
+}
+
+namespace geos {      // geos.
+namespace operation { // geos.operation
+namespace relateng {  // geos.operation.relateng
+
+class EdgeSegmentIntersector;
+class RelateSegmentString;
+class TopologyComputer;
+class TopologyPredicate;
+
+/**
+ * Computes the value of topological predicates between two geometries
+ * based on the Dimensionally-Extended 9-Intersection Model (DE-9IM).
+ * Standard and custom topological predicates are provided by
+ * {@link RelatePredicate}.
+ *
+ * The RelateNG algorithm has the following capabilities:
+ *
+ *  - Efficient short-circuited evaluation of topological predicates
+ *    (including matching custom DE-9IM matrix patterns)
+ *  - Optimized repeated evaluation of predicates against a single geometry
+ *    via cached spatial indexes (AKA "prepared mode")
+ *  - Robust computation (only point-local topology is required,
+ *    so invalid geometry topology does not cause failures)
+ *  - GeometryCollection inputs containing mixed types and overlapping polygons
+ *    are supported, using union semantics.
+ *  - Zero-length LineStrings are treated as being topologically identical to Points.
+ *  - Support for BoundaryNodeRules.
+ *
+ * Topology is determined incrementally: point locations are computed first,
+ * then intersections between the (monotone-chain indexed) edges of both inputs.
+ * Evaluation stops as soon as the predicate value is known,
+ * so for many predicates and inputs only part of the topology is computed.
+ *
+ * A RelateNG instance created by {@link prepare()} caches the
+ * edge index and point locators of the first input,
+ * which are re-used for each evaluation.
+ * A prepared instance is not thread-safe.
+ *
+ * The geometries passed to RelateNG must remain alive
+ * for the lifetime of the instance.
+ */
+class GEOS_DLL RelateNG {
+
+private:
+
+    const algorithm::BoundaryNodeRule& boundaryNodeRule;
+    RelateGeometry geomA;
+    std::vector<std::unique_ptr<RelateSegmentString>> edgesMutualA;
+    std::unique_ptr<noding::MCIndexSegmentSetMutualIntersector> edgeMutualInt;
+
+    RelateNG(const geom::Geometry* inputA, bool isPrepared,
+             const algorithm::BoundaryNodeRule& bnRule);
+
+    RelateNG(const geom::Geometry* inputA, bool isPrepared);
+
+    bool hasRequiredEnvelopeInteraction(const geom::Geometry* b, TopologyPredicate& predicate);
+
+    bool finishValue(TopologyPredicate& predicate);
+
+    void computePP(RelateGeometry& geomB, TopologyComputer& topoComputer);
+
+    void computeAtPoints(RelateGeometry& geom, bool isA,
+                         RelateGeometry& geomTarget, TopologyComputer& topoComputer);
+
+    bool computePoints(RelateGeometry& geom, bool isA,
+                       RelateGeometry& geomTarget, TopologyComputer& topoComputer);
+
+    void computePoint(bool isA, const geom::CoordinateXY& pt,
+                      RelateGeometry& geomTarget, TopologyComputer& topoComputer);
+
+    bool computeLineEnds(RelateGeometry& geom, bool isA,
+                         RelateGeometry& geomTarget, TopologyComputer& topoComputer);
+
+    /**
+     * Compute the topology of a line endpoint.
+     *
+     * @return true if the line endpoint is in the exterior of the target
+     */
+    bool computeLineEnd(RelateGeometry& geom, bool isA, const geom::CoordinateXY& pt,
+                        RelateGeometry& geomTarget, TopologyComputer& topoComputer);
+
+    bool computeAreaVertex(RelateGeometry& geom, bool isA,
+                           RelateGeometry& geomTarget, TopologyComputer& topoComputer);
+
+    bool computeAreaVertex(RelateGeometry& geom, bool isA, const geom::LinearRing* ring,
+                           RelateGeometry& geomTarget, TopologyComputer& topoComputer);
+
+    void computeAtEdges(RelateGeometry& geomB, TopologyComputer& topoComputer);
+
+    void computeEdgesAll(std::vector<std::unique_ptr<RelateSegmentString>>& edgesA,
+                         std::vector<std::unique_ptr<RelateSegmentString>>& edgesB,
+                         const geom::Envelope* envInt,
+                         EdgeSegmentIntersector& intersector);
+
+    void computeEdgesMutual(std::vector<std::unique_ptr<RelateSegmentString>>& edgesB,
+                            const geom::Envelope* envInt,
+                            EdgeSegmentIntersector& intersector);
+
+public:
+
+    ~RelateNG();
+
+    RelateNG(const RelateNG&) = delete;
+    RelateNG& operator=(const RelateNG&) = delete;
+
+    /**
+     * Tests whether the topological relationship between two geometries
+     * satisfies a topological predicate.
+     *
+     * @param a the A input geometry
+     * @param b the B input geometry
+     * @param pred the topological predicate
+     * @return true if the topological relationship is satisfied
+     */
+    static bool relate(const geom::Geometry* a, const geom::Geometry* b,
+                       TopologyPredicate& pred);
+
+    /**
+     * Tests whether the topological relationship between two geometries
+     * satisfies a topological predicate,
+     * using a given BoundaryNodeRule.
+     *
+     * @param a the A input geometry
+     * @param b the B input geometry
+     * @param pred the topological predicate
+     * @param bnRule the Boundary Node Rule to use
+     * @return true if the topological relationship is satisfied
+     */
+    static bool relate(const geom::Geometry* a, const geom::Geometry* b,
+                       TopologyPredicate& pred,
+                       const algorithm::BoundaryNodeRule& bnRule);
+
+    /**
+     * Tests whether the topological relationship to a geometry
+     * matches a DE-9IM matrix pattern.
+     *
+     * @param a the A input geometry
+     * @param b the B input geometry
+     * @param imPattern the DE-9IM pattern to match
+     * @return true if the geometries relationship matches the DE-9IM pattern
+     *
+     * @see geom::IntersectionMatrix::matches
+     */
+    static bool relate(const geom::Geometry* a, const geom::Geometry* b,
+                       const std::string& imPattern);
+
+    /**
+     * Computes the DE-9IM matrix
+     * for the topological relationship between two geometries.
+     *
+     * @param a the A input geometry
+     * @param b the B input geometry
+     * @return the DE-9IM matrix for the topological relationship
+     */
+    static std::unique_ptr<geom::IntersectionMatrix> relate(
+        const geom::Geometry* a, const geom::Geometry* b);
+
+    /**
+     * Computes the DE-9IM matrix
+     * for the topological relationship between two geometries,
+     * using a given BoundaryNodeRule.
+     *
+     * @param a the A input geometry
+     * @param b the B input geometry
+     * @param bnRule the Boundary Node Rule to use
+     * @return the DE-9IM matrix for the relationship
+     */
+    static std::unique_ptr<geom::IntersectionMatrix> relate(
+        const geom::Geometry* a, const geom::Geometry* b,
+        const algorithm::BoundaryNodeRule& bnRule);
+
+    /**
+     * Creates a prepared RelateNG instance to optimize the
+     * evaluation of relationships against a single geometry.
+     *
+     * @param a the A input geometry
+     * @return a prepared instance
+     */
+    static std::unique_ptr<RelateNG> prepare(const geom::Geometry* a);
+
+    /**
+     * Creates a prepared RelateNG instance to optimize the
+     * computation of predicates against a single geometry,
+     * using a given BoundaryNodeRule.
+     *
+     * @param a the A input geometry
+     * @param bnRule the required BoundaryNodeRule
+     * @return a prepared instance
+     */
+    static std::unique_ptr<RelateNG> prepare(const geom::Geometry* a,
+                                             const algorithm::BoundaryNodeRule& bnRule);
+
+    /**
+     * Computes the DE-9IM matrix for the topological relationship to a geometry.
+     *
+     * @param b the B geometry to test against
+     * @return the DE-9IM matrix
+     */
+    std::unique_ptr<geom::IntersectionMatrix> evaluate(const geom::Geometry* b);
+
+    /**
+     * Tests whether the topological relationship to a geometry
+     * matches a DE-9IM matrix pattern.
+     *
+     * @param b the B geometry to test against
+     * @param imPattern the DE-9IM pattern to match
+     * @return true if the geometries' topological relationship matches the DE-9IM pattern
+     */
+    bool evaluate(const geom::Geometry* b, const std::string& imPattern);
+
+    /**
+     * Tests whether the topological relationship to a geometry
+     * satisfies a topology predicate.
+     *
+     * @param b the B geometry to test against
+     * @param predicate the topological predicate
+     * @return true if the predicate is satisfied
+     */
+    bool evaluate(const geom::Geometry* b, TopologyPredicate& predicate);
+
+    bool intersects(const geom::Geometry* b);
+    bool crosses(const geom::Geometry* b);
+    bool disjoint(const geom::Geometry* b);
+    bool touches(const geom::Geometry* b);
+    bool within(const geom::Geometry* b);
+    bool contains(const geom::Geometry* b);
+    bool overlaps(const geom::Geometry* b);
+    bool covers(const geom::Geometry* b);
+    bool coveredBy(const geom::Geometry* b);
+    bool equalsTopo(const geom::Geometry* b);
+
+};
+
+} // namespace geos.operation.relateng
+} // namespace geos.operation
+} // namespace geos
@@ -0,0 +1,116 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/operation/relateng/NodeSection.h>
+#include <geos/operation/relateng/RelateEdge.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace geos {      // geos.
+namespace operation { // geos.operation
+namespace relateng {  // geos.operation.relateng
+
+/**
+ * A node in the topology graph of the two input geometries,
+ * together with the edges incident on it.
+ * The edge locations are propagated around the node
+ * to determine the full topology of the node neighbourhood.
+ */
+class GEOS_DLL RelateNode {
+
+private:
+
+    geom::CoordinateXY nodePt;
+
+    /**
+     * A list of the edges around the node in CCW order,
+     * ordered by their CCW angle with the positive X-axis.
+     */
+    std::vector<std::unique_ptr<RelateEdge>> edges;
+
+    void updateEdgesInArea(bool isA, std::size_t indexFrom, std::size_t indexTo);
+
+    void updateIfAreaPrev(bool isA, std::size_t index);
+
+    void updateIfAreaNext(bool isA, std::size_t index);
+
+    std::size_t indexOf(const RelateEdge* e) const;
+
+    RelateEdge* addLineEdge(bool isA, const geom::CoordinateXY* dirPt);
+
+    RelateEdge* addAreaEdge(bool isA, const geom::CoordinateXY* dirPt, bool isForward);
+
+    /**
+     * Adds or merges an edge to the node.
+     *
+     * @param isA the input geometry the edge is part of
+     * @param dirPt the point giving the edge direction
+     * @param dim the dimension of the edge
+     * @param isForward the direction of the edge
+     * @return the added or merged edge, or null if the edge is degenerate
+     */
+    RelateEdge* addEdge(bool isA, const geom::CoordinateXY* dirPt, int dim, bool isForward);
+
+    void finishNode(bool isA, bool isAreaInterior);
+
+    void propagateSideLocations(bool isA, std::size_t startIndex);
+
+    std::size_t prevIndex(std::size_t index) const;
+
+    std::size_t nextIndex(std::size_t index) const;
+
+public:
+
+    explicit RelateNode(const geom::CoordinateXY& pt)
+        : nodePt(pt)
+    {}
+
+    const geom::CoordinateXY& getCoordinate() const
+    {
+        return nodePt;
+    }
+
+    const std::vector<std::unique_ptr<RelateEdge>>& getEdges() const
+    {
+        return edges;
+    }
+
+    void addEdges(const std::vector<NodeSection>& nss);
+
+    void addEdges(const NodeSection& ns);
+
+    /**
+     * Computes the final topology for the edges around this node.
+     * Although nodes lie on the boundary of areas or the interior of lines,
+     * in a mixed GC they may also lie in the interior of an area.
+     * This changes the locations of the sides and line to Interior.
+     *
+     * @param isAreaInteriorA true if the node is in the interior of A
+     * @param isAreaInteriorB true if the node is in the interior of B
+     */
+    void finish(bool isAreaInteriorA, bool isAreaInteriorB);
+
+    bool hasExteriorEdge(bool isA) const;
+
+    std::string toString() const;
+
+};
+
+} // namespace geos.operation.relateng
+} // namespace geos.operation
+} // namespace geos
@@ -0,0 +1,168 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/Location.h>
+
+#include <memory>
+#include <unordered_set>
+#include <vector>
+
+// Forward declarations
+namespace geos {
+namespace algorithm {
+class BoundaryNodeRule;
+namespace locate {
+class PointOnGeometryLocator;
+}
+}
+namespace geom {
+class Geometry;
+class LineString;
+class Point;
+}
+}
+
+namespace geos {      // geos.
+namespace operation { // geos.operation
+namespace relateng {  // geos.operation.relateng
+
+class AdjacentEdgeLocator;
+class LinearBoundary;
+
+/**
+ * Locates a point on a geometry, including mixed-type collections.
+ * The dimension of the containing geometry element is also determined.
+ * GeometryCollections are handled with union semantics;
+ * i.e. the location of a point is that location of that point
+ * on the union of the elements of the collection.
+ *
+ * Union semantics for GeometryCollections has the following behaviours:
+ *
+ *  - For a mixed-dimension (heterogeneous) collection
+ *    a point may lie on two geometry elements with different dimensions.
+ *    In this case the location on the largest-dimension element is reported.
+ *  - For a collection with overlapping or adjacent polygons,
+ *    points on polygon element boundaries may lie in the effective interior
+ *    of the collection geometry.
+ *
+ * Prepared mode is supported via cached spatial indexes.
+ */
+class GEOS_DLL RelatePointLocator {
+
+private:
+
+    const geom::Geometry& geom;
+    bool isPrepared;
+    const algorithm::BoundaryNodeRule& boundaryRule;
+    std::unique_ptr<AdjacentEdgeLocator> adjEdgeLocator;
+    std::unordered_set<geom::CoordinateXY, geom::CoordinateXY::HashCode> points;
+    std::vector<const geom::LineString*> lines;
+    std::vector<const geom::Geometry*> polygons;
+    std::vector<std::unique_ptr<algorithm::locate::PointOnGeometryLocator>> polyLocator;
+    std::unique_ptr<LinearBoundary> lineBoundary;
+    bool isEmpty;
+
+    void init(const geom::Geometry& g);
+
+    void extractElements(const geom::Geometry& g);
+
+    void addPoint(const geom::Point* pt);
+
+    void addLine(const geom::LineString* line);
+
+    void addPolygonal(const geom::Geometry* polygonal);
+
+    int locateWithDim(const geom::CoordinateXY& p, bool isNode, const geom::Geometry* parentPolygonal);
+
+    int computeDimLocation(const geom::CoordinateXY& p, bool isNode, const geom::Geometry* parentPolygonal);
+
+    geom::Location locateOnPoints(const geom::CoordinateXY& p) const;
+
+    geom::Location locateOnLines(const geom::CoordinateXY& p, bool isNode);
+
+    geom::Location locateOnLine(const geom::CoordinateXY& p, const geom::LineString* l) const;
+
+    geom::Location locateOnPolygons(const geom::CoordinateXY& p, bool isNode, const geom::Geometry* parentPolygonal);
+
+    geom::Location locateOnPolygonal(const geom::CoordinateXY& p, bool isNode,
+                                     const geom::Geometry* parentPolygonal, std::size_t index);
+
+    algorithm::locate::PointOnGeometryLocator* getLocator(std::size_t index);
+
+public:
+
+    RelatePointLocator(const geom::Geometry& p_geom, bool p_isPrepared,
+                       const algorithm::BoundaryNodeRule& bnRule);
+
+    explicit RelatePointLocator(const geom::Geometry& p_geom);
+
+    ~RelatePointLocator();
+
+    bool hasBoundary() const;
+
+    geom::Location locate(const geom::CoordinateXY& p);
+
+    /**
+     * Locates a line endpoint, as a {@link DimensionLocation}.
+     * In a mixed-dim GC, the line end point may also lie in an area.
+     * In this case the area location is reported.
+     * Otherwise, the dimLoc is either LINE_BOUNDARY
+     * or LINE_INTERIOR, depending on the endpoint valence
+     * and the BoundaryNodeRule in place.
+     *
+     * @param p the line end point to locate
+     * @return the dimension and location of the line end point
+     */
+    int locateLineEndWithDim(const geom::CoordinateXY& p);
+
+    /**
+     * Locates a point which is known to be a node of the geometry
+     * (i.e. a vertex or on an edge).
+     *
+     * @param p the node point to locate
+     * @param parentPolygonal the polygon the point is a node of
+     * @return the location of the node point
+     */
+    geom::Location locateNode(const geom::CoordinateXY& p, const geom::Geometry* parentPolygonal);
+
+    /**
+     * Locates a point which is known to be a node of the geometry,
+     * as a {@link DimensionLocation}.
+     *
+     * @param p the point to locate
+     * @param parentPolygonal the polygon the point is a node of
+     * @return the dimension and location of the point
+     */
+    int locateNodeWithDim(const geom::CoordinateXY& p, const geom::Geometry* parentPolygonal);
+
+    /**
+     * Computes the topological location ({@link geom::Location}) of a single point
+     * in a Geometry, as well as the dimension of the geometry element the point
+     * is located in (if not in the Exterior).
+     * It handles both single-element and multi-element Geometries.
+     * The algorithm for multi-part Geometries
+     * takes into account the SFS Boundary Determination Rule.
+     *
+     * @param p the point to locate
+     * @return the DimensionLocation of the point
+     */
+    int locateWithDim(const geom::CoordinateXY& p);
+
+};
+
+} // namespace geos.operation.relateng
+} // namespace geos.operation
+} // namespace geos
@@ -0,0 +1,151 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/noding/BasicSegmentString.h>
+#include <geos/operation/relateng/NodeSection.h>
+
+#include <memory>
+
+// Forward declarations
+namespace geos {
+namespace geom {
+class Geometry;
+}
+}
+
+namespace geos {      // geos.
+namespace operation { // geos.operation
+namespace relateng {  // geos.operation.relateng
+
+/**
+ * Models a linear edge of a {@link RelateGeometry}.
+ * The segment string owns its (de-duplicated and
+ * canonically oriented) coordinates.
+ */
+class GEOS_DLL RelateSegmentString : public noding::BasicSegmentString {
+
+private:
+
+    std::unique_ptr<geom::CoordinateSequence> m_pts;
+    bool m_isA;
+    int m_dimension;
+    int m_id;
+    int m_ringId;
+    const geom::Geometry* m_parentPolygonal;
+
+    RelateSegmentString(
+        std::unique_ptr<geom::CoordinateSequence>&& pts,
+        bool isA,
+        int dimension,
+        int id,
+        int ringId,
+        const geom::Geometry* poly)
+        : noding::BasicSegmentString(pts.get(), nullptr)
+        , m_pts(std::move(pts))
+        , m_isA(isA)
+        , m_dimension(dimension)
+        , m_id(id)
+        , m_ringId(ringId)
+        , m_parentPolygonal(poly)
+    {}
+
+    /**
+     * Gets the previous vertex for a node on the given segment.
+     * If the node is at the start of the segment, the previous vertex
+     * is the previous segment start.
+     * If the node is at the start of a line, there is no previous vertex
+     * (null is returned).
+     */
+    const geom::CoordinateXY* prevVertex(std::size_t segIndex, const geom::CoordinateXY& pt) const;
+
+    /**
+     * Gets the next vertex for a node on the given segment,
+     * or null if the node is at the end of a line.
+     */
+    const geom::CoordinateXY* nextVertex(std::size_t segIndex, const geom::CoordinateXY& pt) const;
+
+public:
+
+    static std::unique_ptr<RelateSegmentString> createLine(
+        std::unique_ptr<geom::CoordinateSequence>&& pts,
+        bool isA, int elementId);
+
+    static std::unique_ptr<RelateSegmentString> createRing(
+        std::unique_ptr<geom::CoordinateSequence>&& pts,
+        bool isA, int elementId, int ringId,
+        const geom::Geometry* poly);
+
+    bool isA() const
+    {
+        return m_isA;
+    }
+
+    int getDimension() const
+    {
+        return m_dimension;
+    }
+
+    int getId() const
+    {
+        return m_id;
+    }
+
+    int getRingId() const
+    {
+        return m_ringId;
+    }
+
+    /**
+     * Gets the polygon or multipolygon this segment string is part of.
+     * Will be null if the segment string is not part of a polygon.
+     */
+    const geom::Geometry* getPolygonal() const
+    {
+        return m_parentPolygonal;
+    }
+
+    /**
+     * Creates a node section for a node at the given segment index
+     * and intersection point.
+     *
+     * @param segIndex the index of the segment containing the node
+     * @param intPt the node point
+     * @return the node section
+     */
+    NodeSection createNodeSection(std::size_t segIndex, const geom::CoordinateXY& intPt) const;
+
+    /**
+     * Tests if a segment intersection point has that segment as its
+     * canonical containing segment.
+     * Segments are half-closed, and contain their start point but not the endpoint,
+     * except for the final segment in a non-closed segment string, which contains
+     * its endpoint as well.
+     * This test ensures that vertices are assigned to a unique segment in a segment string.
+     * In particular, this avoids double-counting intersections which lie exactly
+     * at segment endpoints.
+     *
+     * @param segIndex the segment the point may lie on
+     * @param pt the point
+     * @return true if the segment is the canonical containing segment for the point
+     */
+    bool isContainingSegment(std::size_t segIndex, const geom::CoordinateXY& pt) const;
+
+};
+
+} // namespace geos.operation.relateng
+} // namespace geos.operation
+} // namespace geos
@@ -0,0 +1,190 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/Location.h>
+#include <geos/operation/relateng/NodeSection.h>
+
+#include <map>
+#include <memory>
+
+namespace geos {      // geos.
+namespace operation { // geos.operation
+namespace relateng {  // geos.operation.relateng
+
+class NodeSections;
+class RelateGeometry;
+class RelateNode;
+class TopologyPredicate;
+
+/**
+ * Computes the topological relationship of two
+ * {@link RelateGeometry}s incrementally, by accumulating
+ * the DE-9IM entries implied by point locations and
+ * edge intersections into a {@link TopologyPredicate}.
+ * Evaluation can stop as soon as the predicate value is known.
+ */
+class GEOS_DLL TopologyComputer {
+
+private:
+
+    TopologyPredicate& predicate;
+    RelateGeometry& geomA;
+    RelateGeometry& geomB;
+    std::map<geom::CoordinateXY, std::unique_ptr<NodeSections>> nodeMap;
+
+    /**
+     * Determine a priori partial EXTERIOR topology based on dimensions.
+     */
+    void initExteriorDims();
+
+    void initExteriorEmpty(bool geomNonEmpty);
+
+    RelateGeometry& getGeometry(bool isA) const
+    {
+        return isA ? geomA : geomB;
+    }
+
+    void updateDim(geom::Location locA, geom::Location locB, int dimension);
+
+    void updateDim(bool isAB, geom::Location loc1, geom::Location loc2, int dimension);
+
+    /**
+     * Update topology for an intersection between A and B.
+     */
+    void updateIntersectionAB(const NodeSection& a, const NodeSection& b);
+
+    /**
+     * Updates topology for an AB Area-Area crossing node.
+     * Sections cross at a node if (a) the intersection is proper
+     * (i.e. in the interior of two segments)
+     * or (b) if non-proper then whether the linework crosses
+     * is determined by the geometry of the segments on either side of the node.
+     * In these situations the area geometry interiors intersect (in dimension 2).
+     */
+    void updateAreaAreaCross(const NodeSection& a, const NodeSection& b);
+
+    /**
+     * Updates topology for a node at an AB edge intersection.
+     */
+    void updateNodeLocation(const NodeSection& a, const NodeSection& b);
+
+    void addNodeSections(const NodeSection& ns0, const NodeSection& ns1);
+
+    void addLineEndOnLine(bool isLineA, geom::Location locLine);
+
+    void addLineEndOnArea(bool isLineA, geom::Location locArea);
+
+    void addAreaVertexOnPoint(bool isAreaA, geom::Location locArea);
+
+    void addAreaVertexOnLine(bool isAreaA, geom::Location locArea, geom::Location locTarget);
+
+    void addAreaVertexOnArea(bool isAreaA, geom::Location locArea, geom::Location locTarget);
+
+    void evaluateNode(NodeSections& nodeSections);
+
+    void evaluateNodeEdges(const RelateNode& node);
+
+    NodeSections* getNodeSections(const geom::CoordinateXY& nodePt);
+
+public:
+
+    TopologyComputer(TopologyPredicate& p_predicate,
+                     RelateGeometry& p_geomA,
+                     RelateGeometry& p_geomB);
+
+    ~TopologyComputer();
+
+    TopologyComputer(const TopologyComputer&) = delete;
+    TopologyComputer& operator=(const TopologyComputer&) = delete;
+
+    int getDimension(bool isA) const;
+
+    bool isAreaArea() const;
+
+    /**
+     * Indicates whether the input geometries require self-noding
+     * for correct evaluation of specific spatial predicates.
+     * Self-noding is required for geometries which may
+     * have self-crossing linework.
+     * This causes the coordinates of nodes created by
+     * crossing segments to be computed explicitly.
+     * This ensures that node locations match in situations
+     * where a self-crossing and mutual crossing occur at the same logical location.
+     * The canonical example is a self-crossing line tested against a single segment
+     * identical to one of the crossed segments.
+     *
+     * @return true if self-noding is required
+     */
+    bool isSelfNodingRequired() const;
+
+    bool isExteriorCheckRequired(bool isA) const;
+
+    bool isResultKnown() const;
+
+    bool getResult() const;
+
+    /**
+     * Finalize the evaluation.
+     */
+    void finish();
+
+    void addIntersection(const NodeSection& a, const NodeSection& b);
+
+    void addPointOnPointInterior();
+
+    void addPointOnPointExterior(bool isGeomA);
+
+    void addPointOnGeometry(bool isA, geom::Location locTarget, int dimTarget);
+
+    /**
+     * Add topology for a line end.
+     * The line end point must be "significant";
+     * i.e. not contained in an area if the source is a mixed-dimension GC.
+     *
+     * @param isLineA the input containing the line end
+     * @param locLineEnd the location of the line end (Interior or Boundary)
+     * @param locTarget the location on the target geometry
+     * @param dimTarget the dimension of the interacting target geometry element,
+     *    (if any), or the dimension of the target
+     */
+    void addLineEndOnGeometry(bool isLineA, geom::Location locLineEnd,
+                              geom::Location locTarget, int dimTarget);
+
+    /**
+     * Adds topology for an area vertex interaction with a target geometry element.
+     * Assumes the target geometry element has highest dimension
+     * (i.e. if the point lies on two elements of different dimension,
+     * the location on the higher dimension element is provided.
+     * This is the semantic provided by {@link RelatePointLocator}.
+     *
+     * Note that in a GeometryCollection containing overlapping or adjacent polygons,
+     * the area vertex location may be INTERIOR instead of BOUNDARY.
+     *
+     * @param isAreaA the input that is the area
+     * @param locArea the location on the area
+     * @param locTarget the location on the target geometry element
+     * @param dimTarget the dimension of the target geometry element
+     */
+    void addAreaVertex(bool isAreaA, geom::Location locArea,
+                       geom::Location locTarget, int dimTarget);
+
+    void evaluateNodes();
+
+};
+
+} // namespace geos.operation.relateng
+} // namespace geos.operation
+} // namespace geos
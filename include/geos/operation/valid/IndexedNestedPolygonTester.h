@@ -56,7 +56,21 @@ private:
 
     void loadIndex();
 
-    IndexedPointInAreaLocator& getLocator(const Polygon* poly);
+    static IndexedPointInAreaLocator& getLocator(const Polygon* poly,
+        std::map<const Polygon*, IndexedPointInAreaLocator>& locatorCache);
+
+    /**
+    * Tests if a polygon is nested within another polygon,
+    * using (and adding to) a cache of point locators.
+    *
+    * @param poly the polygon to test
+    * @param locatorCache the point locators of the candidate outer polygons
+    * @param coordNested return parameter for a nested point
+    * @return true if the polygon is nested
+    */
+    bool isPolygonNested(const Polygon* poly,
+        std::map<const Polygon*, IndexedPointInAreaLocator>& locatorCache,
+        CoordinateXY& coordNested);
 
     bool findNestedPoint(const LinearRing* shell,
         const Polygon* possibleOuterPoly,
@@ -101,6 +115,19 @@ public:
     */
     bool isNested();
 
+    /**
+    * Tests if any polygon is nested (contained) within another polygon,
+    * testing polygons concurrently.
+    * Each thread uses its own point locators for the candidate outer polygons.
+    * Testing stops once a nested polygon is found;
+    * the nested point reported is that of the first nested polygon
+    * (in input order), so the result does not depend on the number of threads.
+    *
+    * @param numThreads the number of threads to use (0 for the hardware default)
+    * @return true if some polygon is nested
+    */
+    bool isNested(std::size_t numThreads);
+
 
 };
 
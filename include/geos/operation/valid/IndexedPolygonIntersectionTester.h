@@ -0,0 +1,114 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/index/chain/MonotoneChain.h>
+#include <geos/index/strtree/TemplateSTRtree.h>
+#include <geos/noding/BasicSegmentString.h>
+
+#include <deque>
+#include <memory>
+#include <vector>
+
+// Forward declarations
+namespace geos {
+namespace geom {
+class LinearRing;
+class MultiPolygon;
+}
+}
+
+namespace geos {      // geos.
+namespace operation { // geos.operation
+namespace valid {     // geos.operation.valid
+
+/**
+ * Tests whether the rings of different polygons in a MultiPolygon
+ * cross or overlap.
+ * Polygons may touch only at points, so any proper or collinear
+ * intersection, or crossing at a vertex, between rings of distinct
+ * polygons is invalid.
+ * Intersections between rings of the same polygon are not checked
+ * (they are analyzed per polygon by PolygonTopologyAnalyzer).
+ *
+ * The ring segments are indexed using monotone chains in an STRtree.
+ * The index is read-only once built, so chains can be tested
+ * against it concurrently.
+ */
+class GEOS_DLL IndexedPolygonIntersectionTester {
+
+private:
+
+    std::deque<noding::BasicSegmentString> segStrings;
+    std::vector<std::unique_ptr<geom::CoordinateSequence>> coordSeqStore;
+    std::vector<index::chain::MonotoneChain> chains;
+    //-- the index of the polygon containing each chain
+    std::vector<std::size_t> chainPolygon;
+    index::strtree::TemplateSTRtree<const index::chain::MonotoneChain*> index;
+
+    bool isInvertedRingValid;
+    int invalidCode;
+    geom::CoordinateXY invalidLocation;
+
+    void addRing(const geom::LinearRing* ring, std::size_t polyIndex);
+
+    std::size_t chainIndex(const index::chain::MonotoneChain* mc) const
+    {
+        return static_cast<std::size_t>(mc - chains.data());
+    }
+
+    // Declare type as noncopyable
+    IndexedPolygonIntersectionTester(const IndexedPolygonIntersectionTester& other) = delete;
+    IndexedPolygonIntersectionTester& operator=(const IndexedPolygonIntersectionTester& rhs) = delete;
+
+public:
+
+    /**
+     * Creates a tester for the rings of the polygons in a MultiPolygon.
+     *
+     * @param multiPoly the MultiPolygon to test
+     * @param p_isInvertedRingValid whether self-touching rings forming
+     *        holes are valid (as in IsValidOp)
+     */
+    IndexedPolygonIntersectionTester(const geom::MultiPolygon* multiPoly, bool p_isInvertedRingValid);
+
+    /**
+     * Tests whether the rings of any two polygons cross or overlap.
+     * If so, the invalid code and location are set
+     * to those of the intersection found for the first chain
+     * (in input order), so the result does not depend
+     * on the number of threads.
+     *
+     * @param numThreads the number of threads to use (0 for the hardware default)
+     * @return true if an invalid intersection was found
+     */
+    bool hasInvalidIntersection(std::size_t numThreads);
+
+    int getInvalidCode() const
+    {
+        return invalidCode;
+    }
+
+    const geom::CoordinateXY& getInvalidLocation() const
+    {
+        return invalidLocation;
+    }
+
+};
+
+} // namespace geos.operation.valid
+} // namespace geos.operation
+} // namespace geos
@@ -70,6 +70,7 @@ private:
     * inverted shells and exverted holes (the ESRI SDE model)
     */
     bool isInvertedRingValid = false;
+    std::size_t numThreads = 1;
     std::unique_ptr<TopologyValidationError> validErr;
 
     bool hasInvalidError()
@@ -116,6 +117,14 @@ private:
      */
     bool isValid(const geom::MultiPolygon* g);
 
+    /**
+     * Tests validity of a MultiPolygon by checking each polygon
+     * concurrently, followed by concurrent indexed checks that
+     * the polygons do not cross, overlap or nest.
+     * Checking stops once an error is found.
+     */
+    bool isValidParallel(const geom::MultiPolygon* g);
+
     /**
      * Tests validity of a GeometryCollection.
      *
@@ -255,6 +264,28 @@ public:
         isInvertedRingValid = p_isValid;
     };
 
+    /**
+     * Sets the number of threads used to validate MultiPolygons.
+     * With more than one thread the polygons are validated concurrently
+     * (ring self-intersection, hole position and nesting,
+     * and interior connectivity), followed by concurrent checks
+     * that the polygons do not cross, overlap or nest.
+     * All threads stop once an error is found.
+     *
+     * The validity result is the same in all modes.
+     * If the geometry has several errors, the one reported
+     * may differ from that reported by the serial check,
+     * but it does not depend on the number of threads.
+     *
+     * The default is 1 (serial checking).
+     *
+     * @param p_numThreads the number of threads to use (0 for the number of hardware threads)
+     */
+    void setNumThreads(std::size_t p_numThreads)
+    {
+        numThreads = p_numThreads;
+    };
+
     /**
      * Tests whether a Geometry is valid.
      * @param geom the Geometry to test
@@ -22,6 +22,7 @@
 #include <geos/geom/CoordinateSequence.h>
 
 #include <memory>
+#include <vector>
 
 namespace geos {
 namespace geom {
@@ -34,6 +35,7 @@ class Envelope;
 namespace triangulate {
 namespace quadedge {
 class QuadEdgeSubdivision;
+class TriangleVisitor;
 }
 }
 }
@@ -81,6 +83,7 @@ public:
 private:
     std::unique_ptr<geom::CoordinateSequence> siteCoords;
     double tolerance;
+    bool isRandomizedInsertion;
     std::unique_ptr<quadedge::QuadEdgeSubdivision> subdiv;
 
 public:
@@ -121,6 +124,23 @@ public:
         this->tolerance = p_tolerance;
     }
 
+    /**
+     * Sets whether the sites are inserted in a randomized spatially-local
+     * order (see {@link IncrementalDelaunayTriangulator::sortForInsertion}),
+     * rather than sorted by X and Y.
+     * This is much faster for large numbers of sites.
+     * The triangulation is the same, except that where four or more
+     * sites are cocircular the choice of diagonals between them may differ.
+     * The default is false.
+     *
+     * @param p_isRandomizedInsertion true if randomized insertion should be used
+     */
+    inline void
+    setRandomizedInsertion(bool p_isRandomizedInsertion)
+    {
+        this->isRandomizedInsertion = p_isRandomizedInsertion;
+    }
+
 private:
     void create();
 
@@ -149,6 +169,35 @@ public:
      */
     std::unique_ptr<geom::GeometryCollection> getTriangles(const geom::GeometryFactory& geomFact);
 
+    /**
+     * Visits the triangles of the computed triangulation,
+     * without creating geometries for them.
+     *
+     * @param visitor the visitor to apply to each triangle
+     */
+    void visitTriangles(quadedge::TriangleVisitor& visitor);
+
+    /**
+     * Gets the unique site coordinates, sorted by X and Y.
+     * These are the vertices of the triangulation.
+     *
+     * @return the site coordinates, or nullptr if no sites have been set
+     */
+    const geom::CoordinateSequence* getSiteCoordinates() const
+    {
+        return siteCoords.get();
+    }
+
+    /**
+     * Gets the triangles of the computed triangulation as triples of
+     * indices into the site coordinates (see {@link getSiteCoordinates}).
+     * The vertices of each triangle are in CCW order.
+     * This is much more compact than {@link getTriangles}.
+     *
+     * @return the vertex indices of each triangle, three per triangle
+     */
+    std::vector<std::size_t> getTriangleIndices();
+
     /**
      * Computes the {@link geom::Envelope} of a collection of
      * {@link geom::Coordinate}s.
@@ -82,6 +82,25 @@ public:
      */
     void insertSites(const VertexList& vertices);
 
+    /**
+     * Sorts a list of vertices into an order which makes
+     * incremental insertion efficient for large inputs.
+     *
+     * The order is a Biased Randomized Insertion Order (BRIO):
+     * the vertices are shuffled (with a fixed seed) into rounds
+     * which double in size, and each round is sorted along a Hilbert curve.
+     * Successive vertices are close together, so the walk to locate
+     * each one is short and memory access is local,
+     * while the randomized rounds keep the number of edge flips low.
+     *
+     * The triangulation produced is the same as for vertices sorted by X and Y,
+     * except that where four or more vertices are cocircular
+     * the choice of diagonals between them may differ.
+     *
+     * @param vertices the vertices to sort
+     */
+    static void sortForInsertion(VertexList& vertices);
+
     /**
      * Inserts a new point into a subdivision representing a Delaunay
      * triangulation, and fixes the affected edges so that the result
@@ -20,6 +20,7 @@
 
 #include <geos/triangulate/quadedge/QuadEdgeSubdivision.h>
 #include <geos/geom/Envelope.h> // for composition
+#include <functional>
 #include <memory>
 #include <iostream>
 #include <unordered_map>
@@ -102,6 +103,20 @@ public:
      */
     void setTolerance(double tolerance);
 
+    /** \brief
+     * Sets whether the sites are inserted into the underlying triangulation
+     * in a randomized spatially-local order, rather than sorted by X and Y.
+     *
+     * This is much faster for large numbers of sites.
+     * The diagram is the same, except where four or more sites are cocircular.
+     * The default is false.
+     *
+     * @param isRandomizedInsertion true if randomized insertion should be used
+     *
+     * @see IncrementalDelaunayTriangulator::sortForInsertion
+     */
+    void setRandomizedInsertion(bool isRandomizedInsertion);
+
     /** \brief
      * Gets the quadedge::QuadEdgeSubdivision which models the computed diagram.
      *
@@ -118,6 +133,22 @@ public:
      */
     std::unique_ptr<geom::GeometryCollection> getDiagram(const geom::GeometryFactory& geomFact);
 
+    /** \brief
+     * Visits the faces of the computed diagram one at a time,
+     * clipped as specified, without building a collection of all of them.
+     *
+     * Cells are visited in no particular order
+     * (the ordering set by {@link setOrdered} does not apply).
+     * Cells which lie entirely outside the clip envelope are not visited.
+     *
+     * @param geomFact the geometry factory to use to create the cells
+     * @param visitor a function to which the site coordinate and
+     *                the (clipped) cell are passed
+     */
+    void visitDiagram(const geom::GeometryFactory& geomFact,
+                      const std::function<void(const geom::CoordinateXY& site,
+                                               std::unique_ptr<geom::Geometry> cell)>& visitor);
+
     /** \brief
      * Gets the edges of the computed diagram as a {@link geom::MultiLineString},
      * clipped as specified.
@@ -140,6 +171,7 @@ private:
     const geom::CoordinateSequence* inputSeq;
     geom::Envelope diagramEnv;
     bool isOrdered;
+    bool isRandomizedInsertion;
 
     void create();
 
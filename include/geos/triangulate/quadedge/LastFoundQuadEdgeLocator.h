@@ -18,6 +18,7 @@
 
 #pragma once
 
+#include <geos/geom/Envelope.h>
 #include <geos/triangulate/quadedge/QuadEdge.h>
 #include <geos/triangulate/quadedge/QuadEdgeLocator.h>
 
@@ -31,6 +32,8 @@ class QuadEdgeSubdivision;
 /** \brief
  * Locates {@link QuadEdge}s in a {@link QuadEdgeSubdivision}, optimizing the
  * search by starting in the locality of the last edge found.
+ * If the subdivision walks from the start edge, locations outside the
+ * extent of the previous ones are searched for from the frame instead.
  *
  * @author JTS: Martin Davis
  * @author Benjamin Campbell
@@ -39,6 +42,7 @@ class LastFoundQuadEdgeLocator : public QuadEdgeLocator {
 private:
     QuadEdgeSubdivision* subdiv;
     QuadEdge*			lastEdge;
+    geom::Envelope locatedEnv;
 
 public:
     LastFoundQuadEdgeLocator(QuadEdgeSubdivision* subdiv);
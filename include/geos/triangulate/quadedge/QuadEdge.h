@@ -19,6 +19,7 @@
 
 #pragma once
 
+#include <cassert>
 #include <memory>
 
 #include <geos/triangulate/quadedge/Vertex.h>
@@ -46,6 +47,13 @@ class GEOS_DLL QuadEdgeQuartet;
  * The edge class does not contain separate information for vertice or faces; a vertex is implicitly
  * defined as a ring of edges (created using the `next` field).
  *
+ * An edge refers to its origin {@link Vertex} rather than holding a copy of it.
+ * Edges created by makeEdge and connect refer to copies of their vertices
+ * held by their quartet. The edges of a {@link QuadEdgeSubdivision} refer to
+ * the vertices stored by the subdivision, so that each vertex is stored only
+ * once. setOrig and setDest do not copy the vertex, which must remain valid
+ * for as long as the edge is used.
+ *
  * @author JTS: David Skea
  * @author JTS: Martin Davis
  * @author Benjamin Campbell
@@ -99,7 +107,7 @@ public:
 
 private:
     //// the dual of this edge, directed from right to left
-    Vertex   vertex; // The vertex that this edge represents
+    const Vertex* vertex; // The vertex that this edge represents (not owned)
     QuadEdge* next;  // A reference to a connected edge
 
     int8_t num;      // the position of the QuadEdge in the quartet (0-3)
@@ -112,6 +120,7 @@ private:
      * to ensure proper construction.
      */
     explicit QuadEdge(int8_t _num) :
+        vertex(nullptr),
         next(nullptr),
         num(_num),
         isAlive(true),
@@ -354,20 +363,25 @@ public:
      * Data Access
      **********************************************************************************************/
     /** \brief
-     * Sets the vertex for this edge's origin
+     * Sets the vertex for this edge's origin.
+     * The vertex is referenced, not copied.
      *
-     * @param o the origin vertex
+     * @param o the origin vertex, which must remain valid while this edge is used
      */
     inline void
     setOrig(const Vertex& o)
     {
-        vertex = o;
+        vertex = &o;
     }
 
+    //-- a temporary would not outlive the edge
+    void setOrig(Vertex&&) = delete;
+
     /** \brief
-     * Sets the vertex for this edge's destination
+     * Sets the vertex for this edge's destination.
+     * The vertex is referenced, not copied.
      *
-     * @param d the destination vertex
+     * @param d the destination vertex, which must remain valid while this edge is used
      */
     inline void
     setDest(const Vertex& d)
@@ -375,19 +389,28 @@ public:
         sym().setOrig(d);
     }
 
+    void setDest(Vertex&&) = delete;
+
     /** \brief
-     * Gets the vertex for the edge's origin
+     * Gets the vertex for the edge's origin.
+     *
+     * The edge must have an origin: the dual edges of a subdivision
+     * have none until the circumcentres of its triangles are computed
+     * (see QuadEdgeSubdivision::getVoronoiCellPolygons).
      *
      * @return the origin vertex
      */
     const Vertex&
     orig() const
     {
-        return vertex;
+        assert(vertex != nullptr);
+        return *vertex;
     }
 
     /** \brief
-     * Gets the vertex for the edge's destination
+     * Gets the vertex for the edge's destination.
+     *
+     * The edge must have a destination (see orig()).
      *
      * @return the destination vertex
      */
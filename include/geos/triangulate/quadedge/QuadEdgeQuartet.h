@@ -16,12 +16,15 @@
 
 #include <geos/triangulate/quadedge/QuadEdge.h>
 
+#include <array>
+#include <memory>
 
 namespace geos {
 namespace triangulate {
 namespace quadedge {
 
 class GEOS_DLL QuadEdgeQuartet {
+    friend class QuadEdgeSubdivision;
 
 public:
     QuadEdgeQuartet() : e{{QuadEdge(0), QuadEdge(1), QuadEdge(2), QuadEdge(3)}} {
@@ -31,11 +34,13 @@ public:
         e[3].next = &(e[1]);
     };
 
+    /// Creates a quartet from o to d, holding copies of the vertices.
     static QuadEdge& makeEdge(const Vertex& o, const Vertex & d, std::deque<QuadEdgeQuartet> & edges) {
         edges.emplace_back();
         auto& qe = edges.back();
-        qe.base().setOrig(o);
-        qe.base().setDest(d);
+        qe.ownedVertices.reset(new std::array<Vertex, 2>{{o, d}});
+        qe.base().setOrig((*qe.ownedVertices)[0]);
+        qe.base().setDest((*qe.ownedVertices)[1]);
 
         return qe.base();
     }
@@ -55,7 +60,22 @@ public:
     }
 
 private:
+    /**
+     * Creates a quartet from o to d which refers to the vertices instead of
+     * copying them. Used by QuadEdgeSubdivision, which owns its vertices.
+     */
+    static QuadEdge& makeEdgeSharingVertices(const Vertex& o, const Vertex & d, std::deque<QuadEdgeQuartet> & edges) {
+        edges.emplace_back();
+        auto& qe = edges.back();
+        qe.base().setOrig(o);
+        qe.base().setDest(d);
+
+        return qe.base();
+    }
+
     std::array<QuadEdge, 4> e;
+    //-- copies of the vertices, if created by makeEdge
+    std::unique_ptr<std::array<Vertex, 2>> ownedVertices;
 };
 
 }
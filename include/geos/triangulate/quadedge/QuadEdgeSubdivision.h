@@ -19,6 +19,7 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <list>
 #include <stack>
@@ -96,6 +97,16 @@ private:
      * Note that it is NOT safe to erase entries from the deque.
      */
     std::deque<QuadEdgeQuartet> quadEdges;
+    /**
+     * The vertices referenced by the quadedges.
+     * Each site is stored once, and shared by all edges which originate at it.
+     */
+    std::deque<Vertex> vertices;
+    /**
+     * The Voronoi vertices referenced by the dual quadedges,
+     * computed on demand.
+     */
+    std::deque<Vertex> circumcentres;
     std::array<QuadEdge*, 3> startingEdges;
     double tolerance;
     double edgeCoincidenceTolerance;
@@ -103,6 +114,7 @@ private:
     geom::Envelope frameEnv;
     std::unique_ptr<QuadEdgeLocator> locator;
     bool visit_state_clean;
+    bool walkFromStartEdge;
 
 public:
     /** \brief
@@ -170,8 +182,31 @@ public:
         this->locator = std::move(p_locator);
     }
 
+    /** \brief
+     * Sets whether {@link locateFromEdge} walks from the given start edge.
+     * By default the walk starts from the frame.
+     *
+     * Walking from the start edge makes locating fast when successive
+     * locations are near each other but not sorted, as with a randomized
+     * insertion order (see IncrementalDelaunayTriangulator::sortForInsertion).
+     *
+     * @param p_walkFromStartEdge true to walk from the start edge
+     */
+    inline void
+    setWalkFromStartEdge(bool p_walkFromStartEdge)
+    {
+        walkFromStartEdge = p_walkFromStartEdge;
+    }
+
+    inline bool
+    isWalkFromStartEdge() const
+    {
+        return walkFromStartEdge;
+    }
+
     /** \brief
      * Creates a new quadedge, recording it in the edges list.
+     * The vertices are copied into the subdivision.
      *
      * @param o
      * @param d
@@ -179,6 +214,17 @@ public:
      */
     virtual QuadEdge& makeEdge(const Vertex& o, const Vertex& d);
 
+    /** \brief
+     * Creates a new quadedge from the origin of an edge
+     * to a new vertex, and splices it into the edges around that origin.
+     * Only the new vertex is copied into the subdivision.
+     *
+     * @param e an edge whose origin is the origin of the new edge
+     * @param v the destination vertex of the new edge
+     * @return the new quadedge
+     */
+    QuadEdge& connectVertex(QuadEdge& e, const Vertex& v);
+
     /** \brief
      * Creates a new QuadEdge connecting the destination of a to the origin of b,
      * in such a way that all three have the same left face after the connection
@@ -205,7 +251,8 @@ public:
      *
      * The edge returned has the property that either v is on e,
      * or e is an edge of a triangle containing v.
-     * The search starts from startEdge and proceeds on the general direction of v.
+     * The search starts from the frame, or from startEdge
+     * if isWalkFromStartEdge() is set, and proceeds on the general direction of v.
      *
      * This locate algorithm relies on the subdivision being Delaunay. For
      * non-Delaunay subdivisions, this may loop for ever.
@@ -453,6 +500,20 @@ public:
      */
     std::vector<std::unique_ptr<geom::Geometry>> getVoronoiCellPolygons(const geom::GeometryFactory& geomFact);
 
+    /** \brief
+     * Visits the [Polygons](@ref geom::Polygon) for the Voronoi cells
+     * of this triangulation one at a time,
+     * without keeping all of them in memory.
+     *
+     * As for {@link getVoronoiCellPolygons}, the userData of each polygon
+     * is set to be the [Coordinate](@ref geom::Coordinate) of the cell site.
+     *
+     * @param geomFact a geometry factory
+     * @param visitor a function to which each cell is passed
+     */
+    void visitVoronoiCellPolygons(const geom::GeometryFactory& geomFact,
+                                  const std::function<void(std::unique_ptr<geom::Geometry>)>& visitor);
+
     /** \brief
      * Gets a List of [LineStrings](@ref geom::LineString) for the Voronoi cells
      * of this triangulation.
@@ -488,6 +549,10 @@ public:
      * of the site. This allows attaching external data associated with the site
      * to this cell polygon.
      *
+     * The cell vertices are the origins of the dual edges, so the
+     * circumcentres of the triangles must have been computed first,
+     * as getVoronoiCellPolygons() does.
+     *
      * @param qe a quadedge originating at the cell site
      * @param geomFact a factory for building the polygon
      * @return a polygon indicating the cell extent
@@ -501,6 +566,9 @@ public:
      * of the site.  This allows attaching external data associated with
      * the site to this cell polygon.
      *
+     * As for getVoronoiCellPolygon(), the circumcentres of the triangles
+     * must have been computed first.
+     *
      * @param qe a quadedge originating at the cell site
      * @param geomFact a factory for building the polygon
      * @return a polygon indicating the cell extent
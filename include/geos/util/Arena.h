@@ -0,0 +1,178 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace geos {
+namespace util { // geos::util
+
+/**
+ * \brief A monotonic memory region.
+ *
+ * Memory is handed out sequentially from a list of blocks and is
+ * never returned individually. All allocations are released at once
+ * by reset(), which keeps the memory blocks for reuse, or release(),
+ * which returns them to the system.
+ *
+ * An Arena does not run destructors. It is intended to back
+ * containers via ArenaAllocator, which destroy their elements
+ * as usual but whose deallocations are no-ops.
+ *
+ * An Arena is not thread-safe.
+ */
+class GEOS_DLL Arena {
+
+public:
+
+    static constexpr std::size_t DEFAULT_BLOCK_SIZE = 16 * 1024;
+
+    explicit Arena(std::size_t initialBlockSize = DEFAULT_BLOCK_SIZE);
+
+    ~Arena();
+
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    /**
+     * Allocates a region of memory from the arena.
+     *
+     * @param bytes the number of bytes to allocate
+     * @param alignment the required alignment (a power of two)
+     * @return a pointer to the allocated memory
+     */
+    void* allocate(std::size_t bytes, std::size_t alignment = alignof(std::max_align_t));
+
+    /**
+     * Discards all allocations. The memory held by the arena is
+     * retained (consolidated into a single block) so that it can
+     * be reused without further system allocations.
+     */
+    void reset();
+
+    /**
+     * Discards all allocations, retaining the memory held by the arena
+     * only if it does not exceed a given size, and freeing it otherwise.
+     *
+     * @param maxRetained the maximum number of bytes to keep for reuse
+     */
+    void reset(std::size_t maxRetained);
+
+    /**
+     * Discards all allocations and frees all memory held by the arena.
+     * Subsequent allocations start again from the initial block size.
+     */
+    void release();
+
+    /// Returns the number of bytes handed out since the last reset.
+    std::size_t getBytesUsed() const
+    {
+        return bytesUsed;
+    }
+
+    /// Returns the total size of the memory blocks held by the arena.
+    std::size_t getCapacity() const;
+
+    /// Returns the number of memory blocks held by the arena.
+    std::size_t getNumBlocks() const
+    {
+        return blocks.size();
+    }
+
+private:
+
+    struct Block {
+        std::unique_ptr<char[]> data;
+        std::size_t size;
+    };
+
+    void addBlock(std::size_t minSize);
+
+    std::vector<Block> blocks;
+    std::size_t initialBlockSize;
+    std::size_t nextBlockSize;
+    std::size_t bytesUsed;
+    char* cur;
+    char* end;
+
+};
+
+/**
+ * \brief A standard library allocator which obtains memory from an Arena.
+ *
+ * Deallocation is a no-op; memory is reclaimed when the Arena is reset.
+ * An ArenaAllocator constructed with a null Arena falls back to the
+ * global heap, so that a container type can be used with or without
+ * an arena.
+ */
+template<typename T>
+class ArenaAllocator {
+
+public:
+
+    using value_type = T;
+
+    explicit ArenaAllocator(Arena* p_arena = nullptr) noexcept
+        : arena(p_arena)
+    {}
+
+    template<typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) noexcept
+        : arena(other.getArena())
+    {}
+
+    T* allocate(std::size_t n)
+    {
+        if (arena == nullptr) {
+            return static_cast<T*>(::operator new(n * sizeof(T)));
+        }
+        return static_cast<T*>(arena->allocate(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T* p, std::size_t) noexcept
+    {
+        if (arena == nullptr) {
+            ::operator delete(p);
+        }
+    }
+
+    Arena* getArena() const noexcept
+    {
+        return arena;
+    }
+
+    template<typename U>
+    bool operator==(const ArenaAllocator<U>& other) const noexcept
+    {
+        return arena == other.getArena();
+    }
+
+    template<typename U>
+    bool operator!=(const ArenaAllocator<U>& other) const noexcept
+    {
+        return arena != other.getArena();
+    }
+
+private:
+
+    Arena* arena;
+
+};
+
+} // namespace geos::util
+} // namespace geos
+
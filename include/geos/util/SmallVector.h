@@ -0,0 +1,355 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <type_traits>
+
+namespace geos {
+namespace util { // geos::util
+
+/**
+ * \brief A contiguous container which stores up to N elements inline.
+ *
+ * Elements are stored in the container itself until there are more
+ * than N of them, after which they move to a heap buffer, so small
+ * contents need no separate allocation.
+ *
+ * A container can also borrow the elements of an external buffer
+ * (see borrow()), which are used in place until the container is modified.
+ *
+ * Only the subset of the std::vector interface needed by GEOS is provided.
+ * Unlike std::vector, moving an inline container copies its elements,
+ * so pointers to them are not preserved.
+ *
+ * Elements must be trivially copyable.
+ */
+template<typename T, std::size_t N>
+class SmallVector {
+    static_assert(std::is_trivially_copyable<T>::value, "SmallVector elements must be trivially copyable");
+    static_assert(N > 0, "SmallVector must have an inline capacity");
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    /// Called with its user data when a borrowed buffer is no longer used
+    using ReleaseCallback = void (*)(void* userdata);
+
+    SmallVector() noexcept
+        : m_data(m_inline)
+        , m_size(0)
+        , m_capacity(N)
+    {}
+
+    explicit SmallVector(std::size_t n)
+        : SmallVector()
+    {
+        resize(n);
+    }
+
+    /// Copies the elements, even if the other container borrows them
+    SmallVector(const SmallVector& other)
+        : SmallVector()
+    {
+        assign(other.begin(), other.end());
+    }
+
+    SmallVector(SmallVector&& other) noexcept
+        : SmallVector()
+    {
+        take(other);
+    }
+
+    ~SmallVector()
+    {
+        freeStorage();
+    }
+
+    SmallVector& operator=(const SmallVector& other)
+    {
+        if (this != &other) {
+            assign(other.begin(), other.end());
+        }
+        return *this;
+    }
+
+    SmallVector& operator=(SmallVector&& other) noexcept
+    {
+        if (this != &other) {
+            freeStorage();
+            m_data = m_inline;
+            m_size = 0;
+            m_capacity = N;
+            take(other);
+        }
+        return *this;
+    }
+
+    std::size_t size() const { return m_size; }
+
+    bool empty() const { return m_size == 0; }
+
+    std::size_t capacity() const { return isBorrowed() ? m_size : m_capacity; }
+
+    /// Tests whether the elements are stored in the container itself
+    bool isInline() const { return m_capacity == N; }
+
+    /// Tests whether the elements are those of a borrowed external buffer
+    bool isBorrowed() const { return m_capacity == 0; }
+
+    /**
+     * \brief
+     * Replaces the contents by the elements of an external buffer,
+     * without copying them.
+     *
+     * The buffer is never modified: the modifying methods copy the
+     * elements into the container first. The non-const accessors must
+     * not be used until then (see own()).
+     *
+     * @param data the elements, which must stay valid until released
+     * @param n the number of elements
+     * @param release called when the buffer is no longer used, or null
+     * @param userdata passed to the release callback
+     */
+    void borrow(const T* data, std::size_t n, ReleaseCallback release, void* userdata)
+    {
+        freeStorage();
+        m_data = const_cast<T*>(data);
+        m_borrowed.release = release;
+        m_borrowed.userdata = userdata;
+        m_size = n;
+        m_capacity = 0;
+    }
+
+    /**
+     * \brief
+     * Copies the elements of a borrowed buffer into the container,
+     * and releases the buffer. Does nothing if no buffer is borrowed.
+     */
+    void own()
+    {
+        if (isBorrowed()) {
+            ownBorrowed();
+        }
+    }
+
+    T* data() { assert(! isBorrowed()); return m_data; }
+    const T* data() const { return m_data; }
+
+    T& operator[](std::size_t i) { return data()[i]; }
+    const T& operator[](std::size_t i) const { return data()[i]; }
+
+    T* begin() { return data(); }
+    T* end() { return data() + m_size; }
+    const T* begin() const { return data(); }
+    const T* end() const { return data() + m_size; }
+    const T* cbegin() const { return data(); }
+    const T* cend() const { return data() + m_size; }
+
+    void clear()
+    {
+        if (isBorrowed()) {
+            freeStorage();
+            m_data = m_inline;
+            m_capacity = N;
+        }
+        m_size = 0;
+    }
+
+    void pop_back()
+    {
+        assert(m_size > 0);
+        m_size--;
+    }
+
+    void reserve(std::size_t n)
+    {
+        own();
+        if (n > m_capacity) {
+            grow(n);
+        }
+    }
+
+    /// Resizes the container, value-initializing any new elements
+    void resize(std::size_t n)
+    {
+        own();
+        if (n > m_capacity) {
+            grow(std::max(n, 2 * m_size));
+        }
+        if (n > m_size) {
+            std::fill(m_data + m_size, m_data + n, T());
+        }
+        m_size = n;
+    }
+
+    void assign(const T* first, const T* last)
+    {
+        auto n = static_cast<std::size_t>(last - first);
+        if (isAliased(first) && isBorrowed()) {
+            std::unique_ptr<T[]> copy(new T[n]);
+            std::copy(first, last, copy.get());
+            assign(copy.get(), copy.get() + n);
+            return;
+        }
+        if (isAliased(first)) {
+            std::memmove(m_data, first, n * sizeof(T));
+        }
+        else {
+            clear();
+            reserve(n);
+            std::copy(first, last, m_data);
+        }
+        m_size = n;
+    }
+
+    T* insert(const T* pos, std::size_t n, const T& value)
+    {
+        //-- value may be an element of the container
+        T v = value;
+        T* p = makeGap(offsetOf(pos), n);
+        std::fill(p, p + n, v);
+        return p;
+    }
+
+    T* insert(const T* pos, const T* first, const T* last)
+    {
+        auto n = static_cast<std::size_t>(last - first);
+        if (isAliased(first)) {
+            std::size_t offset = offsetOf(pos);
+            std::unique_ptr<T[]> copy(new T[n]);
+            std::copy(first, last, copy.get());
+            return insert(cbegin() + offset, copy.get(), copy.get() + n);
+        }
+        T* p = makeGap(offsetOf(pos), n);
+        std::copy(first, last, p);
+        return p;
+    }
+
+private:
+    //-- the release callback of a borrowed buffer
+    struct Borrowed {
+        ReleaseCallback release;
+        void* userdata;
+    };
+
+    //-- m_inline, a heap buffer or a borrowed buffer,
+    //-- so that element access does not depend on the storage
+    T* m_data;
+    std::size_t m_size;
+    //-- N for inline storage, 0 for a borrowed buffer
+    std::size_t m_capacity;
+    union {
+        Borrowed m_borrowed;
+        T m_inline[N];
+    };
+
+    std::size_t offsetOf(const T* p) const
+    {
+        return static_cast<std::size_t>(p - data());
+    }
+
+    bool isAliased(const T* p) const
+    {
+        //-- std::less gives a total order on unrelated pointers
+        std::less<const T*> less;
+        return ! less(p, data()) && less(p, data() + capacity());
+    }
+
+    void freeStorage()
+    {
+        if (isBorrowed()) {
+            if (m_borrowed.release) {
+                m_borrowed.release(m_borrowed.userdata);
+            }
+        }
+        else if (! isInline()) {
+            delete[] m_data;
+        }
+    }
+
+    void ownBorrowed()
+    {
+        Borrowed borrowed = m_borrowed;
+        const T* borrowedData = m_data;
+        if (m_size > N) {
+            m_data = new T[m_size];
+            m_capacity = m_size;
+        }
+        else {
+            m_data = m_inline;
+            m_capacity = N;
+        }
+        std::copy(borrowedData, borrowedData + m_size, m_data);
+        if (borrowed.release) {
+            borrowed.release(borrowed.userdata);
+        }
+    }
+
+    void grow(std::size_t newCapacity)
+    {
+        assert(newCapacity > N);
+        T* buf = new T[newCapacity];
+        std::copy(m_data, m_data + m_size, buf);
+        if (! isInline()) {
+            delete[] m_data;
+        }
+        m_data = buf;
+        m_capacity = newCapacity;
+    }
+
+    /*
+     * Moves the elements from offset on by n places,
+     * returning the start of the uninitialized gap.
+     */
+    T* makeGap(std::size_t offset, std::size_t n)
+    {
+        own();
+        if (m_size + n > m_capacity) {
+            grow(m_size + std::max(m_size, n));
+        }
+        T* p = m_data + offset;
+        std::memmove(p + n, p, (m_size - offset) * sizeof(T));
+        m_size += n;
+        return p;
+    }
+
+    void take(SmallVector& other) noexcept
+    {
+        if (other.isInline()) {
+            std::copy(other.m_inline, other.m_inline + other.m_size, m_inline);
+        }
+        else {
+            m_data = other.m_data;
+            if (other.isBorrowed()) {
+                m_borrowed = other.m_borrowed;
+            }
+            m_capacity = other.m_capacity;
+            other.m_data = other.m_inline;
+            other.m_capacity = N;
+        }
+        m_size = other.m_size;
+        other.m_size = 0;
+    }
+};
+
+} // namespace geos::util
+} // namespace geos
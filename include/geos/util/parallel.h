@@ -0,0 +1,132 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace geos {
+namespace util {
+
+/**
+ * Gets the number of threads to use when a caller requests
+ * the default level of parallelism (i.e. a thread count of 0).
+ *
+ * @return the number of hardware threads, or 1 if this cannot be determined
+ */
+GEOS_DLL std::size_t defaultThreadCount();
+
+/**
+ * Calls a function for each index in [0, n),
+ * distributing the calls over up to numThreads threads.
+ * Indexes are handed out in increasing order,
+ * so work items which are cheap to skip can test
+ * a shared flag for early termination.
+ *
+ * If numThreads is 1 (or there is at most one item)
+ * all calls are made on the calling thread.
+ * If numThreads is 0 the defaultThreadCount() is used.
+ *
+ * If any call throws, remaining indexes are not started
+ * and the first exception is rethrown on the calling thread
+ * once all threads have finished.
+ *
+ * Note that the GEOS interrupt callback (if any)
+ * may be invoked from the worker threads.
+ *
+ * @param n the number of items
+ * @param numThreads the maximum number of threads to use
+ * @param fn the function to call for each item index
+ */
+GEOS_DLL void parallelFor(std::size_t n, std::size_t numThreads,
+                          const std::function<void(std::size_t)>& fn);
+
+/**
+ * A set of threads which run a sequence of parallel loops.
+ *
+ * Algorithms which alternate short parallel steps with sequential ones
+ * use a pool so that threads are started once, rather than for every
+ * step as with util::parallelFor.
+ *
+ * The threads are started when the pool is created and stopped when
+ * it is destroyed. A pool must only be used from the thread which
+ * created it.
+ */
+class GEOS_DLL ThreadPool {
+
+public:
+
+    /**
+     * Creates a pool.
+     *
+     * @param numThreads the number of threads, including the calling
+     *        thread (0 for the defaultThreadCount())
+     */
+    explicit ThreadPool(std::size_t numThreads);
+
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /// Returns the number of threads, including the calling thread
+    std::size_t getNumThreads() const
+    {
+        return threads.size() + 1;
+    }
+
+    /**
+     * Calls a function for each index in [0, n),
+     * distributing the calls over the threads of the pool.
+     * The calling thread does its share of the work.
+     * Otherwise the behaviour is the same as util::parallelFor.
+     *
+     * @param n the number of items
+     * @param fn the function to call for each item index
+     */
+    void parallelFor(std::size_t n, const std::function<void(std::size_t)>& fn);
+
+private:
+
+    void run();
+
+    void work();
+
+    std::vector<std::thread> threads;
+    std::mutex lock;
+    std::condition_variable startCondition;
+    std::condition_variable doneCondition;
+
+    //-- the current loop
+    const std::function<void(std::size_t)>* task = nullptr;
+    std::size_t numItems = 0;
+    std::atomic<std::size_t> next{0};
+    std::atomic<bool> isFailed{false};
+    std::exception_ptr error;
+
+    //-- incremented for each loop run by the worker threads
+    std::size_t generation = 0;
+    std::size_t numBusy = 0;
+    bool isStopping = false;
+};
+
+}
+}
@@ -50,6 +50,13 @@ PointLocation::isOnLine(const geom::CoordinateXY& p, const geom::CoordinateSeque
     return false;
 }
 
+/* public static */
+bool
+PointLocation::isOnSegment(const geom::CoordinateXY& p, const geom::CoordinateXY& p0, const geom::CoordinateXY& p1)
+{
+    return LineIntersector::hasIntersection(p, p0, p1);
+}
+
 /* public static */
 bool
 PointLocation::isInRing(const geom::CoordinateXY& p,
@@ -18,11 +18,19 @@
  **********************************************************************/
 
 #include <geos/algorithm/construct/IndexedPointInPolygonsLocator.h>
+#include <geos/geom/CoordinateSequence.h>
 #include <geos/geom/Envelope.h>
 #include <geos/geom/util/PolygonalExtracter.h>
+#include <geos/shape/fractal/HilbertEncoder.h>
+#include <geos/util/parallel.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
 #include <vector>
 
 using geos::algorithm::locate::IndexedPointInAreaLocator;
+using geos::geom::CoordinateSequence;
 using geos::geom::Envelope;
 using geos::geom::util::PolygonalExtracter;
 
@@ -36,6 +44,8 @@ IndexedPointInPolygonsLocator::IndexedPointInPolygonsLocator(const Geometry& g)
 {   
 }
 
+constexpr std::size_t IndexedPointInPolygonsLocator::NOT_FOUND;
+
 /* private */
 void IndexedPointInPolygonsLocator::init()
 {
@@ -43,13 +53,16 @@ void IndexedPointInPolygonsLocator::init()
         return;
     }
     isInitialized = true;
-    std::vector<const Geometry*> polys;
     PolygonalExtracter::getPolygonals(geom, polys);
-    for (const Geometry* poly : polys) {
-        IndexedPointInAreaLocator* ptLocator = new IndexedPointInAreaLocator(*poly);
+    for (std::size_t i = 0; i < polys.size(); i++) {
+        IndexedPointInAreaLocator* ptLocator = new IndexedPointInAreaLocator(*polys[i]);
         locators.emplace_back(ptLocator);
-        index.insert(poly->getEnvelopeInternal(), ptLocator);
+        index.insert(*polys[i]->getEnvelopeInternal(), i);
+        //-- build the locator index now, so that locate is safe to call concurrently
+        CoordinateXY pt;
+        ptLocator->locate(&pt);
     }
+    index.build();
 }
 
 /* public */
@@ -57,14 +70,76 @@ Location IndexedPointInPolygonsLocator::locate(const CoordinateXY* /*const*/ pt)
 {
     init();
     Envelope queryEnv(*pt);
-    std::vector<IndexedPointInAreaLocator*> result;
+    std::vector<std::size_t> result;
     index.query(queryEnv, result);
-    for (IndexedPointInAreaLocator* ptLocater : result) {
-      Location loc = ptLocater->locate(pt);
+    for (std::size_t i : result) {
+      Location loc = locators[i]->locate(pt);
       if (loc != Location::EXTERIOR)
         return loc;
     }
     return Location::EXTERIOR;
 }
 
+/* public */
+std::vector<std::size_t>
+IndexedPointInPolygonsLocator::locatePolygons(const CoordinateSequence& pts, std::size_t numThreads)
+{
+    init();
+    std::vector<std::size_t> polyIndex(pts.size(), NOT_FOUND);
+
+    //-- order the points along a Hilbert curve, so that nearby points are processed together
+    std::vector<std::size_t> order;
+    order.reserve(pts.size());
+    Envelope extent;
+    for (std::size_t i = 0; i < pts.size(); i++) {
+        const CoordinateXY& p = pts.getAt<CoordinateXY>(i);
+        if (std::isfinite(p.x) && std::isfinite(p.y)) {
+            order.push_back(i);
+            extent.expandToInclude(p);
+        }
+    }
+    if (order.empty() || polys.empty()) {
+        return polyIndex;
+    }
+
+    shape::fractal::HilbertEncoder encoder(16, extent);
+    std::vector<uint32_t> codes(pts.size());
+    for (std::size_t i : order) {
+        Envelope env(pts.getAt<CoordinateXY>(i));
+        codes[i] = encoder.encode(&env);
+    }
+    std::stable_sort(order.begin(), order.end(), [&codes](std::size_t a, std::size_t b) {
+        return codes[a] < codes[b];
+    });
+
+    //-- each cluster of points finds its candidate polygons with a single query
+    static constexpr std::size_t CLUSTER_SIZE = 64;
+    std::size_t numClusters = (order.size() + CLUSTER_SIZE - 1) / CLUSTER_SIZE;
+
+    util::parallelFor(numClusters, numThreads, [&](std::size_t c) {
+        std::size_t start = c * CLUSTER_SIZE;
+        std::size_t end = std::min(order.size(), start + CLUSTER_SIZE);
+
+        Envelope clusterEnv;
+        for (std::size_t k = start; k < end; k++) {
+            clusterEnv.expandToInclude(pts.getAt<CoordinateXY>(order[k]));
+        }
+        std::vector<std::size_t> candidates;
+        index.query(clusterEnv, candidates);
+        std::sort(candidates.begin(), candidates.end());
+
+        for (std::size_t k = start; k < end; k++) {
+            const CoordinateXY& p = pts.getAt<CoordinateXY>(order[k]);
+            for (std::size_t i : candidates) {
+                if (polys[i]->getEnvelopeInternal()->intersects(p)
+                        && locators[i]->locate(&p) != Location::EXTERIOR) {
+                    polyIndex[order[k]] = i;
+                    break;
+                }
+            }
+        }
+    });
+    return polyIndex;
+}
+
 }}}
\ No newline at end of file
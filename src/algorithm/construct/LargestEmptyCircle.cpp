@@ -30,6 +30,7 @@
 #include <geos/algorithm/locate/IndexedPointInAreaLocator.h>
 #include <geos/operation/distance/IndexedFacetDistance.h>
 #include <geos/util/Interrupt.h>
+#include <geos/util/parallel.h>
 
 #include <typeinfo> // for dynamic_cast
 #include <cassert>
@@ -40,6 +41,16 @@ namespace geos {
 namespace algorithm { // geos.algorithm
 namespace construct { // geos.algorithm.construct
 
+namespace {
+
+/*
+ * Number of cells refined together when the
+ * cell distances are computed by several threads.
+ */
+constexpr std::size_t PARALLEL_BATCH_SIZE = 64;
+
+} // anonymous namespace
+
 LargestEmptyCircle::LargestEmptyCircle(const Geometry* p_obstacles, double p_tolerance)
     : LargestEmptyCircle(p_obstacles, nullptr, p_tolerance)
 {
@@ -228,41 +239,69 @@ LargestEmptyCircle::compute()
 
     Cell farthestCell = createCentroidCell(obstacles);
 
+    //-- make sure the obstacle index is built before it is shared by threads
+    std::unique_ptr<Point> obstaclePt(factory->createPoint(*obstacles->getCoordinate()));
+    obstacleDistance.distance(*obstaclePt);
+
     /**
      * Carry out the branch-and-bound search
-     * of the cell space
+     * of the cell space.
+     * When using several threads the distances of the subcells of a batch
+     * of cells are computed together, otherwise cells are refined one by one.
+     * The threads are started once for the whole search.
      */
+    util::ThreadPool threadPool(numThreads);
+    std::size_t batchSize = numThreads == 1 ? 1 : PARALLEL_BATCH_SIZE;
+    std::vector<Cell> refineCells;
+    std::vector<CoordinateXY> subCellCenters;
+    std::vector<double> subCellDistances;
+
     std::size_t maxIter = MaximumInscribedCircle::computeMaximumIterations(boundary.get(), tolerance);
     std::size_t iterationCount = 0;
     while (!cellQueue.empty() && iterationCount < maxIter) {
-
-        // pick the most promising cell from the queue
-        Cell cell = cellQueue.top();
-        cellQueue.pop();
-
-        if ((iterationCount++ % 1000) == 0) {
-            GEOS_CHECK_FOR_INTERRUPTS();
+        refineCells.clear();
+        while (refineCells.size() < batchSize && !cellQueue.empty() && iterationCount < maxIter) {
+            // pick the most promising cell from the queue
+            Cell cell = cellQueue.top();
+            cellQueue.pop();
+
+            if ((iterationCount++ % 1000) == 0) {
+                GEOS_CHECK_FOR_INTERRUPTS();
+            }
+
+            // update the center cell if the candidate is further from the constraints
+            if (cell.getDistance() > farthestCell.getDistance()) {
+                farthestCell = cell;
+            }
+
+            /**
+            * If this cell may contain a better approximation to the center
+            * of the empty circle, then refine it (partition into subcells
+            * which are added into the queue for further processing).
+            * Otherwise the cell is pruned (not investigated further),
+            * since no point in it can be further than the current farthest distance.
+            */
+            if (mayContainCircleCenter(cell, farthestCell)) {
+                refineCells.push_back(cell);
+            }
         }
 
-        // update the center cell if the candidate is further from the constraints
-        if (cell.getDistance() > farthestCell.getDistance()) {
-            farthestCell = cell;
-        }
-
-        /**
-        * If this cell may contain a better approximation to the center
-        * of the empty circle, then refine it (partition into subcells
-        * which are added into the queue for further processing).
-        * Otherwise the cell is pruned (not investigated further),
-        * since no point in it can be further than the current farthest distance.
-        */
-        if (mayContainCircleCenter(cell, farthestCell)) {
-            // split the cell into four sub-cells
+        // split the cells into four sub-cells
+        subCellCenters.clear();
+        for (const Cell& cell : refineCells) {
             double h2 = cell.getHSize() / 2;
-            cellQueue.emplace(cell.getX()-h2, cell.getY()-h2, h2, distanceToConstraints(cell.getX()-h2, cell.getY()-h2));
-            cellQueue.emplace(cell.getX()+h2, cell.getY()-h2, h2, distanceToConstraints(cell.getX()+h2, cell.getY()-h2));
-            cellQueue.emplace(cell.getX()-h2, cell.getY()+h2, h2, distanceToConstraints(cell.getX()-h2, cell.getY()+h2));
-            cellQueue.emplace(cell.getX()+h2, cell.getY()+h2, h2, distanceToConstraints(cell.getX()+h2, cell.getY()+h2));
+            subCellCenters.emplace_back(cell.getX()-h2, cell.getY()-h2);
+            subCellCenters.emplace_back(cell.getX()+h2, cell.getY()-h2);
+            subCellCenters.emplace_back(cell.getX()-h2, cell.getY()+h2);
+            subCellCenters.emplace_back(cell.getX()+h2, cell.getY()+h2);
+        }
+        subCellDistances.resize(subCellCenters.size());
+        threadPool.parallelFor(subCellCenters.size(), [&](std::size_t i) {
+            subCellDistances[i] = distanceToConstraints(subCellCenters[i].x, subCellCenters[i].y);
+        });
+        for (std::size_t i = 0; i < subCellCenters.size(); i++) {
+            double h2 = refineCells[i / 4].getHSize() / 2;
+            cellQueue.emplace(subCellCenters[i].x, subCellCenters[i].y, h2, subCellDistances[i]);
         }
     }
 
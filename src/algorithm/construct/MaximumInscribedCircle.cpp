@@ -18,6 +18,7 @@
  **********************************************************************/
 
 #include <geos/algorithm/construct/MaximumInscribedCircle.h>
+#include <geos/constants.h>
 #include <geos/geom/Coordinate.h>
 #include <geos/geom/CoordinateSequence.h>
 #include <geos/geom/Envelope.h>
@@ -29,9 +30,12 @@
 #include <geos/algorithm/locate/IndexedPointInAreaLocator.h>
 #include <geos/operation/distance/IndexedFacetDistance.h>
 #include <geos/util/Interrupt.h>
+#include <geos/util/parallel.h>
 
 #include <typeinfo> // for dynamic_cast
+#include <algorithm>
 #include <cassert>
+#include <cmath>
 
 using namespace geos::geom;
 
@@ -40,6 +44,35 @@ namespace geos {
 namespace algorithm { // geos.algorithm
 namespace construct { // geos.algorithm.construct
 
+namespace {
+
+/*
+ * Number of cells refined together when the
+ * cell distances are computed by several threads.
+ */
+constexpr std::size_t PARALLEL_BATCH_SIZE = 64;
+
+/*
+ * An upper bound on the radius of a circle inside a polygonal geometry.
+ * The circle must fit in the envelope of a polygon,
+ * and cannot have a larger area than it.
+ */
+double
+computeMaximumRadius(const Geometry* polygonal)
+{
+    double maxRadius = 0;
+    for (std::size_t i = 0; i < polygonal->getNumGeometries(); i++) {
+        const Geometry* poly = polygonal->getGeometryN(i);
+        const Envelope* env = poly->getEnvelopeInternal();
+        double envRadius = std::min(env->getWidth(), env->getHeight()) / 2;
+        double areaRadius = std::sqrt(poly->getArea() / MATH_PI);
+        maxRadius = std::max(maxRadius, std::min(envRadius, areaRadius));
+    }
+    return maxRadius;
+}
+
+} // anonymous namespace
+
 
 /* public */
 MaximumInscribedCircle::MaximumInscribedCircle(const Geometry* polygonal, double p_tolerance)
@@ -78,6 +111,25 @@ MaximumInscribedCircle::getRadiusLine(const Geometry* polygonal, double toleranc
     return mic.getRadiusLine();
 }
 
+/* public static */
+std::vector<std::unique_ptr<LineString>>
+MaximumInscribedCircle::getRadiusLines(const std::vector<const Geometry*>& polygonals,
+                                       double tolerance, std::size_t numThreads)
+{
+    //-- make sure lazily-computed envelopes are not computed concurrently
+    for (const Geometry* g : polygonals) {
+        g->getEnvelopeInternal();
+    }
+
+    std::vector<std::unique_ptr<LineString>> lines(polygonals.size());
+    util::parallelFor(polygonals.size(), numThreads, [&](std::size_t i) {
+        if (! polygonals[i]->isEmpty()) {
+            lines[i] = getRadiusLine(polygonals[i], tolerance);
+        }
+    });
+    return lines;
+}
+
 /* public static */
 std::size_t
 MaximumInscribedCircle::computeMaximumIterations(const Geometry* geom, double toleranceDist)
@@ -164,9 +216,9 @@ MaximumInscribedCircle::distanceToBoundary(double x, double y)
 MaximumInscribedCircle::Cell
 MaximumInscribedCircle::createInteriorPointCell(const Geometry* geom)
 {
-    Coordinate c;
     std::unique_ptr<Point> p = geom->getInteriorPoint();
-    Cell cell(p->getX(), p->getY(), 0, distanceToBoundary(c));
+    Coordinate c(p->getX(), p->getY());
+    Cell cell(c.x, c.y, 0, distanceToBoundary(c));
     return cell;
 }
 
@@ -185,46 +237,82 @@ MaximumInscribedCircle::compute()
 
     // use the area centroid as the initial candidate center point
     Cell farthestCell = createInteriorPointCell(inputGeom);
+    // unless the grid center is as good, which is the case for collapsed polygons
+    if (!cellQueue.empty() && cellQueue.top().getDistance() >= farthestCell.getDistance()) {
+        farthestCell = cellQueue.top();
+    }
+
+    // no circle can be larger than this, so there is no need to refine
+    // cells which cannot improve on the farthest cell by more than the tolerance
+    double maxRadius = computeMaximumRadius(inputGeom);
 
     /**
      * Carry out the branch-and-bound search
-     * of the cell space
+     * of the cell space.
+     * When using several threads the distances of the subcells of a batch
+     * of cells are computed together, otherwise cells are refined one by one.
+     * The threads are started once for the whole search.
      */
+    util::ThreadPool threadPool(numThreads);
+    std::size_t batchSize = numThreads == 1 ? 1 : PARALLEL_BATCH_SIZE;
+    std::vector<Cell> refineCells;
+    std::vector<CoordinateXY> subCellCenters;
+    std::vector<double> subCellDistances;
+
     std::size_t maxIter = computeMaximumIterations(inputGeom, tolerance);
     std::size_t iterationCount = 0;
-    while (!cellQueue.empty() && iterationCount < maxIter) {
-        // pick the most promising cell from the queue
-        Cell cell = cellQueue.top();
-        cellQueue.pop();
-//    std::cout << iterationCount << "] Dist: " << cell.getDistance() << "  size: " << cell.getHSize() << std::endl;
-
-        if ((iterationCount++ % 1000) == 0) {
-            GEOS_CHECK_FOR_INTERRUPTS();
+    bool isDone = false;
+    while (!isDone && !cellQueue.empty() && iterationCount < maxIter) {
+        refineCells.clear();
+        while (refineCells.size() < batchSize && !cellQueue.empty() && iterationCount < maxIter) {
+            //-- if cell must be closer than furthest, terminate since all remaining cells in queue are even closer.
+            //-- (unless the cells of the current batch still have to be refined)
+            if (cellQueue.top().getMaxDistance() < farthestCell.getDistance()) {
+                isDone = refineCells.empty();
+                break;
+            }
+
+            // pick the most promising cell from the queue
+            Cell cell = cellQueue.top();
+            cellQueue.pop();
+
+            if ((iterationCount++ % 1000) == 0) {
+                GEOS_CHECK_FOR_INTERRUPTS();
+            }
+
+            // update the center cell if the candidate is further from the boundary
+            if (cell.getDistance() > farthestCell.getDistance()) {
+                farthestCell = cell;
+            }
+            /**
+            * Refine this cell if the potential distance improvement
+            * is greater than the required tolerance.
+            * Otherwise the cell is pruned (not investigated further),
+            * since no point in it is further than
+            * the current farthest distance.
+            */
+            double potentialIncrease = std::min(cell.getMaxDistance(), maxRadius) - farthestCell.getDistance();
+            if (potentialIncrease > tolerance) {
+                refineCells.push_back(cell);
+            }
         }
 
-        //-- if cell must be closer than furthest, terminate since all remaining cells in queue are even closer.
-        if (cell.getMaxDistance() < farthestCell.getDistance())
-            break;
-
-        // update the center cell if the candidate is further from the boundary
-        if (cell.getDistance() > farthestCell.getDistance()) {
-            farthestCell = cell;
-        }
-        /**
-        * Refine this cell if the potential distance improvement
-        * is greater than the required tolerance.
-        * Otherwise the cell is pruned (not investigated further),
-        * since no point in it is further than
-        * the current farthest distance.
-        */
-        double potentialIncrease = cell.getMaxDistance() - farthestCell.getDistance();
-        if (potentialIncrease > tolerance) {
-            // split the cell into four sub-cells
+        // split the cells into four sub-cells
+        subCellCenters.clear();
+        for (const Cell& cell : refineCells) {
             double h2 = cell.getHSize() / 2;
-            cellQueue.emplace(cell.getX()-h2, cell.getY()-h2, h2, distanceToBoundary(cell.getX()-h2, cell.getY()-h2));
-            cellQueue.emplace(cell.getX()+h2, cell.getY()-h2, h2, distanceToBoundary(cell.getX()+h2, cell.getY()-h2));
-            cellQueue.emplace(cell.getX()-h2, cell.getY()+h2, h2, distanceToBoundary(cell.getX()-h2, cell.getY()+h2));
-            cellQueue.emplace(cell.getX()+h2, cell.getY()+h2, h2, distanceToBoundary(cell.getX()+h2, cell.getY()+h2));
+            subCellCenters.emplace_back(cell.getX()-h2, cell.getY()-h2);
+            subCellCenters.emplace_back(cell.getX()+h2, cell.getY()-h2);
+            subCellCenters.emplace_back(cell.getX()-h2, cell.getY()+h2);
+            subCellCenters.emplace_back(cell.getX()+h2, cell.getY()+h2);
+        }
+        subCellDistances.resize(subCellCenters.size());
+        threadPool.parallelFor(subCellCenters.size(), [&](std::size_t i) {
+            subCellDistances[i] = distanceToBoundary(subCellCenters[i].x, subCellCenters[i].y);
+        });
+        for (std::size_t i = 0; i < subCellCenters.size(); i++) {
+            double h2 = refineCells[i / 4].getHSize() / 2;
+            cellQueue.emplace(subCellCenters[i].x, subCellCenters[i].y, h2, subCellDistances[i]);
         }
     }
 
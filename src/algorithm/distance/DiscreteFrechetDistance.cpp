@@ -22,8 +22,13 @@
 #include <geos/geom/Geometry.h>
 #include <geos/geom/LineString.h>
 
+#include <geos/util/parallel.h>
+
 #include <typeinfo>
+#include <atomic>
 #include <cassert>
+#include <cmath>
+#include <thread>
 #include <vector>
 #include <algorithm>
 #include <limits>
@@ -34,6 +39,47 @@ namespace geos {
 namespace algorithm { // geos.algorithm
 namespace distance { // geos.algorithm.distance
 
+namespace {
+
+/*
+ * An entry of the coupling table: the discrete Frechet distance between
+ * the curves ending at P[i] and Q[j], and the pair of points realising it.
+ */
+struct Cell {
+    double distance;
+    std::size_t i;
+    std::size_t j;
+};
+
+/*
+ * Computes a table entry from its neighbours (which are null
+ * on the first row and column).
+ * Ties are resolved in the same way as the original recursive formulation.
+ */
+inline Cell
+frechetCell(const Cell* up, const Cell* diag, const Cell* left, const Cell& here)
+{
+    if (up && left) {
+        const Cell* minCell = (up->distance < diag->distance) ? up : diag;
+        if (left->distance < minCell->distance) {
+            minCell = left;
+        }
+        return (minCell->distance > here.distance) ? *minCell : here;
+    }
+    const Cell* prev = up ? up : left;
+    if (prev) {
+        return (prev->distance > here.distance) ? *prev : here;
+    }
+    return here;
+}
+
+/*
+ * Minimum number of columns in a strip computed by one thread.
+ */
+constexpr std::size_t MIN_STRIP_WIDTH = 256;
+
+} // anonymous namespace
+
 /* static public */
 double
 DiscreteFrechetDistance::distance(const geom::Geometry& g0,
@@ -99,40 +145,6 @@ DiscreteFrechetDistance::getSegmentAt(const CoordinateSequence& seq, std::size_t
     }
 }
 
-PointPairDistance&
-DiscreteFrechetDistance::getFrechetDistance(std::vector< std::vector<PointPairDistance> >& ca, std::size_t i, std::size_t j,
-        const CoordinateSequence& p, const CoordinateSequence& q)
-{
-    PointPairDistance p_ptDist;
-    if(! ca[i][j].getIsNull()) {
-        return ca[i][j];
-    }
-    p_ptDist.initialize(getSegmentAt(p, i), getSegmentAt(q, j));
-    if(i == 0 && j == 0) {
-        ca[i][j] = p_ptDist;
-    }
-    else if(i > 0 && j == 0) {
-        PointPairDistance nextDist = getFrechetDistance(ca, i - 1, 0, p, q);
-        ca[i][j] = (nextDist.getDistance() > p_ptDist.getDistance()) ? nextDist : p_ptDist;
-    }
-    else if(i == 0 && j > 0) {
-        PointPairDistance nextDist = getFrechetDistance(ca, 0, j - 1, p, q);
-        ca[i][j] = (nextDist.getDistance() > p_ptDist.getDistance()) ? nextDist : p_ptDist;
-    }
-    else {
-        PointPairDistance d1 = getFrechetDistance(ca, i - 1, j, p, q),
-                          d2 = getFrechetDistance(ca, i - 1, j - 1, p, q),
-                          d3 = getFrechetDistance(ca, i, j - 1, p, q);
-        PointPairDistance& minDist = (d1.getDistance() < d2.getDistance()) ? d1 : d2;
-        if(d3.getDistance() < minDist.getDistance()) {
-            minDist = d3;
-        }
-        ca[i][j] = (minDist.getDistance() > p_ptDist.getDistance()) ? minDist : p_ptDist;
-    }
-
-    return ca[i][j];
-}
-
 void
 DiscreteFrechetDistance::compute(
     const geom::Geometry& discreteGeom,
@@ -154,13 +166,84 @@ DiscreteFrechetDistance::compute(
         pSize = lp->size();
         qSize = lq->size();
     }
-    std::vector< std::vector<PointPairDistance> > ca(pSize, std::vector<PointPairDistance>(qSize));
+    std::vector<CoordinateXY> p(pSize);
+    std::vector<CoordinateXY> q(qSize);
     for(std::size_t i = 0; i < pSize; i++) {
-        for(std::size_t j = 0; j < qSize; j++) {
-            ca[i][j].initialize();
-        }
+        p[i] = getSegmentAt(*lp, i);
     }
-    ptDist = getFrechetDistance(ca, pSize - 1, qSize - 1, *lp, *lq);
+    for(std::size_t j = 0; j < qSize; j++) {
+        q[j] = getSegmentAt(*lq, j);
+    }
+
+    std::size_t numStrips = numThreads == 0 ? util::defaultThreadCount() : numThreads;
+    numStrips = std::max<std::size_t>(1, std::min(numStrips, qSize / MIN_STRIP_WIDTH));
+
+    // the last column of each strip is kept for the strip on its right,
+    // which may only compute row i once the strip on its left has done so
+    std::vector<std::vector<Cell>> stripEdge(numStrips - 1, std::vector<Cell>(pSize));
+    std::vector<std::atomic<std::size_t>> numRowsDone(numStrips);
+    std::atomic<bool> isFailed(false);
+    Cell result{0, 0, 0};
+
+    auto computeStrip = [&](std::size_t s) {
+        std::size_t j0 = s * qSize / numStrips;
+        std::size_t j1 = (s + 1) * qSize / numStrips;
+        std::vector<Cell> prevRow(j1 - j0);
+        std::vector<Cell> row(j1 - j0);
+
+        for(std::size_t i = 0; i < pSize; i++) {
+            if(s > 0) {
+                while(numRowsDone[s - 1].load(std::memory_order_acquire) <= i) {
+                    if(isFailed.load(std::memory_order_relaxed)) {
+                        return;
+                    }
+                    std::this_thread::yield();
+                }
+            }
+
+            for(std::size_t j = j0; j < j1; j++) {
+                std::size_t k = j - j0;
+                const Cell* up = nullptr;
+                const Cell* diag = nullptr;
+                const Cell* left = nullptr;
+                if(i > 0) {
+                    up = &prevRow[k];
+                }
+                if(k > 0) {
+                    left = &row[k - 1];
+                    diag = i > 0 ? &prevRow[k - 1] : nullptr;
+                }
+                else if(s > 0) {
+                    left = &stripEdge[s - 1][i];
+                    diag = i > 0 ? &stripEdge[s - 1][i - 1] : nullptr;
+                }
+                Cell here{std::sqrt(p[i].distanceSquared(q[j])), i, j};
+                row[k] = frechetCell(up, diag, left, here);
+            }
+
+            if(s + 1 < numStrips) {
+                stripEdge[s][i] = row.back();
+                numRowsDone[s].store(i + 1, std::memory_order_release);
+            }
+            std::swap(prevRow, row);
+        }
+
+        if(s + 1 == numStrips) {
+            result = prevRow.back();
+        }
+    };
+
+    util::parallelFor(numStrips, numStrips, [&](std::size_t s) {
+        try {
+            computeStrip(s);
+        }
+        catch(...) {
+            isFailed = true;
+            throw;
+        }
+    });
+
+    ptDist.initialize(p[result.i], q[result.j]);
 }
 
 } // namespace geos.algorithm.distance
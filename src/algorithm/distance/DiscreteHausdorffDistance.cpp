@@ -18,9 +18,16 @@
 
 #include <geos/algorithm/distance/DiscreteHausdorffDistance.h>
 #include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/Envelope.h>
+#include <geos/geom/LineSegment.h>
+#include <geos/index/strtree/TemplateSTRtree.h>
+#include <geos/util/parallel.h>
 
 #include <typeinfo>
+#include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <cmath>
 #include <limits>
 
 using namespace geos::geom;
@@ -29,6 +36,276 @@ namespace geos {
 namespace algorithm { // geos.algorithm
 namespace distance { // geos.algorithm.distance
 
+namespace {
+
+/*
+ * Number of discrete points handled by a unit of work.
+ */
+constexpr std::size_t BLOCK_SIZE = 1024;
+
+/*
+ * Collects the coordinate sequences of a geometry, in traversal order.
+ */
+class SequenceCollector : public CoordinateSequenceFilter {
+public:
+    void
+    filter_ro(const CoordinateSequence& seq, std::size_t i) override
+    {
+        if (i == 0) {
+            seqs.push_back(&seq);
+        }
+    }
+
+    bool isGeometryChanged() const override { return false; }
+
+    bool isDone() const override { return false; }
+
+    std::vector<const CoordinateSequence*> seqs;
+};
+
+std::vector<const CoordinateSequence*>
+getSequences(const Geometry& g)
+{
+    SequenceCollector collector;
+    g.apply_ro(collector);
+    return std::move(collector.seqs);
+}
+
+/*
+ * A segment of a geometry, or a point if both ends are the same.
+ */
+struct Facet {
+    const CoordinateXY* p0;
+    const CoordinateXY* p1;
+
+    double
+    distanceSquared(const CoordinateXY& pt, CoordinateXY& closestPt) const
+    {
+        if (p0 == p1) {
+            closestPt = *p0;
+        }
+        else {
+            LineSegment(p0->x, p0->y, p1->x, p1->y).closestPoint(pt, closestPt);
+        }
+        return closestPt.distanceSquared(pt);
+    }
+};
+
+struct FacetPointDistance {
+    double
+    operator()(const Facet* facet, const Facet* pt) const
+    {
+        CoordinateXY closestPt;
+        return std::sqrt(facet->distanceSquared(*pt->p0, closestPt));
+    }
+};
+
+/*
+ * An STRtree of the facets of a geometry, giving the same distances
+ * as DistanceToPoint.
+ * Once constructed, it may be queried concurrently.
+ */
+class FacetIndex {
+public:
+    explicit FacetIndex(const Geometry& g)
+        : tree(10, g.getNumPoints())
+    {
+        for (const CoordinateSequence* seq : getSequences(g)) {
+            if (seq->size() == 1) {
+                const CoordinateXY* p = &seq->getAt<CoordinateXY>(0);
+                facets.push_back(Facet{p, p});
+            }
+            for (std::size_t i = 1; i < seq->size(); i++) {
+                facets.push_back(Facet{&seq->getAt<CoordinateXY>(i - 1), &seq->getAt<CoordinateXY>(i)});
+            }
+        }
+        for (const Facet& f : facets) {
+            tree.insert(Envelope(*f.p0, *f.p1), &f);
+        }
+        tree.build();
+    }
+
+    /*
+     * Tests whether a point is closer than a squared distance to some facet.
+     * The hint facet is tested first, and is set to the facet found.
+     */
+    bool
+    isCloserThanSquared(const CoordinateXY& pt, double distSq, const Facet*& hint)
+    {
+        return findFacet(pt, std::sqrt(distSq), hint, [distSq](double d) {
+            return d < distSq;
+        });
+    }
+
+    /*
+     * Tests whether a point is within a distance of some facet.
+     * The hint facet is tested first, and is set to the facet found.
+     */
+    bool
+    isWithinDistance(const CoordinateXY& pt, double distance, const Facet*& hint)
+    {
+        //-- compared unsquared, to agree exactly with the computed distance
+        return findFacet(pt, distance, hint, [distance](double d) {
+            return std::sqrt(d) <= distance;
+        });
+    }
+
+    /*
+     * Computes the distance from a point to the nearest facet.
+     * If several facets are at that distance the first one is used,
+     * as DistanceToPoint does.
+     * Returns the squared distance.
+     */
+    double
+    computeDistance(const CoordinateXY& pt, PointPairDistance& ptDist, const Facet*& hint)
+    {
+        Facet query{&pt, &pt};
+        FacetPointDistance itemDist;
+        const Facet* nearest = tree.nearestNeighbour(Envelope(pt), &query, itemDist);
+
+        CoordinateXY closestPt;
+        double minDistSq = nearest->distanceSquared(pt, closestPt);
+        Envelope env(pt);
+        env.expandBy(std::sqrt(minDistSq) * (1 + 1e-12));
+        tree.query(env, [&](const Facet* f) {
+            double d = f->distanceSquared(pt, closestPt);
+            if (d < minDistSq || (d == minDistSq && f < nearest)) {
+                minDistSq = d;
+                nearest = f;
+            }
+        });
+
+        nearest->distanceSquared(pt, closestPt);
+        ptDist.initialize(closestPt, pt);
+        hint = nearest;
+        return minDistSq;
+    }
+
+private:
+    std::vector<Facet> facets;
+    index::strtree::TemplateSTRtree<const Facet*> tree;
+
+    template<typename Pred>
+    bool
+    findFacet(const CoordinateXY& pt, double queryDistance, const Facet*& hint, Pred&& isMatch)
+    {
+        CoordinateXY closestPt;
+        if (hint && isMatch(hint->distanceSquared(pt, closestPt))) {
+            return true;
+        }
+
+        Envelope env(pt);
+        env.expandBy(queryDistance);
+        bool isFound = false;
+        tree.query(env, [&](const Facet* f) {
+            if (isMatch(f->distanceSquared(pt, closestPt))) {
+                isFound = true;
+                hint = f;
+                return false;
+            }
+            return true;
+        });
+        return isFound;
+    }
+};
+
+/*
+ * The discrete points of a geometry (its vertices, followed by the
+ * points densifying its segments), split into units of work.
+ */
+class DiscretePoints {
+public:
+    DiscretePoints(const Geometry& g, std::size_t p_numSubSegs)
+        : seqs(getSequences(g))
+        , numSubSegs(p_numSubSegs)
+    {
+        std::size_t numVertices = 0;
+        for (const CoordinateSequence* seq : seqs) {
+            seqStarts.push_back(numVertices);
+            numVertices += seq->size();
+        }
+        numVertexUnits = (numVertices + BLOCK_SIZE - 1) / BLOCK_SIZE;
+        numUnits = numVertexUnits;
+        if (numSubSegs > 1) {
+            segsPerUnit = std::max<std::size_t>(1, BLOCK_SIZE / numSubSegs);
+            numUnits += (numVertices + segsPerUnit - 1) / segsPerUnit;
+        }
+        totalVertices = numVertices;
+    }
+
+    std::size_t
+    getNumUnits() const
+    {
+        return numUnits;
+    }
+
+    /*
+     * Passes the points of a unit to a function,
+     * until it returns false.
+     */
+    template<typename F>
+    bool
+    visit(std::size_t unit, F&& fn) const
+    {
+        bool isDensified = unit >= numVertexUnits;
+        std::size_t start = isDensified ? (unit - numVertexUnits) * segsPerUnit : unit * BLOCK_SIZE;
+        std::size_t end = std::min(totalVertices, start + (isDensified ? segsPerUnit : BLOCK_SIZE));
+
+        std::size_t s = static_cast<std::size_t>(
+                            std::upper_bound(seqStarts.begin(), seqStarts.end(), start) - seqStarts.begin()) - 1;
+        for (std::size_t v = start; v < end; v++) {
+            while (v - seqStarts[s] >= seqs[s]->size()) {
+                s++;
+            }
+            const CoordinateSequence& seq = *seqs[s];
+            std::size_t i = v - seqStarts[s];
+
+            if (! isDensified) {
+                if (! fn(seq.getAt<CoordinateXY>(i))) {
+                    return false;
+                }
+                continue;
+            }
+
+            //-- the segment ending at each vertex, excluding the vertices themselves
+            if (i == 0) {
+                continue;
+            }
+            const CoordinateXY& p0 = seq.getAt<CoordinateXY>(i - 1);
+            const CoordinateXY& p1 = seq.getAt<CoordinateXY>(i);
+            double delx = (p1.x - p0.x) / static_cast<double>(numSubSegs);
+            double dely = (p1.y - p0.y) / static_cast<double>(numSubSegs);
+            for (std::size_t k = 1; k < numSubSegs; k++) {
+                CoordinateXY pt(p0.x + static_cast<double>(k) * delx,
+                                p0.y + static_cast<double>(k) * dely);
+                if (! fn(pt)) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+private:
+    std::vector<const CoordinateSequence*> seqs;
+    std::vector<std::size_t> seqStarts;
+    std::size_t numSubSegs;
+    std::size_t totalVertices = 0;
+    std::size_t numVertexUnits = 0;
+    std::size_t segsPerUnit = 1;
+    std::size_t numUnits = 0;
+};
+
+void
+atomicMax(std::atomic<double>& value, double x)
+{
+    double current = value.load(std::memory_order_relaxed);
+    while (x > current && ! value.compare_exchange_weak(current, x, std::memory_order_relaxed)) {
+    }
+}
+
+} // anonymous namespace
+
 void
 DiscreteHausdorffDistance::MaxDensifiedByFractionDistanceFilter::filter_ro(
     const geom::CoordinateSequence& seq, std::size_t index)
@@ -77,6 +354,16 @@ DiscreteHausdorffDistance::distance(const geom::Geometry& g0,
     return dist.distance();
 }
 
+/* static public */
+bool
+DiscreteHausdorffDistance::isWithinDistance(const geom::Geometry& g0,
+                                            const geom::Geometry& g1,
+                                            double maxDistance)
+{
+    DiscreteHausdorffDistance dist(g0, g1);
+    return dist.isWithinDistance(maxDistance);
+}
+
 /* public */
 
 void DiscreteHausdorffDistance::setDensifyFraction(double dFrac)
@@ -94,6 +381,26 @@ void DiscreteHausdorffDistance::setDensifyFraction(double dFrac)
     densifyFrac = dFrac;
 }
 
+/* public */
+bool
+DiscreteHausdorffDistance::isWithinDistance(double maxDistance) const
+{
+    // the distance is undefined if either geometry is empty
+    if (g0.isEmpty() || g1.isEmpty()) return false;
+
+    // every point of each geometry is within the distance of the other
+    Envelope env0(*g0.getEnvelopeInternal());
+    Envelope env1(*g1.getEnvelopeInternal());
+    env0.expandBy(maxDistance);
+    env1.expandBy(maxDistance);
+    if (! env0.covers(g1.getEnvelopeInternal()) || ! env1.covers(g0.getEnvelopeInternal())) {
+        return false;
+    }
+
+    return isOrientedWithinDistance(g0, g1, maxDistance)
+           && isOrientedWithinDistance(g1, g0, maxDistance);
+}
+
 /* private */
 void
 DiscreteHausdorffDistance::computeOrientedDistance(
@@ -104,18 +411,67 @@ DiscreteHausdorffDistance::computeOrientedDistance(
     // can't calculate distance with empty
     if (discreteGeom.isEmpty() || geom.isEmpty()) return;
 
-    MaxPointDistanceFilter distFilter(geom);
-    discreteGeom.apply_ro(&distFilter);
-    p_ptDist.setMaximum(distFilter.getMaxPointDistance());
+    FacetIndex index(geom);
+    DiscretePoints points(discreteGeom,
+                          densifyFrac > 0 ? std::size_t(util::round(1.0 / densifyFrac)) : 1);
 
-    if(densifyFrac > 0) {
-        MaxDensifiedByFractionDistanceFilter fracFilter(geom,
-                densifyFrac);
-        discreteGeom.apply_ro(fracFilter);
-        ptDist.setMaximum(fracFilter.getMaxPointDistance());
+    // Points closer to geom than the largest distance found so far (by any
+    // thread) cannot be the furthest, so their exact distance is not needed.
+    // Points at the furthest distance are never skipped, so the first one is
+    // reported whatever the number of threads.
+    std::atomic<double> maxDistSq(0.0);
+    std::vector<PointPairDistance> unitMax(points.getNumUnits());
+
+    util::parallelFor(points.getNumUnits(), numThreads, [&](std::size_t unit) {
+        const Facet* hint = nullptr;
+        PointPairDistance minPtDist;
+        points.visit(unit, [&](const CoordinateXY& pt) {
+            double distSq = maxDistSq.load(std::memory_order_relaxed);
+            if (distSq > 0 && index.isCloserThanSquared(pt, distSq, hint)) {
+                return true;
+            }
+            double ptDistSq = index.computeDistance(pt, minPtDist, hint);
+            unitMax[unit].setMaximum(minPtDist);
+            atomicMax(maxDistSq, ptDistSq);
+            return true;
+        });
+    });
+
+    for (const PointPairDistance& d : unitMax) {
+        if (! d.getIsNull()) {
+            p_ptDist.setMaximum(d);
+        }
     }
 }
 
+/* private */
+bool
+DiscreteHausdorffDistance::isOrientedWithinDistance(
+    const geom::Geometry& discreteGeom,
+    const geom::Geometry& geom,
+    double maxDistance) const
+{
+    FacetIndex index(geom);
+    DiscretePoints points(discreteGeom,
+                          densifyFrac > 0 ? std::size_t(util::round(1.0 / densifyFrac)) : 1);
+
+    std::atomic<bool> isWithin(true);
+    util::parallelFor(points.getNumUnits(), numThreads, [&](std::size_t unit) {
+        const Facet* hint = nullptr;
+        points.visit(unit, [&](const CoordinateXY& pt) {
+            if (! isWithin.load(std::memory_order_relaxed)) {
+                return false;
+            }
+            if (! index.isWithinDistance(pt, maxDistance, hint)) {
+                isWithin = false;
+                return false;
+            }
+            return true;
+        });
+    });
+    return isWithin;
+}
+
 } // namespace geos.algorithm.distance
 } // namespace geos.algorithm
 } // namespace geos
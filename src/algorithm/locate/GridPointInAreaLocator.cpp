@@ -0,0 +1,242 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/algorithm/locate/GridPointInAreaLocator.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/LineString.h>
+#include <geos/geom/util/LinearComponentExtracter.h>
+
+#include <algorithm>
+#include <cmath>
+
+using geos::geom::CoordinateSequence;
+using geos::geom::CoordinateXY;
+using geos::geom::Location;
+
+namespace geos {
+namespace algorithm {
+namespace locate {
+
+namespace {
+
+//-- the grid has about this many cells per segment, within the limits below
+constexpr std::size_t CELLS_PER_SEGMENT = 8;
+constexpr std::size_t MIN_CELLS = 256;
+constexpr std::size_t MAX_CELLS = std::size_t(1) << 22;
+
+//-- relative tolerance by which segments are expanded when marking cells,
+//-- so that rounding can never leave a point on a segment in an unmarked cell
+constexpr double CELL_TOLERANCE = 1e-6;
+constexpr double COORD_TOLERANCE = 1e-12;
+
+double
+tolerance(double cellSize, double v0, double v1)
+{
+    return CELL_TOLERANCE * cellSize
+           + COORD_TOLERANCE * std::max(std::abs(v0), std::abs(v1));
+}
+
+} // anonymous namespace
+
+//
+// public:
+//
+GridPointInAreaLocator::GridPointInAreaLocator(const geom::Geometry& g)
+    : areaGeom(g)
+    , boundaryLocator(g)
+{
+}
+
+geom::Location
+GridPointInAreaLocator::locate(const geom::CoordinateXY* /*const*/ p)
+{
+    if (! isBuilt) {
+        buildGrid();
+    }
+
+    //-- also rejects non-finite points
+    if (! extent.covers(p)) {
+        return Location::EXTERIOR;
+    }
+    if (! cells.empty()) {
+        Location loc = cells[cellRow(p->y) * numCols + cellCol(p->x)];
+        if (loc != Location::BOUNDARY) {
+            return loc;
+        }
+    }
+    return boundaryLocator.locate(p);
+}
+
+//
+// private:
+//
+void
+GridPointInAreaLocator::buildGrid()
+{
+    isBuilt = true;
+
+    geom::LineString::ConstVect lines;
+    geom::util::LinearComponentExtracter::getLines(areaGeom, lines);
+
+    std::vector<const CoordinateSequence*> rings;
+    std::size_t nsegs = 0;
+    for (const geom::LineString* line : lines) {
+        //-- only include rings of Polygons or LinearRings
+        if (! line->isClosed())
+            continue;
+
+        rings.push_back(line->getCoordinatesRO());
+        nsegs += line->getCoordinatesRO()->size() - 1;
+    }
+
+    extent = *areaGeom.getEnvelopeInternal();
+    //-- collapsed geometries are located by the boundary locator alone
+    if (extent.isNull() || extent.getWidth() <= 0 || extent.getHeight() <= 0) {
+        return;
+    }
+
+    std::size_t numCells = std::min(MAX_CELLS, std::max(MIN_CELLS, nsegs * CELLS_PER_SEGMENT));
+    double aspect = extent.getWidth() / extent.getHeight();
+    double cols = std::round(std::sqrt(static_cast<double>(numCells) * aspect));
+    cols = std::min(static_cast<double>(numCells), std::max(1.0, cols));
+    numCols = static_cast<std::size_t>(cols);
+    numRows = std::max<std::size_t>(1, numCells / numCols);
+    cellWidth = extent.getWidth() / static_cast<double>(numCols);
+    cellHeight = extent.getHeight() / static_cast<double>(numRows);
+
+    cells.assign(numCols * numRows, Location::NONE);
+    for (const CoordinateSequence* ring : rings) {
+        for (std::size_t i = 1; i < ring->size(); i++) {
+            markSegment(ring->getAt<CoordinateXY>(i - 1), ring->getAt<CoordinateXY>(i));
+        }
+    }
+    classifyCells(rings);
+}
+
+/*
+ * Marks the cells touched by a segment as boundary cells.
+ * The segment is clipped to each row of cells it crosses,
+ * and all cells in the x-range of the clipped segment are marked.
+ */
+void
+GridPointInAreaLocator::markSegment(const CoordinateXY& p0, const CoordinateXY& p1)
+{
+    double tolX = tolerance(cellWidth, p0.x, p1.x) + COORD_TOLERANCE * std::abs(p1.x - p0.x);
+    double tolY = tolerance(cellHeight, p0.y, p1.y);
+
+    double minY = std::min(p0.y, p1.y);
+    double maxY = std::max(p0.y, p1.y);
+    std::size_t minRow = cellRow(minY - tolY);
+    std::size_t maxRow = cellRow(maxY + tolY);
+
+    for (std::size_t row = minRow; row <= maxRow; row++) {
+        double x0 = p0.x;
+        double x1 = p1.x;
+        if (p0.y != p1.y) {
+            double rowMinY = extent.getMinY() + static_cast<double>(row) * cellHeight - tolY;
+            double rowMaxY = rowMinY + cellHeight + 2 * tolY;
+            double t0 = (std::max(minY, rowMinY) - p0.y) / (p1.y - p0.y);
+            double t1 = (std::min(maxY, rowMaxY) - p0.y) / (p1.y - p0.y);
+            t0 = std::min(1.0, std::max(0.0, t0));
+            t1 = std::min(1.0, std::max(0.0, t1));
+            x0 = p0.x + t0 * (p1.x - p0.x);
+            x1 = p0.x + t1 * (p1.x - p0.x);
+        }
+        std::size_t minCol = cellCol(std::min(x0, x1) - tolX);
+        std::size_t maxCol = cellCol(std::max(x0, x1) + tolX);
+        for (std::size_t col = minCol; col <= maxCol; col++) {
+            cells[row * numCols + col] = Location::BOUNDARY;
+        }
+    }
+}
+
+/*
+ * Locates the centre of each unmarked cell by counting the crossings
+ * of the geometry rings with a horizontal line through the row centres.
+ * Unmarked cells are not touched by any segment,
+ * so all of their points have the same location as their centre.
+ */
+void
+GridPointInAreaLocator::classifyCells(const std::vector<const CoordinateSequence*>& rings)
+{
+    auto rowCentreY = [this](std::size_t row) {
+        return extent.getMinY() + (static_cast<double>(row) + 0.5) * cellHeight;
+    };
+
+    std::vector<std::vector<double>> rowCrossings(numRows);
+    for (const CoordinateSequence* ring : rings) {
+        for (std::size_t i = 1; i < ring->size(); i++) {
+            const CoordinateXY& p0 = ring->getAt<CoordinateXY>(i - 1);
+            const CoordinateXY& p1 = ring->getAt<CoordinateXY>(i);
+            if (p0.y == p1.y) {
+                continue;
+            }
+            std::size_t minRow = cellRow(std::min(p0.y, p1.y));
+            std::size_t maxRow = cellRow(std::max(p0.y, p1.y));
+            for (std::size_t row = minRow; row <= maxRow; row++) {
+                double y = rowCentreY(row);
+                if ((p0.y > y) != (p1.y > y)) {
+                    rowCrossings[row].push_back(p0.x + (y - p0.y) * (p1.x - p0.x) / (p1.y - p0.y));
+                }
+            }
+        }
+    }
+
+    for (std::size_t row = 0; row < numRows; row++) {
+        std::vector<double>& crossings = rowCrossings[row];
+        std::sort(crossings.begin(), crossings.end());
+
+        std::size_t numLeft = 0;
+        for (std::size_t col = 0; col < numCols; col++) {
+            Location& loc = cells[row * numCols + col];
+            if (loc == Location::BOUNDARY) {
+                continue;
+            }
+            double x = extent.getMinX() + (static_cast<double>(col) + 0.5) * cellWidth;
+            while (numLeft < crossings.size() && crossings[numLeft] < x) {
+                numLeft++;
+            }
+            loc = (numLeft % 2 == 1) ? Location::INTERIOR : Location::EXTERIOR;
+        }
+    }
+}
+
+std::size_t
+GridPointInAreaLocator::cellCol(double x) const
+{
+    double col = std::floor((x - extent.getMinX()) / cellWidth);
+    if (col <= 0) {
+        return 0;
+    }
+    if (col >= static_cast<double>(numCols - 1)) {
+        return numCols - 1;
+    }
+    return static_cast<std::size_t>(col);
+}
+
+std::size_t
+GridPointInAreaLocator::cellRow(double y) const
+{
+    double row = std::floor((y - extent.getMinY()) / cellHeight);
+    if (row <= 0) {
+        return 0;
+    }
+    if (row >= static_cast<double>(numRows - 1)) {
+        return numRows - 1;
+    }
+    return static_cast<std::size_t>(row);
+}
+
+} // geos::algorithm::locate
+} // geos::algorithm
+} // geos
@@ -116,7 +116,7 @@ CoverageSimplifier::simplifyEdges(
 {
     std::unique_ptr<MultiLineString> lines = CoverageEdge::createLines(edges, m_geomFactory);
     std::vector<bool> freeRings = getFreeRings(edges);
-    std::unique_ptr<MultiLineString> linesSimp = TPVWSimplifier::simplify(lines.get(), freeRings, constraints, tolerance);
+    std::unique_ptr<MultiLineString> linesSimp = TPVWSimplifier::simplify(lines.get(), freeRings, constraints, tolerance, m_numThreads);
     //Assert: mlsSimp.getNumGeometries = edges.length
 
     setCoordinates(edges, linesSimp.get());
@@ -18,7 +18,10 @@
 #include <geos/geom/GeometryCollection.h>
 #include <geos/geom/GeometryFactory.h>
 #include <geos/operation/overlayng/CoverageUnion.h>
-//#include <geos/shape/fractal/HilbertEncoder.h>
+#include <geos/shape/fractal/HilbertEncoder.h>
+#include <geos/util/parallel.h>
+
+#include <algorithm>
 
 using geos::geom::Geometry;
 using geos::geom::GeometryCollection;
@@ -28,6 +31,9 @@ using geos::geom::GeometryFactory;
 namespace geos {     // geos
 namespace coverage { // geos.coverage
 
+//-- groups must be large enough to make partial unions worthwhile
+static constexpr std::size_t MIN_GROUP_SIZE = 16;
+
 
 /* public static */
 std::unique_ptr<Geometry>
@@ -58,5 +64,54 @@ CoverageUnion::Union(const Geometry* coverage)
 }
 
 
+/* public static */
+std::unique_ptr<Geometry>
+CoverageUnion::Union(std::vector<const Geometry*>& coverage, std::size_t numThreads)
+{
+    if (numThreads == 0)
+        numThreads = util::defaultThreadCount();
+
+    std::size_t numGroups = std::min(numThreads, coverage.size() / MIN_GROUP_SIZE);
+    if (numGroups <= 1)
+        return Union(coverage);
+
+    std::vector<const Geometry*> sorted(coverage);
+    shape::fractal::HilbertEncoder::sort(sorted.begin(), sorted.end());
+
+    const GeometryFactory* geomFact = coverage[0]->getFactory();
+    std::vector<std::unique_ptr<Geometry>> groupUnions(numGroups);
+    util::parallelFor(numGroups, numThreads, [&](std::size_t g) {
+        auto start = sorted.begin() + static_cast<std::ptrdiff_t>(g * sorted.size() / numGroups);
+        auto end = sorted.begin() + static_cast<std::ptrdiff_t>((g + 1) * sorted.size() / numGroups);
+        std::vector<const Geometry*> group(start, end);
+        std::unique_ptr<GeometryCollection> geoms(geomFact->createGeometryCollection(group));
+        groupUnions[g] = operation::overlayng::CoverageUnion::geomunion(geoms.get());
+    });
+
+    //-- the group unions form a coverage, so can be merged by a coverage union
+    std::unique_ptr<GeometryCollection> merged(geomFact->createGeometryCollection(std::move(groupUnions)));
+    return operation::overlayng::CoverageUnion::geomunion(merged.get());
+}
+
+
+/* public static */
+std::unique_ptr<Geometry>
+CoverageUnion::Union(const Geometry* coverage, std::size_t numThreads)
+{
+    if (numThreads == 1 || coverage == nullptr
+        || coverage->getNumGeometries() < 2 * MIN_GROUP_SIZE) {
+        return Union(coverage);
+    }
+    if (dynamic_cast<const GeometryCollection*>(coverage) == nullptr)
+        return nullptr;
+
+    std::vector<const Geometry*> geoms;
+    for (std::size_t i = 0; i < coverage->getNumGeometries(); i++) {
+        geoms.push_back(coverage->getGeometryN(i));
+    }
+    return Union(geoms, numThreads);
+}
+
+
 } // namespace geos.coverage
 } // namespace geos
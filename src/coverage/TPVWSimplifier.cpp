@@ -24,6 +24,9 @@
 #include <geos/geom/MultiLineString.h>
 
 #include <geos/simplify/LinkedLine.h>
+#include <geos/util/parallel.h>
+
+#include <algorithm>
 
 using geos::geom::Coordinate;
 using geos::geom::Envelope;
@@ -60,11 +63,13 @@ TPVWSimplifier::simplify(
     const MultiLineString* p_lines,
     std::vector<bool>& p_freeRings,
     const MultiLineString* p_constraintLines,
-    double distanceTolerance)
+    double distanceTolerance,
+    std::size_t numThreads)
 {
     TPVWSimplifier simp(p_lines, distanceTolerance);
     simp.setFreeRingIndices(p_freeRings);
     simp.setConstraints(p_constraintLines);
+    simp.setNumThreads(numThreads);
     std::unique_ptr<MultiLineString> result = simp.simplify();
     return result;
 }
@@ -78,6 +83,7 @@ TPVWSimplifier::TPVWSimplifier(
     , areaTolerance(distanceTolerance*distanceTolerance)
     , geomFactory(inputLines->getFactory())
     , constraintLines(nullptr)
+    , numThreads(1)
     {}
 
 
@@ -109,6 +115,14 @@ TPVWSimplifier::simplify()
     edgeIndex.add(constraintEdges);
 
     std::vector<std::unique_ptr<LineString>> result;
+    if (numThreads != 1 && edges.size() > 1) {
+        std::vector<std::unique_ptr<CoordinateSequence>> ptsSimp = simplifyParallel(edges, edgeIndex);
+        for (auto& pts : ptsSimp) {
+            result.push_back(geomFactory->createLineString(std::move(pts)));
+        }
+        return geomFactory->createMultiLineString(std::move(result));
+    }
+
     for (auto& edge : edges) {
         std::unique_ptr<CoordinateSequence> ptsSimp = edge.simplify(edgeIndex);
         auto ls = geomFactory->createLineString(std::move(ptsSimp));
@@ -117,6 +131,51 @@ TPVWSimplifier::simplify()
     return geomFactory->createMultiLineString(std::move(result));
 }
 
+/* private */
+std::vector<std::unique_ptr<CoordinateSequence>>
+TPVWSimplifier::simplifyParallel(
+    std::vector<Edge>& edges,
+    EdgeIndex& edgeIndex)
+{
+    //-- the index is queried concurrently, so must be built up front
+    edgeIndex.index.build();
+
+    /**
+     * Simplifying an edge only inspects and modifies edges whose envelopes
+     * intersect its own. Edges are greedily coloured so that edges of the
+     * same colour have disjoint envelopes, and can be simplified concurrently.
+     */
+    TemplateSTRtree<std::size_t> envIndex;
+    for (std::size_t i = 0; i < edges.size(); i++) {
+        envIndex.insert(*edges[i].getEnvelopeInternal(), i);
+    }
+    std::vector<std::size_t> color(edges.size());
+    std::vector<std::vector<std::size_t>> colorEdges;
+    std::vector<bool> isColorUsed;
+    for (std::size_t i = 0; i < edges.size(); i++) {
+        isColorUsed.assign(colorEdges.size(), false);
+        envIndex.query(*edges[i].getEnvelopeInternal(), [&](std::size_t j) {
+            if (j < i)
+                isColorUsed[color[j]] = true;
+        });
+        std::size_t c = static_cast<std::size_t>(
+            std::find(isColorUsed.begin(), isColorUsed.end(), false) - isColorUsed.begin());
+        if (c == colorEdges.size())
+            colorEdges.emplace_back();
+        color[i] = c;
+        colorEdges[c].push_back(i);
+    }
+
+    std::vector<std::unique_ptr<CoordinateSequence>> ptsSimp(edges.size());
+    for (const auto& group : colorEdges) {
+        util::parallelFor(group.size(), numThreads, [&](std::size_t k) {
+            std::size_t i = group[k];
+            ptsSimp[i] = edges[i].simplify(edgeIndex);
+        });
+    }
+    return ptsSimp;
+}
+
 /* private */
 std::vector<Edge>
 TPVWSimplifier::createEdges(
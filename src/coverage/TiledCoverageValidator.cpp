@@ -0,0 +1,208 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/coverage/TiledCoverageValidator.h>
+#include <geos/coverage/CoveragePolygonValidator.h>
+
+#include <geos/geom/Geometry.h>
+#include <geos/index/strtree/TemplateSTRtree.h>
+#include <geos/shape/fractal/HilbertEncoder.h>
+#include <geos/util/IllegalArgumentException.h>
+#include <geos/util/parallel.h>
+
+#include <algorithm>
+
+using geos::geom::Envelope;
+using geos::geom::Geometry;
+using geos::index::strtree::TemplateSTRtree;
+using geos::shape::fractal::HilbertEncoder;
+
+namespace geos {     // geos
+namespace coverage { // geos.coverage
+
+/* public */
+TiledCoverageValidator::TiledCoverageValidator(std::vector<Envelope> envelopes, GeometryLoader loader)
+    : m_envelopes(std::move(envelopes))
+    , m_loader(std::move(loader))
+{}
+
+/* public */
+TiledCoverageValidator::TiledCoverageValidator(const std::vector<const Geometry*>& coverage)
+    : m_coverage(coverage)
+{
+    m_envelopes.reserve(coverage.size());
+    for (const Geometry* geom : coverage) {
+        m_envelopes.push_back(*geom->getEnvelopeInternal());
+    }
+}
+
+/* private */
+std::vector<std::size_t>
+TiledCoverageValidator::hilbertOrder() const
+{
+    Envelope extent;
+    for (const Envelope& env : m_envelopes) {
+        extent.expandToInclude(env);
+    }
+
+    std::vector<std::uint32_t> codes(m_envelopes.size(), 0);
+    if (! extent.isNull()) {
+        HilbertEncoder encoder(12, extent);
+        for (std::size_t i = 0; i < m_envelopes.size(); i++) {
+            if (! m_envelopes[i].isNull())
+                codes[i] = encoder.encode(&m_envelopes[i]);
+        }
+    }
+
+    std::vector<std::size_t> order(m_envelopes.size());
+    for (std::size_t i = 0; i < order.size(); i++) {
+        order[i] = i;
+    }
+    std::stable_sort(order.begin(), order.end(), [&codes](std::size_t a, std::size_t b) {
+        return codes[a] < codes[b];
+    });
+    return order;
+}
+
+/* private */
+Envelope
+TiledCoverageValidator::queryEnvelope(std::size_t index) const
+{
+    Envelope env = m_envelopes[index];
+    env.expandBy(m_gapWidth);
+    return env;
+}
+
+/* private */
+const Geometry*
+TiledCoverageValidator::getGeometry(std::size_t index)
+{
+    auto it = resident.find(index);
+    if (it != resident.end())
+        return it->second.geom;
+
+    Element elem;
+    if (! m_loader) {
+        elem.geom = m_coverage[index];
+    }
+    else {
+        elem.owned = m_loader(index);
+        if (elem.owned == nullptr) {
+            throw util::IllegalArgumentException("Coverage loader returned null geometry");
+        }
+        elem.geom = elem.owned.get();
+    }
+    //-- ensure lazily-computed envelopes are cached before concurrent use
+    elem.geom->getEnvelopeInternal();
+    const Geometry* geom = elem.geom;
+    resident.emplace(index, std::move(elem));
+    m_maxResident = std::max(m_maxResident, resident.size());
+    return geom;
+}
+
+/* public */
+bool
+TiledCoverageValidator::validate(const InvalidHandler& handler)
+{
+    std::size_t n = m_envelopes.size();
+    resident.clear();
+    m_maxResident = 0;
+
+    std::vector<std::size_t> order = hilbertOrder();
+    std::size_t numBatches = (n + m_batchSize - 1) / m_batchSize;
+
+    TemplateSTRtree<std::size_t> envIndex;
+    for (std::size_t i = 0; i < n; i++) {
+        if (! m_envelopes[i].isNull())
+            envIndex.insert(m_envelopes[i], i);
+    }
+
+    /**
+     * Plan which batches use each element,
+     * so that elements can be released after the last batch needing them.
+     */
+    std::vector<std::size_t> lastBatch(n, 0);
+    for (std::size_t b = 0; b < numBatches; b++) {
+        std::size_t end = std::min(n, (b + 1) * m_batchSize);
+        for (std::size_t k = b * m_batchSize; k < end; k++) {
+            std::size_t i = order[k];
+            lastBatch[i] = b;
+            envIndex.query(queryEnvelope(i), [&lastBatch, b](std::size_t j) {
+                lastBatch[j] = std::max(lastBatch[j], b);
+            });
+        }
+    }
+
+    bool isValid = true;
+    for (std::size_t b = 0; b < numBatches; b++) {
+        std::size_t start = b * m_batchSize;
+        std::size_t end = std::min(n, (b + 1) * m_batchSize);
+
+        //-- load the batch elements and their neighbours
+        std::vector<std::size_t> needed;
+        for (std::size_t k = start; k < end; k++) {
+            std::size_t i = order[k];
+            needed.push_back(i);
+            envIndex.query(queryEnvelope(i), [&needed](std::size_t j) {
+                needed.push_back(j);
+            });
+        }
+        std::sort(needed.begin(), needed.end());
+        needed.erase(std::unique(needed.begin(), needed.end()), needed.end());
+
+        TemplateSTRtree<const Geometry*> index;
+        for (std::size_t j : needed) {
+            index.insert(getGeometry(j));
+        }
+        index.build();
+
+        //-- validate batch elements
+        std::vector<std::unique_ptr<Geometry>> results(end - start);
+        std::vector<const Geometry*> targets(end - start);
+        for (std::size_t k = start; k < end; k++) {
+            targets[k - start] = getGeometry(order[k]);
+        }
+        util::parallelFor(targets.size(), m_numThreads, [&](std::size_t t) {
+            const Geometry* targetGeom = targets[t];
+            Envelope queryEnv = *(targetGeom->getEnvelopeInternal());
+            queryEnv.expandBy(m_gapWidth);
+
+            std::vector<const Geometry*> nearGeoms;
+            index.query(queryEnv, [&nearGeoms, targetGeom](const Geometry* geom) {
+                //-- the target geometry is returned in the query, so must be skipped
+                if (geom != targetGeom)
+                    nearGeoms.push_back(geom);
+            });
+            std::unique_ptr<Geometry> result = CoveragePolygonValidator::validate(targetGeom, nearGeoms, m_gapWidth);
+            if (! result->isEmpty())
+                results[t] = std::move(result);
+        });
+
+        for (std::size_t k = start; k < end; k++) {
+            std::unique_ptr<Geometry>& result = results[k - start];
+            if (result) {
+                isValid = false;
+                handler(order[k], std::move(result));
+            }
+        }
+
+        //-- release elements not needed by later batches
+        for (std::size_t j : needed) {
+            if (lastBatch[j] == b)
+                resident.erase(j);
+        }
+    }
+    return isValid;
+}
+
+} // namespace geos.coverage
+} // namespace geos
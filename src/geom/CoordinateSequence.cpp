@@ -128,8 +128,27 @@ CoordinateSequence::CoordinateSequence(const std::initializer_list<CoordinateXYZ
     add(list.begin(), list.end());
 }
 
-template<typename T>
-void fillVector(std::vector<double> & v)
+CoordinateSequence
+CoordinateSequence::wrapBuffer(const double* buf, std::size_t size, bool hasz, bool hasm,
+                               ReleaseCallback release, void* userdata)
+{
+    CoordinateSequence seq(0u, hasz, hasm);
+    if (seq.stride() != 2u + hasz + hasm) {
+        // e.g., an XY buffer cannot be read as padded XYZ coordinates
+        throw util::IllegalArgumentException("Buffer layout does not match coordinate storage");
+    }
+    if (size == 0) {
+        if (release) {
+            release(userdata);
+        }
+        return seq;
+    }
+    seq.m_vect.borrow(buf, size * seq.stride(), release, userdata);
+    return seq;
+}
+
+template<typename T, typename Vector>
+void fillVector(Vector & v)
 {
     const T c;
     T* from = reinterpret_cast<T*>(v.data());
@@ -152,7 +171,7 @@ void
 CoordinateSequence::add(const CoordinateSequence& cs, std::size_t from, std::size_t to)
 {
     if (cs.stride() == stride() && cs.hasM() == cs.hasM()) {
-        m_vect.insert(m_vect.end(),
+        m_vect.insert(m_vect.cend(),
                       std::next(cs.m_vect.cbegin(), static_cast<std::ptrdiff_t>(from * stride())),
                       std::next(cs.m_vect.cbegin(), static_cast<std::ptrdiff_t>((to + 1u)*stride())));
     } else {
@@ -255,10 +274,12 @@ CoordinateSequence::clone() const
 void
 CoordinateSequence::closeRing(bool allowRepeated)
 {
-    if(!isEmpty() && (allowRepeated || front<CoordinateXY>() != back<CoordinateXY>())) {
-        m_vect.insert(m_vect.end(),
-                      m_vect.begin(),
-                      std::next(m_vect.begin(), stride()));
+    //-- the coordinates are only read until they are inserted
+    const CoordinateSequence& pts = *this;
+    if(!isEmpty() && (allowRepeated || pts.front<CoordinateXY>() != pts.back<CoordinateXY>())) {
+        m_vect.insert(m_vect.cend(),
+                      m_vect.cbegin(),
+                      std::next(m_vect.cbegin(), stride()));
     }
 }
 
@@ -388,6 +409,7 @@ CoordinateSequence::scroll(CoordinateSequence* cl,
         return;    // not found or already first
     }
 
+    cl->m_vect.own();
     std::rotate(cl->m_vect.begin(),
         std::next(cl->m_vect.begin(), static_cast<std::ptrdiff_t>(ind * cl->stride())),
         cl->m_vect.end());
@@ -425,6 +447,7 @@ CoordinateSequence::isRing() const
 void
 CoordinateSequence::reverse()
 {
+    m_vect.own();
     auto mid = m_vect.size() / 2;
     auto last = m_vect.size() - stride();
     for (std::size_t i = 0; i < mid; i += stride()) {
@@ -441,6 +464,7 @@ CoordinateSequence::reverse()
 void
 CoordinateSequence::sort()
 {
+    m_vect.own();
     switch(getCoordinateType()) {
         case CoordinateType::XY:   std::sort(items<CoordinateXY>().begin(), items<CoordinateXY>().end()); return;
         case CoordinateType::XYZ:  std::sort(items<Coordinate>().begin(), items<Coordinate>().end()); return;
@@ -539,6 +563,7 @@ CoordinateSequence::getEnvelope() const {
 void
 CoordinateSequence::setOrdinate(std::size_t index, std::size_t ordinateIndex, double value)
 {
+    m_vect.own();
     switch(ordinateIndex) {
         case CoordinateSequence::X:
         getAt<CoordinateXY>(index).x = value;
@@ -52,7 +52,7 @@ LineString::~LineString(){}
 LineString::LineString(const LineString& ls)
     :
     Geometry(ls),
-    points(ls.points->clone()),
+    points(ls.points),
     envelope(ls.envelope)
 {
 }
@@ -62,9 +62,10 @@ LineString::LineString(CoordinateSequence::Ptr && newCoords,
                        const GeometryFactory& factory)
     :
     Geometry(&factory),
-    points(newCoords ? std::move(newCoords) : detail::make_unique<CoordinateSequence>()),
+    points(newCoords ? std::move(*newCoords) : CoordinateSequence()),
     envelope(computeEnvelopeInternal())
 {
+    newCoords.reset();
     validateConstruction();
 }
 
@@ -75,8 +76,7 @@ LineString::reverseImpl() const
         return clone().release();
     }
 
-    assert(points.get());
-    auto seq = points->clone();
+    auto seq = points.clone();
     seq->reverse();
     assert(getFactory());
     return getFactory()->createLineString(std::move(seq)).release();
@@ -87,12 +87,7 @@ LineString::reverseImpl() const
 void
 LineString::validateConstruction()
 {
-    if(points.get() == nullptr) {
-        points = detail::make_unique<CoordinateSequence>();
-        return;
-    }
-
-    if(points->size() == 1) {
+    if(points.size() == 1) {
         throw util::IllegalArgumentException("point array must contain 0 or >1 elements\n");
     }
 }
@@ -100,24 +95,21 @@ LineString::validateConstruction()
 std::unique_ptr<CoordinateSequence>
 LineString::getCoordinates() const
 {
-    assert(points.get());
-    return points->clone();
+    return points.clone();
     //return points;
 }
 
 const CoordinateSequence*
 LineString::getCoordinatesRO() const
 {
-    assert(nullptr != points.get());
-    return points.get();
+    return &points;
 }
 
 std::unique_ptr<CoordinateSequence>
 LineString::releaseCoordinates()
 {
-    auto newPts = detail::make_unique<CoordinateSequence>(0u, points->hasZ(), points->hasM());
-    auto ret = std::move(points);
-    points = std::move(newPts);
+    auto ret = detail::make_unique<CoordinateSequence>(std::move(points));
+    points = CoordinateSequence(0u, ret->hasZ(), ret->hasM());
     geometryChanged();
     return ret;
 }
@@ -125,8 +117,7 @@ LineString::releaseCoordinates()
 const Coordinate&
 LineString::getCoordinateN(std::size_t n) const
 {
-    assert(points.get());
-    return points->getAt(n);
+    return points.getAt(n);
 }
 
 Dimension::DimensionType
@@ -138,19 +129,19 @@ LineString::getDimension() const
 uint8_t
 LineString::getCoordinateDimension() const
 {
-    return (uint8_t) points->getDimension();
+    return (uint8_t) points.getDimension();
 }
 
 bool
 LineString::hasM() const
 {
-    return points->hasM();
+    return points.hasM();
 }
 
 bool
 LineString::hasZ() const
 {
-    return points->hasZ();
+    return points.hasZ();
 }
 
 int
@@ -165,23 +156,20 @@ LineString::getBoundaryDimension() const
 bool
 LineString::isEmpty() const
 {
-    assert(points.get());
-    return points->isEmpty();
+    return points.isEmpty();
 }
 
 std::size_t
 LineString::getNumPoints() const
 {
-    assert(points.get());
-    return points->getSize();
+    return points.getSize();
 }
 
 std::unique_ptr<Point>
 LineString::getPointN(std::size_t n) const
 {
     assert(getFactory());
-    assert(points.get());
-    return std::unique_ptr<Point>(getFactory()->createPoint(points->getAt(n)));
+    return std::unique_ptr<Point>(getFactory()->createPoint(points.getAt(n)));
 }
 
 std::unique_ptr<Point>
@@ -209,7 +197,7 @@ LineString::isClosed() const
         return false;
     }
 
-    return points->front<CoordinateXY>().equals2D(points->back<CoordinateXY>());
+    return points.front<CoordinateXY>().equals2D(points.back<CoordinateXY>());
 }
 
 bool
@@ -234,10 +222,9 @@ LineString::getBoundary() const
 bool
 LineString::isCoordinate(Coordinate& pt) const
 {
-    assert(points.get());
-    std::size_t npts = points->getSize();
+    std::size_t npts = points.getSize();
     for(std::size_t i = 0; i < npts; i++) {
-        if(points->getAt<CoordinateXY>(i) == pt) {
+        if(points.getAt<CoordinateXY>(i) == pt) {
             return true;
         }
     }
@@ -252,7 +239,7 @@ LineString::computeEnvelopeInternal() const
         return Envelope();
     }
 
-    return points->getEnvelope();
+    return points.getEnvelope();
 }
 
 bool
@@ -263,12 +250,12 @@ LineString::equalsExact(const Geometry* other, double tolerance) const
     }
 
     const LineString* otherLineString = detail::down_cast<const LineString*>(other);
-    std::size_t npts = points->getSize();
-    if(npts != otherLineString->points->getSize()) {
+    std::size_t npts = points.getSize();
+    if(npts != otherLineString->points.getSize()) {
         return false;
     }
     for(std::size_t i = 0; i < npts; ++i) {
-        if(!equal(points->getAt<CoordinateXY>(i), otherLineString->points->getAt<CoordinateXY>(i), tolerance)) {
+        if(!equal(points.getAt<CoordinateXY>(i), otherLineString->points.getAt<CoordinateXY>(i), tolerance)) {
             return false;
         }
     }
@@ -294,15 +281,13 @@ LineString::equalsIdentical(const Geometry* other_g) const
 void
 LineString::apply_rw(const CoordinateFilter* filter)
 {
-    assert(points.get());
-    points->apply_rw(filter);
+    points.apply_rw(filter);
 }
 
 void
 LineString::apply_ro(CoordinateFilter* filter) const
 {
-    assert(points.get());
-    points->apply_ro(filter);
+    points.apply_ro(filter);
 }
 
 void
@@ -343,7 +328,7 @@ LineString::normalizeClosed()
         coords->reverse();
     }
 
-    points = std::move(coords);
+    points = std::move(*coords);
 }
 
 /*public*/
@@ -351,18 +336,18 @@ void
 LineString::normalize()
 {
     if (isEmpty()) return;
-    assert(points.get());
     if (isClosed()) {
         normalizeClosed();
         return;
     }
-    std::size_t npts = points->getSize();
+    const CoordinateSequence& pts = points;
+    std::size_t npts = pts.getSize();
     std::size_t n = npts / 2;
     for(std::size_t i = 0; i < n; i++) {
         std::size_t j = npts - 1 - i;
-        if(!(points->getAt<CoordinateXY>(i) == points->getAt<CoordinateXY>(j))) {
-            if(points->getAt<CoordinateXY>(i).compareTo(points->getAt<CoordinateXY>(j)) > 0) {
-                points->reverse();
+        if(!(pts.getAt<CoordinateXY>(i) == pts.getAt<CoordinateXY>(j))) {
+            if(pts.getAt<CoordinateXY>(i).compareTo(pts.getAt<CoordinateXY>(j)) > 0) {
+                points.reverse();
             }
             return;
         }
@@ -375,8 +360,8 @@ LineString::compareToSameClass(const Geometry* ls) const
     const LineString* line = detail::down_cast<const LineString*>(ls);
 
     // MD - optimized implementation
-    std::size_t mynpts = points->getSize();
-    std::size_t othnpts = line->points->getSize();
+    std::size_t mynpts = points.getSize();
+    std::size_t othnpts = line->points.getSize();
     if(mynpts > othnpts) {
         return 1;
     }
@@ -384,7 +369,7 @@ LineString::compareToSameClass(const Geometry* ls) const
         return -1;
     }
     for(std::size_t i = 0; i < mynpts; i++) {
-        int cmp = points->getAt<CoordinateXY>(i).compareTo(line->points->getAt<CoordinateXY>(i));
+        int cmp = points.getAt<CoordinateXY>(i).compareTo(line->points.getAt<CoordinateXY>(i));
         if(cmp) {
             return cmp;
         }
@@ -398,13 +383,13 @@ LineString::getCoordinate() const
     if(isEmpty()) {
         return nullptr;
     }
-    return &(points->getAt<CoordinateXY>(0));
+    return &(points.getAt<CoordinateXY>(0));
 }
 
 double
 LineString::getLength() const
 {
-    return Length::ofLine(points.get());
+    return Length::ofLine(&points);
 }
 
 void
@@ -424,12 +409,14 @@ LineString::apply_ro(GeometryComponentFilter* filter) const
 void
 LineString::apply_rw(CoordinateSequenceFilter& filter)
 {
-    std::size_t npts = points->size();
+    std::size_t npts = points.size();
     if(!npts) {
         return;
     }
+    //-- filters may modify coordinates through references
+    points.own();
     for(std::size_t i = 0; i < npts; ++i) {
-        filter.filter_rw(*points, i);
+        filter.filter_rw(points, i);
         if(filter.isDone()) {
             break;
         }
@@ -442,12 +429,12 @@ LineString::apply_rw(CoordinateSequenceFilter& filter)
 void
 LineString::apply_ro(CoordinateSequenceFilter& filter) const
 {
-    std::size_t npts = points->size();
+    std::size_t npts = points.size();
     if(!npts) {
         return;
     }
     for(std::size_t i = 0; i < npts; ++i) {
-        filter.filter_ro(*points, i);
+        filter.filter_ro(points, i);
         if(filter.isDone()) {
             break;
         }
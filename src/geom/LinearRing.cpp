@@ -48,7 +48,7 @@ void
 LinearRing::validateConstruction()
 {
     // Empty ring is valid
-    if(points->isEmpty()) {
+    if(points.isEmpty()) {
         return;
     }
 
@@ -58,10 +58,10 @@ LinearRing::validateConstruction()
         );
     }
 
-    if(points->getSize() < MINIMUM_VALID_SIZE) {
+    if(points.getSize() < MINIMUM_VALID_SIZE) {
         std::ostringstream os;
         os << "Invalid number of points in LinearRing found "
-           << points->getSize() << " - must be 0 or >= " << MINIMUM_VALID_SIZE;
+           << points.getSize() << " - must be 0 or >= " << MINIMUM_VALID_SIZE;
         throw util::IllegalArgumentException(os.str());
     }
 }
@@ -75,7 +75,7 @@ LinearRing::getBoundaryDimension() const
 bool
 LinearRing::isClosed() const
 {
-    if(points->isEmpty()) {
+    if(points.isEmpty()) {
         // empty LinearRings are closed by definition
         return true;
     }
@@ -91,7 +91,7 @@ LinearRing::getGeometryType() const
 void
 LinearRing::setPoints(const CoordinateSequence* cl)
 {
-    points = cl->clone();
+    points = *cl;
 }
 
 GeometryTypeId
@@ -107,8 +107,8 @@ LinearRing::orient(bool isCW)
         return;
     }
 
-    if (algorithm::Orientation::isCCW(points.get()) == isCW) {
-        points->reverse();
+    if (algorithm::Orientation::isCCW(&points) == isCW) {
+        points.reverse();
     }
 
 }
@@ -120,8 +120,7 @@ LinearRing::reverseImpl() const
         return clone().release();
     }
 
-    assert(points.get());
-    auto seq = points->clone();
+    auto seq = points.clone();
     seq->reverse();
     assert(getFactory());
     return getFactory()->createLinearRing(std::move(seq)).release();
@@ -44,7 +44,7 @@ namespace geom { // geos::geom
 /*protected*/
 Point::Point(CoordinateSequence&& newCoords, const GeometryFactory* factory)
     : Geometry(factory)
-    , coordinates(newCoords)
+    , coordinates(std::move(newCoords))
     , envelope(computeEnvelopeInternal())
 {
     if (coordinates.getSize() > 1) {
@@ -244,6 +244,8 @@ Point::apply_rw(CoordinateSequenceFilter& filter)
     if(isEmpty()) {
         return;
     }
+    //-- filters may modify coordinates through references
+    coordinates.own();
     filter.filter_rw(coordinates, 0);
     if(filter.isGeometryChanged()) {
         geometryChanged();
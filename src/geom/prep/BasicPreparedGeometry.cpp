@@ -21,7 +21,9 @@
 #include <geos/geom/Coordinate.h>
 #include <geos/algorithm/PointLocator.h>
 #include <geos/geom/util/ComponentCoordinateExtracter.h>
+#include <geos/geom/IntersectionMatrix.h>
 #include <geos/operation/distance/DistanceOp.h>
+#include <geos/operation/relateng/RelateNG.h>
 
 namespace geos {
 namespace geom { // geos.geom
@@ -66,6 +68,15 @@ BasicPreparedGeometry::envelopeCovers(const geom::Geometry* g) const
     return baseGeom->getEnvelopeInternal()->covers(g->getEnvelopeInternal());
 }
 
+operation::relateng::RelateNG&
+BasicPreparedGeometry::getRelateNG() const
+{
+    if (relateNG == nullptr) {
+        relateNG = operation::relateng::RelateNG::prepare(baseGeom);
+    }
+    return *relateNG;
+}
+
 /*
  * public:
  */
@@ -74,6 +85,8 @@ BasicPreparedGeometry::BasicPreparedGeometry(const Geometry* geom)
     setGeometry(geom);
 }
 
+BasicPreparedGeometry::~BasicPreparedGeometry() = default;
+
 bool
 BasicPreparedGeometry::isAnyTargetComponentInTest(const geom::Geometry* testGeom) const
 {
@@ -176,6 +189,18 @@ BasicPreparedGeometry::isWithinDistance(const geom::Geometry* g, double dist) co
     return baseGeom->isWithinDistance(g, dist);
 }
 
+std::unique_ptr<geom::IntersectionMatrix>
+BasicPreparedGeometry::relate(const geom::Geometry* g) const
+{
+    return getRelateNG().evaluate(g);
+}
+
+bool
+BasicPreparedGeometry::relate(const geom::Geometry* g, const std::string& pattern) const
+{
+    return getRelateNG().evaluate(g, pattern);
+}
+
 std::string
 BasicPreparedGeometry::toString()
 {
@@ -61,7 +61,7 @@ PreparedGeometryFactory::create(const geom::Geometry* g) const
 
     case GEOS_POLYGON:
     case GEOS_MULTIPOLYGON:
-        pg.reset(new PreparedPolygon(g));
+        pg.reset(new PreparedPolygon(g, useGridLocator));
         break;
 
     default:
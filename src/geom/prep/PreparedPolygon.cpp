@@ -29,6 +29,7 @@
 #include <geos/operation/predicate/RectangleContains.h>
 #include <geos/operation/predicate/RectangleIntersects.h>
 #include <geos/algorithm/locate/PointOnGeometryLocator.h>
+#include <geos/algorithm/locate/GridPointInAreaLocator.h>
 #include <geos/algorithm/locate/IndexedPointInAreaLocator.h>
 #include <geos/algorithm/locate/SimplePointInAreaLocator.h>
 // std
@@ -40,8 +41,9 @@ namespace prep { // geos.geom.prep
 //
 // public:
 //
-PreparedPolygon::PreparedPolygon(const geom::Geometry* geom)
+PreparedPolygon::PreparedPolygon(const geom::Geometry* geom, bool p_useGridLocator)
     : BasicPreparedGeometry(geom)
+    , useGridLocator(p_useGridLocator)
 {
     isRectangle = getGeometry().isRectangle();
 }
@@ -77,7 +79,11 @@ getPointLocator() const
         ptOnGeomLoc = detail::make_unique<algorithm::locate::SimplePointInAreaLocator>(&getGeometry());
         return ptOnGeomLoc.get();
     } else if (!indexedPtOnGeomLoc) {
-        indexedPtOnGeomLoc = detail::make_unique<algorithm::locate::IndexedPointInAreaLocator>(getGeometry());
+        if (useGridLocator) {
+            indexedPtOnGeomLoc = detail::make_unique<algorithm::locate::GridPointInAreaLocator>(getGeometry());
+        } else {
+            indexedPtOnGeomLoc = detail::make_unique<algorithm::locate::IndexedPointInAreaLocator>(getGeometry());
+        }
     }
 
     return indexedPtOnGeomLoc.get();
@@ -13,10 +13,13 @@
  **********************************************************************/
 
 #include <geos/index/kdtree/KdTree.h>
+#include <geos/geom/CoordinateSequence.h>
 #include <geos/geom/Envelope.h>
 
 #include <vector>
 #include <algorithm>
+#include <cmath>
+#include <numeric>
 #include <stack>
 
 using namespace geos::geom;
@@ -25,6 +28,121 @@ namespace geos {
 namespace index { // geos.index
 namespace kdtree { // geos.index.kdtree
 
+namespace {
+
+/*
+ * Orders point indexes so that the median (by X then Y, alternating)
+ * of each range precedes the two sub-ranges on either side of it.
+ * The median is chosen as the lowest point of the upper part of the range,
+ * so that points equal to it in the splitting ordinate fall
+ * to its right, matching the insertion rule in KdTree::insertExact.
+ */
+template<typename GetPt>
+std::vector<std::size_t>
+computeBalancedOrder(std::size_t n, GetPt getPt)
+{
+    struct Range {
+        std::size_t lo;
+        std::size_t hi;
+        bool odd;
+    };
+
+    std::vector<std::size_t> idx(n);
+    std::iota(idx.begin(), idx.end(), 0);
+    std::vector<std::size_t> order;
+    order.reserve(n);
+
+    std::vector<Range> ranges;
+    ranges.push_back({0, n, true});
+    while (!ranges.empty()) {
+        Range r = ranges.back();
+        ranges.pop_back();
+        if (r.lo >= r.hi) continue;
+
+        auto ord = [&getPt, &r](std::size_t i) {
+            const CoordinateXY& p = getPt(i);
+            return r.odd ? p.x : p.y;
+        };
+        auto first = idx.begin() + static_cast<std::ptrdiff_t>(r.lo);
+        auto last = idx.begin() + static_cast<std::ptrdiff_t>(r.hi);
+        auto mid = first + static_cast<std::ptrdiff_t>((r.hi - r.lo) / 2);
+        std::nth_element(first, mid, last, [&ord](std::size_t a, std::size_t b) {
+            return ord(a) < ord(b);
+        });
+        double split = ord(*mid);
+
+        auto pivot = std::partition(first, last, [&ord, split](std::size_t i) {
+            return ord(i) < split;
+        });
+        auto median = std::find_if(pivot, last, [&ord, split](std::size_t i) {
+            return ord(i) == split;
+        });
+        if (median == last) {
+            // only possible for NaN ordinates
+            median = pivot;
+        }
+        std::iter_swap(pivot, median);
+
+        order.push_back(*pivot);
+        std::size_t p = static_cast<std::size_t>(pivot - idx.begin());
+        ranges.push_back({p + 1, r.hi, !r.odd});
+        ranges.push_back({r.lo, p, !r.odd});
+    }
+    return order;
+}
+
+/*
+ * Orders candidate nodes by distance, then by coordinate,
+ * so that nearest-neighbour results are deterministic.
+ */
+bool
+isNearer(const std::pair<double, KdNode*>& a, const std::pair<double, KdNode*>& b)
+{
+    if (a.first != b.first) {
+        return a.first < b.first;
+    }
+    return a.second->getCoordinate().compareTo(b.second->getCoordinate()) < 0;
+}
+
+class RadiusVisitor : public KdNodeVisitor {
+public:
+    RadiusVisitor(const CoordinateXY& p_center, double p_radius, std::vector<KdNode*>& p_result)
+        : center(p_center)
+        , radius(p_radius)
+        , result(p_result) {}
+
+    void visit(KdNode* node) override
+    {
+        if (center.distance(node->getCoordinate()) <= radius) {
+            result.push_back(node);
+        }
+    }
+
+private:
+    const CoordinateXY& center;
+    double radius;
+    std::vector<KdNode*>& result;
+};
+
+} // anonymous namespace
+
+/*public static*/
+std::vector<std::size_t>
+KdTree::balancedOrder(const CoordinateSequence& pts)
+{
+    return computeBalancedOrder(pts.size(), [&pts](std::size_t i) -> const CoordinateXY& {
+        return pts.getAt<CoordinateXY>(i);
+    });
+}
+
+/*public static*/
+std::vector<std::size_t>
+KdTree::balancedOrder(const std::vector<Coordinate>& pts)
+{
+    return computeBalancedOrder(pts.size(), [&pts](std::size_t i) -> const CoordinateXY& {
+        return pts[i];
+    });
+}
 
 /*public static*/
 std::unique_ptr<std::vector<Coordinate>>
@@ -71,6 +189,7 @@ KdNode*
 KdTree::insert(const Coordinate& p, void* data)
 {
     if (root == nullptr) {
+        numberOfNodes++;
         root = createNode(p, data);
         return root;
     }
@@ -91,6 +210,39 @@ KdTree::insert(const Coordinate& p, void* data)
     return insertExact(p, data);
 }
 
+/*public*/
+void
+KdTree::insert(const CoordinateSequence& pts)
+{
+    for (std::size_t i : balancedOrder(pts)) {
+        insert(pts.getAt<Coordinate>(i), nullptr);
+    }
+}
+
+/*public*/
+std::size_t
+KdTree::depth() const
+{
+    std::size_t maxDepth = 0;
+    std::vector<std::pair<KdNode*, std::size_t>> stack;
+    if (root != nullptr) {
+        stack.emplace_back(root, 1);
+    }
+    while (!stack.empty()) {
+        KdNode* node = stack.back().first;
+        std::size_t d = stack.back().second;
+        stack.pop_back();
+        maxDepth = std::max(maxDepth, d);
+        if (node->getLeft() != nullptr) {
+            stack.emplace_back(node->getLeft(), d + 1);
+        }
+        if (node->getRight() != nullptr) {
+            stack.emplace_back(node->getRight(), d + 1);
+        }
+    }
+    return maxDepth;
+}
+
 /*private*/
 KdNode*
 KdTree::findBestMatchNode(const Coordinate& p) {
@@ -289,6 +441,92 @@ KdTree::query(const geom::Coordinate& queryPt) {
     return queryNodePoint(root, queryPt, true);
 }
 
+/*private*/
+void
+KdTree::queryNearest(const CoordinateXY& queryPt, std::size_t k,
+                     std::vector<std::pair<double, KdNode*>>& heap)
+{
+    // Branch-and-bound search, with an explicit stack.
+    // Each entry carries a lower bound on the distance to its subtree,
+    // given by the splitting lines crossed to reach it.
+    // The k best candidates are kept in a max-heap.
+    struct Entry {
+        KdNode* node;
+        bool odd;
+        double bound;
+    };
+
+    if (root == nullptr || k == 0) return;
+
+    std::vector<Entry> stack;
+    stack.push_back({root, true, 0.0});
+    while (!stack.empty()) {
+        Entry e = stack.back();
+        stack.pop_back();
+        if (heap.size() == k && e.bound > heap.front().first) {
+            continue;
+        }
+
+        KdNode* node = e.node;
+        std::pair<double, KdNode*> cand(queryPt.distance(node->getCoordinate()), node);
+        if (heap.size() < k) {
+            heap.push_back(cand);
+            std::push_heap(heap.begin(), heap.end(), isNearer);
+        }
+        else if (isNearer(cand, heap.front())) {
+            std::pop_heap(heap.begin(), heap.end(), isNearer);
+            heap.back() = cand;
+            std::push_heap(heap.begin(), heap.end(), isNearer);
+        }
+
+        double diff = e.odd ? queryPt.x - node->getX() : queryPt.y - node->getY();
+        KdNode* nearNode = diff < 0 ? node->getLeft() : node->getRight();
+        KdNode* farNode = diff < 0 ? node->getRight() : node->getLeft();
+        // push the far side first so the near side is searched first
+        if (farNode != nullptr) {
+            stack.push_back({farNode, !e.odd, std::max(e.bound, std::abs(diff))});
+        }
+        if (nearNode != nullptr) {
+            stack.push_back({nearNode, !e.odd, e.bound});
+        }
+    }
+}
+
+/*public*/
+KdNode*
+KdTree::nearestNeighbor(const CoordinateXY& queryPt)
+{
+    std::vector<std::pair<double, KdNode*>> heap;
+    queryNearest(queryPt, 1, heap);
+    return heap.empty() ? nullptr : heap.front().second;
+}
+
+/*public*/
+std::vector<KdNode*>
+KdTree::nearestNeighbors(const CoordinateXY& queryPt, std::size_t k)
+{
+    std::vector<std::pair<double, KdNode*>> heap;
+    queryNearest(queryPt, k, heap);
+    std::sort_heap(heap.begin(), heap.end(), isNearer);
+
+    std::vector<KdNode*> result;
+    result.reserve(heap.size());
+    for (const auto& cand : heap) {
+        result.push_back(cand.second);
+    }
+    return result;
+}
+
+/*public*/
+void
+KdTree::queryRadius(const CoordinateXY& center, double radius, std::vector<KdNode*>& result)
+{
+    Envelope queryEnv(center);
+    queryEnv.expandBy(radius);
+    RadiusVisitor visitor(center, radius, result);
+    queryNode(root, queryEnv, true, visitor);
+}
+
 
 /**********************************************************************/
 
@@ -0,0 +1,312 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/noding/RectangleSideNoder.h>
+
+#include <geos/algorithm/LineIntersector.h>
+#include <geos/algorithm/Orientation.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/index/strtree/TemplateSTRtree.h>
+#include <geos/noding/NodedSegmentString.h>
+#include <geos/noding/SegmentString.h>
+#include <geos/util.h>
+
+#include <algorithm>
+
+using geos::algorithm::Orientation;
+using geos::geom::CoordinateSequence;
+using geos::geom::CoordinateXY;
+using geos::geom::Envelope;
+
+namespace geos {
+namespace noding { // geos.noding
+
+/* public */
+RectangleSideNoder::RectangleSideNoder(const Envelope& p_rectEnv, const Envelope* p_clipEnv)
+    : interiorEnv(p_rectEnv)
+    , nodedSegStrings(nullptr)
+{
+    addSides(p_rectEnv, true);
+    if (p_clipEnv != nullptr) {
+        addSides(*p_clipEnv, false);
+        p_rectEnv.intersection(*p_clipEnv, interiorEnv);
+    }
+}
+
+/* private */
+void
+RectangleSideNoder::addSides(const Envelope& env, bool isCrossable)
+{
+    CoordinateXY ll(env.getMinX(), env.getMinY());
+    CoordinateXY lr(env.getMaxX(), env.getMinY());
+    CoordinateXY ur(env.getMaxX(), env.getMaxY());
+    CoordinateXY ul(env.getMinX(), env.getMaxY());
+
+    sides.emplace_back(true, env.getMinX(), isCrossable, ll, ul);
+    sides.emplace_back(true, env.getMaxX(), isCrossable, lr, ur);
+    sides.emplace_back(false, env.getMinY(), isCrossable, ll, lr);
+    sides.emplace_back(false, env.getMaxY(), isCrossable, ul, ur);
+}
+
+/* public */
+void
+RectangleSideNoder::computeNodes(std::vector<SegmentString*>* segStrings)
+{
+    for (Side& side : sides) {
+        side.positions.clear();
+        side.runs.clear();
+        side.runMaxEnd.clear();
+    }
+
+    for (SegmentString* ss : *segStrings) {
+        addCrossingNodes(ss);
+    }
+    for (Side& side : sides) {
+        std::sort(side.positions.begin(), side.positions.end());
+        std::sort(side.runs.begin(), side.runs.end());
+        double maxEnd = 0;
+        for (std::size_t i = 0; i < side.runs.size(); i++) {
+            maxEnd = (i == 0) ? side.runs[i].second : std::max(maxEnd, side.runs[i].second);
+            side.runMaxEnd.push_back(maxEnd);
+        }
+    }
+
+    for (SegmentString* ss : *segStrings) {
+        addSideNodes(ss);
+    }
+    addTouchNodes(*segStrings);
+
+    nodedSegStrings = NodedSegmentString::getNodedSubstrings(*segStrings);
+}
+
+/* public */
+std::vector<SegmentString*>*
+RectangleSideNoder::getNodedSubstrings() const
+{
+    return nodedSegStrings;
+}
+
+/* private */
+bool
+RectangleSideNoder::Side::isCrossedBy(const CoordinateXY& p0, const CoordinateXY& p1) const
+{
+    double d0 = isVertical ? p0.x - ordinate : p0.y - ordinate;
+    double d1 = isVertical ? p1.x - ordinate : p1.y - ordinate;
+    // endpoints must lie strictly on opposite sides of the line
+    if ((d0 < 0 && d1 < 0) || (d0 > 0 && d1 > 0) || d0 == 0 || d1 == 0) {
+        return false;
+    }
+    // the side endpoints must not lie strictly on the same side of the segment
+    int orient0 = Orientation::index(p0, p1, start);
+    int orient1 = Orientation::index(p0, p1, end);
+    return orient0 != orient1 || orient0 == Orientation::COLLINEAR;
+}
+
+/* private */
+double
+RectangleSideNoder::Side::crossingPosition(const CoordinateXY& p0, const CoordinateXY& p1) const
+{
+    double minPos = position(start);
+    double maxPos = position(end);
+    // segments through a corner are noded exactly at the corner
+    if (Orientation::index(p0, p1, start) == Orientation::COLLINEAR) {
+        return minPos;
+    }
+    if (Orientation::index(p0, p1, end) == Orientation::COLLINEAR) {
+        return maxPos;
+    }
+
+    // computed as in full noding, for consistency with it
+    algorithm::LineIntersector li;
+    li.computeIntersection(p0, p1, start, end);
+    double pos = position(li.getIntersection(0));
+    // keep the point within the side
+    return std::min(maxPos, std::max(minPos, pos));
+}
+
+/* private */
+bool
+RectangleSideNoder::Side::isNode(double pos) const
+{
+    auto range = std::equal_range(positions.begin(), positions.end(), pos);
+    if (range.second - range.first > 1) {
+        return true;
+    }
+    // find the last run starting before the position
+    auto it = std::lower_bound(runs.begin(), runs.end(), std::make_pair(pos, pos));
+    if (it == runs.begin()) {
+        return false;
+    }
+    std::size_t i = static_cast<std::size_t>(it - runs.begin()) - 1;
+    return runMaxEnd[i] > pos;
+}
+
+/* private */
+bool
+RectangleSideNoder::isVertexNode(const CoordinateXY& p) const
+{
+    for (const Side& side : sides) {
+        if (side.isOn(p) && side.isNode(side.position(p))) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Records the positions of the vertices lying on each side
+ * and the segments lying along each side,
+ * and nodes segments at the points where they cross a rectangle side.
+ * The crossing point is placed exactly on the side,
+ * so that it can be located by its position along it.
+ */
+/* private */
+void
+RectangleSideNoder::addCrossingNodes(SegmentString* ss)
+{
+    NodedSegmentString* nss = detail::down_cast<NodedSegmentString*>(ss);
+    const CoordinateSequence* pts = ss->getCoordinates();
+    // the end point of a ring is not a separate vertex
+    std::size_t numVertices = ss->isClosed() ? pts->size() - 1 : pts->size();
+    bool isInterior0 = false;
+
+    for (std::size_t i = 0; i < pts->size(); i++) {
+        const CoordinateXY& p1 = pts->getAt<CoordinateXY>(i);
+        bool isInterior1 = isInterior(p1);
+        if (i < numVertices && ! isInterior1) {
+            for (Side& side : sides) {
+                if (side.isOn(p1)) {
+                    side.positions.push_back(side.position(p1));
+                }
+            }
+        }
+        // segments inside the interior cannot meet a side
+        bool isInteriorSeg = isInterior1 && isInterior0;
+        isInterior0 = isInterior1;
+        if (i == 0 || isInteriorSeg) continue;
+
+        const CoordinateXY& p0 = pts->getAt<CoordinateXY>(i - 1);
+        for (Side& side : sides) {
+            if (side.isOn(p0) && side.isOn(p1)) {
+                double pos0 = side.position(p0);
+                double pos1 = side.position(p1);
+                side.runs.emplace_back(std::min(pos0, pos1), std::max(pos0, pos1));
+                continue;
+            }
+            if (! side.isCrossable || ! side.isCrossedBy(p0, p1)) {
+                continue;
+            }
+            double pos = side.crossingPosition(p0, p1);
+            nss->addIntersection(side.point(pos), i - 1);
+            side.positions.push_back(pos);
+        }
+    }
+}
+
+/**
+ * Nodes segments at vertices lying on a side which other linework meets,
+ * and segments lying along a side at the points on the side
+ * between their endpoints.
+ */
+/* private */
+void
+RectangleSideNoder::addSideNodes(SegmentString* ss) const
+{
+    NodedSegmentString* nss = detail::down_cast<NodedSegmentString*>(ss);
+    const CoordinateSequence* pts = ss->getCoordinates();
+
+    bool isInterior0 = isInterior(pts->getAt<CoordinateXY>(0));
+    for (std::size_t i = 1; i < pts->size(); i++) {
+        const CoordinateXY& p0 = pts->getAt<CoordinateXY>(i - 1);
+        const CoordinateXY& p1 = pts->getAt<CoordinateXY>(i);
+        bool isInterior1 = isInterior(p1);
+        bool isInteriorSeg = isInterior0 && isInterior1;
+        isInterior0 = isInterior1;
+        if (isInteriorSeg) continue;
+
+        if (i < pts->size() - 1 && ! isInterior1 && isVertexNode(p1)) {
+            nss->addIntersection(p1, i);
+        }
+
+        for (const Side& side : sides) {
+            if (! side.isOn(p0) || ! side.isOn(p1)) {
+                continue;
+            }
+            double pos0 = side.position(p0);
+            double pos1 = side.position(p1);
+            auto it = std::upper_bound(side.positions.begin(), side.positions.end(), std::min(pos0, pos1));
+            auto itEnd = std::lower_bound(it, side.positions.end(), std::max(pos0, pos1));
+            for (; it != itEnd; ++it) {
+                nss->addIntersection(side.point(*it), i - 1);
+            }
+        }
+    }
+}
+
+/**
+ * Nodes the points off the sides where rings touch.
+ * These are vertices which coincide with another vertex
+ * or lie in the interior of a segment (of another ring,
+ * or of the same ring for a self-touching ring).
+ * Both the vertex and the segment are noded there.
+ */
+/* private */
+void
+RectangleSideNoder::addTouchNodes(std::vector<SegmentString*>& segStrings) const
+{
+    index::strtree::TemplateSTRtree<InteriorVertex> vertexIndex;
+    for (SegmentString* ss : segStrings) {
+        const CoordinateSequence* pts = ss->getCoordinates();
+        // the end point of a ring is not a separate vertex
+        std::size_t numVertices = ss->isClosed() ? pts->size() - 1 : pts->size();
+        for (std::size_t i = 0; i < numVertices; i++) {
+            const CoordinateXY& p = pts->getAt<CoordinateXY>(i);
+            if (isInterior(p)) {
+                vertexIndex.insert(Envelope(p), InteriorVertex{ss, i});
+            }
+        }
+    }
+
+    for (SegmentString* ss : segStrings) {
+        NodedSegmentString* nss = detail::down_cast<NodedSegmentString*>(ss);
+        const CoordinateSequence* pts = ss->getCoordinates();
+        std::size_t lastIndex = pts->size() - 1;
+        bool isClosed = ss->isClosed();
+
+        for (std::size_t i = 1; i < pts->size(); i++) {
+            const CoordinateXY& p0 = pts->getAt<CoordinateXY>(i - 1);
+            const CoordinateXY& p1 = pts->getAt<CoordinateXY>(i);
+            // the index of the segment end vertex, as stored in the index
+            std::size_t endIndex = (isClosed && i == lastIndex) ? 0 : i;
+
+            vertexIndex.query(Envelope(p0, p1), [&](const InteriorVertex& v) {
+                if (v.segString == ss && (v.index == i - 1 || v.index == endIndex)) {
+                    return;
+                }
+                const CoordinateXY& p = v.segString->getCoordinates()->getAt<CoordinateXY>(v.index);
+                bool isEndpoint = p.equals2D(p0) || p.equals2D(p1);
+                if (! isEndpoint && Orientation::index(p0, p1, p) != Orientation::COLLINEAR) {
+                    return;
+                }
+                // a coinciding endpoint is noded when its own segments are queried
+                if (! isEndpoint) {
+                    nss->addIntersection(p, i - 1);
+                }
+                NodedSegmentString* vss = detail::down_cast<NodedSegmentString*>(v.segString);
+                vss->addIntersection(p, v.index > 0 ? v.index - 1 : 0);
+            });
+        }
+    }
+}
+
+} // namespace geos.noding
+} // namespace geos
@@ -76,8 +76,9 @@ SnappingNoder::seedSnapIndex(std::vector<SegmentString*>& segStrings)
 {
     double PHI_INV = (std::sqrt(5.0) - 1.0) / 2.0;
 
+    CoordinateSequence seedPts;
     for (SegmentString* ss: segStrings) {
-        CoordinateSequence* cs = ss->getCoordinates();
+        const CoordinateSequence* cs = ss->getCoordinates();
         int numPts = (int) cs->size();
         int numPtsToLoad = numPts / 100;
         double rand = 0.0;
@@ -88,9 +89,17 @@ SnappingNoder::seedSnapIndex(std::vector<SegmentString*>& segStrings)
             if (rand > 1) rand = rand - floor(rand);
 
             unsigned int index = (unsigned int) (numPts * rand);
-            snapIndex.snap(cs->getAt(index));
+            if (isBalancedSeed) {
+                seedPts.add(cs->getAt<Coordinate>(index));
+            }
+            else {
+                snapIndex.snap(cs->getAt<Coordinate>(index));
+            }
         }
     }
+    if (isBalancedSeed) {
+        snapIndex.addAll(seedPts);
+    }
 }
 
 /*private*/
@@ -36,6 +36,18 @@ SnappingPointIndex::snap(const Coordinate& p)
     return node->getCoordinate();
 }
 
+void
+SnappingPointIndex::addAll(const CoordinateSequence& pts)
+{
+    snapPointIndex->insert(pts);
+}
+
+std::size_t
+SnappingPointIndex::depth() const
+{
+    return snapPointIndex->depth();
+}
+
 
 
 } // namespace geos.noding.snap
@@ -26,9 +26,15 @@
 #include <geos/precision/GeometryPrecisionReducer.h>
 #include <geos/operation/buffer/BufferOp.h>
 #include <geos/operation/buffer/BufferBuilder.h>
+#include <geos/operation/buffer/OffsetCurveBuilder.h>
+#include <geos/geom/CoordinateSequence.h>
 #include <geos/geom/Geometry.h>
 #include <geos/geom/GeometryFactory.h>
+#include <geos/geom/LinearRing.h>
+#include <geos/geom/Point.h>
+#include <geos/geom/Polygon.h>
 #include <geos/geom/PrecisionModel.h>
+#include <geos/util/parallel.h>
 
 #include <geos/noding/ScaledNoder.h>
 
@@ -106,6 +112,55 @@ BufferOp::bufferOp(const geom::Geometry* g, double dist,
     return bufOp.getResultGeometry(dist);
 }
 
+/*public static*/
+std::vector<std::unique_ptr<Geometry>>
+BufferOp::bufferMany(const std::vector<const Geometry*>& geoms, double dist,
+        const BufferParameters& bufParms, std::size_t numThreads)
+{
+    /**
+     * The buffer of a point is a single curve which cannot self-intersect,
+     * so it is identical to the curve generated for it
+     * (with a floating precision model).
+     * This avoids noding and graph construction,
+     * which dominate the cost of buffering points.
+     */
+    bool isPointCurveBuffer = dist > 0.0 && std::isfinite(dist)
+                              && ! bufParms.isSingleSided();
+
+    std::vector<std::unique_ptr<Geometry>> result(geoms.size());
+
+    //-- blocks of geometries share an OffsetCurveBuilder
+    static constexpr std::size_t BLOCK_SIZE = 256;
+    std::size_t numBlocks = (geoms.size() + BLOCK_SIZE - 1) / BLOCK_SIZE;
+    util::parallelFor(numBlocks, numThreads, [&](std::size_t b) {
+        std::unique_ptr<OffsetCurveBuilder> curveBuilder;
+        const PrecisionModel* curvePM = nullptr;
+        std::size_t end = std::min(geoms.size(), (b + 1) * BLOCK_SIZE);
+        for (std::size_t i = b * BLOCK_SIZE; i < end; i++) {
+            const Geometry* g = geoms[i];
+            const Point* pt = dynamic_cast<const Point*>(g);
+            if (isPointCurveBuffer && pt != nullptr && ! pt->isEmpty()
+                    && pt->getCoordinatesRO()->getAt(0).isValid()
+                    && g->getPrecisionModel()->isFloating()) {
+                const GeometryFactory* geomFact = g->getFactory();
+                if (curveBuilder == nullptr || curvePM != g->getPrecisionModel()) {
+                    curvePM = g->getPrecisionModel();
+                    curveBuilder.reset(new OffsetCurveBuilder(curvePM, bufParms));
+                }
+                std::unique_ptr<CoordinateSequence> curve = curveBuilder->getLineCurve(pt->getCoordinatesRO(), dist);
+                if (curve == nullptr || curve->isEmpty())
+                    result[i] = geomFact->createPolygon();
+                else
+                    result[i] = geomFact->createPolygon(geomFact->createLinearRing(std::move(curve)));
+                continue;
+            }
+            BufferOp bufOp(g, bufParms);
+            result[i] = bufOp.getResultGeometry(dist);
+        }
+    });
+    return result;
+}
+
 
 /*public*/
 std::unique_ptr<Geometry>
@@ -20,7 +20,9 @@
 
 #include <geos/util.h>
 #include <geos/index/strtree/TemplateSTRtree.h>
+#include <geos/operation/cluster/ConcurrentUnionFind.h>
 #include <geos/operation/cluster/UnionFind.h>
+#include <geos/util/parallel.h>
 
 namespace geos {
 namespace operation {
@@ -90,6 +92,10 @@ AbstractClusterFinder::process(const std::vector<const Geometry*> & components,
                    index::strtree::TemplateSTRtree<std::size_t> & tree,
                    UnionFind & uf) {
 
+    if (isParallel() && supportsParallel()) {
+        return processParallel(components, tree, uf);
+    }
+
     std::vector<size_t> hits;
 
     for (size_t i = 0; i < components.size(); i++) {
@@ -122,6 +128,47 @@ AbstractClusterFinder::process(const std::vector<const Geometry*> & components,
     return uf.getClusters();
 }
 
+Clusters
+AbstractClusterFinder::processParallel(const std::vector<const Geometry*> & components,
+                   index::strtree::TemplateSTRtree<std::size_t> & tree,
+                   UnionFind & uf) {
+
+    // the tree is queried concurrently, so must be built up front
+    tree.build();
+
+    ConcurrentUnionFind cuf(components.size());
+
+    static constexpr std::size_t BLOCK_SIZE = 1024;
+    std::size_t numBlocks = (components.size() + BLOCK_SIZE - 1) / BLOCK_SIZE;
+    util::parallelFor(numBlocks, m_numThreads, [&](std::size_t b) {
+        std::unique_ptr<AbstractClusterFinder> worker = createWorker();
+        std::vector<size_t> hits;
+        std::size_t end = std::min(components.size(), (b + 1) * BLOCK_SIZE);
+
+        for (size_t i = b * BLOCK_SIZE; i < end; i++) {
+            const geom::Geometry* gi = components[i];
+
+            hits.clear();
+            tree.query(worker->queryEnvelope(gi), hits);
+            std::sort(hits.begin(), hits.end(), [&components](std::size_t a, std::size_t c) {
+                return components[a]->getEnvelopeInternal()->getArea() < components[c]->getEnvelopeInternal()->getArea();
+            });
+
+            for (std::size_t j : hits) {
+                if (cuf.different(i, j)) {
+                    const geom::Geometry* gj = components[j];
+                    if (gi->getNumPoints() >= gj->getNumPoints() && worker->shouldJoin(gi, gj)) {
+                        cuf.join(i, j);
+                    }
+                }
+            }
+        }
+    });
+
+    cuf.copyTo(uf);
+    return uf.getClusters();
+}
+
 std::vector<std::unique_ptr<Geometry>>
 AbstractClusterFinder::getComponents(std::unique_ptr<Geometry>&& g)
 {
@@ -0,0 +1,31 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/operation/cluster/ConcurrentUnionFind.h>
+#include <geos/operation/cluster/UnionFind.h>
+
+namespace geos {
+namespace operation {
+namespace cluster {
+
+void ConcurrentUnionFind::copyTo(UnionFind& uf) {
+    for (std::size_t i = 0; i < parents.size(); i++) {
+        std::size_t root = find(i);
+        if (root != i) {
+            uf.join(root, i);
+        }
+    }
+}
+
+}
+}
+}
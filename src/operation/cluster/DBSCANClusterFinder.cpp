@@ -16,7 +16,12 @@
 #include <geos/geom/Geometry.h>
 #include <geos/geom/prep/PreparedGeometry.h>
 #include <geos/geom/prep/PreparedGeometryFactory.h>
+#include <geos/operation/cluster/ConcurrentUnionFind.h>
 #include <geos/operation/cluster/UnionFind.h>
+#include <geos/util/parallel.h>
+
+#include <atomic>
+#include <limits>
 
 namespace geos {
 namespace operation {
@@ -44,6 +49,10 @@ Clusters DBSCANClusterFinder::process(const std::vector<const geom::Geometry*> &
                       index::strtree::TemplateSTRtree<std::size_t> & tree,
                       UnionFind & uf) {
 
+    if (isParallel()) {
+        return processParallel(components, tree, uf);
+    }
+
     std::vector<bool> in_a_cluster(components.size());
     std::vector<bool> is_in_core(components.size());
 
@@ -127,6 +136,130 @@ Clusters DBSCANClusterFinder::process(const std::vector<const geom::Geometry*> &
     return uf.getClusters(includedInCluster);
 }
 
+/**
+ * Computes the same clusters as the sequential algorithm in three passes:
+ * first the core points are identified, then core points within eps
+ * of each other are joined, recording for each border point the
+ * first core point within eps, and finally border points are joined
+ * to the cluster of that core point.
+ * The first two passes are performed concurrently.
+ */
+Clusters DBSCANClusterFinder::processParallel(const std::vector<const geom::Geometry*> & components,
+                      index::strtree::TemplateSTRtree<std::size_t> & tree,
+                      UnionFind & uf) {
+
+    static constexpr std::size_t NO_CORE = std::numeric_limits<std::size_t>::max();
+    static constexpr std::size_t BLOCK_SIZE = 1024;
+
+    std::size_t n = components.size();
+    std::size_t numBlocks = (n + BLOCK_SIZE - 1) / BLOCK_SIZE;
+
+    // the tree is queried concurrently, so must be built up front
+    tree.build();
+
+    auto queryNeighbors = [this, &tree, &components](std::size_t p, std::vector<std::size_t>& hits) {
+        hits.clear();
+        geom::Envelope env = *components[p]->getEnvelopeInternal();
+        env.expandBy(m_eps);
+        tree.query(env, [&hits](std::size_t hit) {
+            hits.push_back(hit);
+        });
+    };
+
+    std::vector<char> is_in_core(n, false);
+    util::parallelFor(numBlocks, m_numThreads, [&](std::size_t b) {
+        std::vector<size_t> hits;
+        std::size_t end = std::min(n, (b + 1) * BLOCK_SIZE);
+        for (std::size_t p = b * BLOCK_SIZE; p < end; p++) {
+            queryNeighbors(p, hits);
+            if (hits.size() < m_minPoints) {
+                continue;
+            }
+
+            std::unique_ptr<geom::prep::PreparedGeometry> prep;
+            std::size_t numNeighbors = 0;
+            for (size_t q : hits) {
+                if (q != p) {
+                    if (!prep) {
+                        prep = geom::prep::PreparedGeometryFactory::prepare(components[p]);
+                    }
+                    if (prep->distance(components[q]) > m_eps) {
+                        continue;
+                    }
+                }
+                if (++numNeighbors >= m_minPoints) {
+                    is_in_core[p] = true;
+                    break;
+                }
+            }
+        }
+    });
+
+    ConcurrentUnionFind cuf(n);
+    std::vector<std::atomic<std::size_t>> border_core(n);
+    for (auto& c : border_core) {
+        c.store(NO_CORE, std::memory_order_relaxed);
+    }
+
+    util::parallelFor(numBlocks, m_numThreads, [&](std::size_t b) {
+        std::vector<size_t> hits;
+        std::size_t end = std::min(n, (b + 1) * BLOCK_SIZE);
+        for (std::size_t p = b * BLOCK_SIZE; p < end; p++) {
+            if (!is_in_core[p]) {
+                continue;
+            }
+            queryNeighbors(p, hits);
+
+            std::unique_ptr<geom::prep::PreparedGeometry> prep;
+            for (size_t q : hits) {
+                if (q == p) {
+                    continue;
+                }
+                if (is_in_core[q]) {
+                    if (cuf.same(p, q)) {
+                        continue;
+                    }
+                }
+                else if (border_core[q].load(std::memory_order_relaxed) < p) {
+                    continue;
+                }
+
+                if (!prep) {
+                    prep = geom::prep::PreparedGeometryFactory::prepare(components[p]);
+                }
+                if (prep->distance(components[q]) > m_eps) {
+                    continue;
+                }
+
+                if (is_in_core[q]) {
+                    cuf.join(p, q);
+                }
+                else {
+                    std::size_t core = border_core[q].load(std::memory_order_relaxed);
+                    while (p < core && !border_core[q].compare_exchange_weak(core, p, std::memory_order_relaxed)) {
+                    }
+                }
+            }
+        }
+    });
+
+    std::vector<size_t> includedInCluster;
+    includedInCluster.reserve(n);
+    for (size_t p = 0; p < n; p++) {
+        std::size_t core = border_core[p].load(std::memory_order_relaxed);
+        if (is_in_core[p]) {
+            includedInCluster.push_back(p);
+        }
+        else if (core != NO_CORE) {
+            cuf.join(core, p);
+            includedInCluster.push_back(p);
+        }
+    }
+
+    cuf.copyTo(uf);
+    return uf.getClusters(includedInCluster);
+}
+
 
 }
 }
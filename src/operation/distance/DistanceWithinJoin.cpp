@@ -0,0 +1,256 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/algorithm/locate/IndexedPointInAreaLocator.h>
+#include <geos/algorithm/locate/SimplePointInAreaLocator.h>
+#include <geos/geom/Envelope.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/Point.h>
+#include <geos/geom/util/ComponentCoordinateExtracter.h>
+#include <geos/index/strtree/TemplateSTRtree.h>
+#include <geos/operation/distance/DistanceOp.h>
+#include <geos/operation/distance/DistanceWithinJoin.h>
+#include <geos/operation/distance/IndexedFacetDistance.h>
+#include <geos/util/parallel.h>
+
+#include <algorithm>
+#include <mutex>
+
+using geos::algorithm::locate::IndexedPointInAreaLocator;
+using geos::algorithm::locate::PointOnGeometryLocator;
+using geos::algorithm::locate::SimplePointInAreaLocator;
+using geos::geom::CoordinateXY;
+using geos::geom::Envelope;
+using geos::geom::Geometry;
+using geos::geom::Location;
+using geos::geom::Point;
+using geos::geom::util::ComponentCoordinateExtracter;
+
+namespace geos {
+namespace operation {
+namespace distance {
+
+namespace {
+
+/*
+ * Tests whether a point of any component of a geometry
+ * lies in an area.
+ * If the facets of two geometries are disjoint, this is
+ * the case exactly when the geometries intersect.
+ */
+bool
+hasPointInArea(const Geometry& g, PointOnGeometryLocator& areaLocator)
+{
+    std::vector<const CoordinateXY*> pts;
+    ComponentCoordinateExtracter::getCoordinates(g, pts);
+    for (const CoordinateXY* pt : pts) {
+        if (areaLocator.locate(pt) != Location::EXTERIOR) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/*
+ * A large geometry with a cached facet index,
+ * and a point locator if it is polygonal.
+ * Once constructed, it may be queried concurrently.
+ */
+class IndexedGeometry {
+public:
+    explicit IndexedGeometry(const Geometry& g)
+        : geom(g)
+        , facetDistance(&g)
+    {
+        if (g.isPolygonal()) {
+            areaLocator.reset(new IndexedPointInAreaLocator(g));
+            //-- the locator index is built lazily, so force it before sharing
+            CoordinateXY pt;
+            areaLocator->locate(&pt);
+        }
+    }
+
+    bool isWithinDistance(const Geometry& other, double distance) const
+    {
+        //-- IndexedFacetDistance ignores polygon interiors, so check containment too
+        if (facetDistance.isWithinDistance(&other, distance)) {
+            return true;
+        }
+        if (areaLocator && hasPointInArea(other, *areaLocator)) {
+            return true;
+        }
+        if (other.getDimension() == 2) {
+            SimplePointInAreaLocator otherLocator(other);
+            return hasPointInArea(geom, otherLocator);
+        }
+        return false;
+    }
+
+private:
+    const Geometry& geom;
+    IndexedFacetDistance facetDistance;
+    std::unique_ptr<IndexedPointInAreaLocator> areaLocator;
+};
+
+/*
+ * Mixed collections containing polygons are not supported by
+ * IndexedPointInAreaLocator, so they are left to DistanceOp.
+ */
+bool
+isIndexable(const Geometry& g, std::size_t indexThreshold)
+{
+    return g.getNumPoints() >= indexThreshold
+           && (g.isPolygonal() || g.getDimension() < 2);
+}
+
+bool
+isPointWithinDistance(const Geometry& a, const Geometry& b, double distance)
+{
+    const CoordinateXY* pa = static_cast<const Point&>(a).getCoordinate();
+    const CoordinateXY* pb = static_cast<const Point&>(b).getCoordinate();
+    double dx = pa->x - pb->x;
+    double dy = pa->y - pb->y;
+    return dx * dx + dy * dy <= distance * distance;
+}
+
+} // anonymous namespace
+
+DistanceWithinJoin::DistanceWithinJoin(const std::vector<const Geometry*>& geomsA,
+                                       const std::vector<const Geometry*>& geomsB,
+                                       double distance)
+    : m_geomsA(geomsA)
+    , m_geomsB(geomsB)
+    , m_distance(distance)
+{}
+
+/*public static*/
+std::vector<std::pair<std::size_t, std::size_t>>
+DistanceWithinJoin::join(const std::vector<const Geometry*>& geomsA,
+                         const std::vector<const Geometry*>& geomsB,
+                         double distance,
+                         std::size_t numThreads)
+{
+    DistanceWithinJoin dwj(geomsA, geomsB, distance);
+    dwj.setNumThreads(numThreads);
+    return dwj.join();
+}
+
+std::vector<std::pair<std::size_t, std::size_t>>
+DistanceWithinJoin::join() const
+{
+    std::vector<std::pair<std::size_t, std::size_t>> pairs;
+    join([&pairs](std::size_t i, std::size_t j) {
+        pairs.emplace_back(i, j);
+    });
+    return pairs;
+}
+
+void
+DistanceWithinJoin::join(const std::function<void(std::size_t, std::size_t)>& visitor) const
+{
+    index::strtree::TemplateSTRtree<std::size_t> tree(10, m_geomsB.size());
+    for (std::size_t j = 0; j < m_geomsB.size(); j++) {
+        if (! m_geomsB[j]->isEmpty()) {
+            tree.insert(*m_geomsB[j]->getEnvelopeInternal(), j);
+        }
+    }
+    // the tree is queried concurrently, so must be built up front
+    tree.build();
+
+    //-- make sure lazily-computed envelopes are not computed concurrently
+    for (const Geometry* a : m_geomsA) {
+        a->getEnvelopeInternal();
+    }
+
+    //-- indexes of large B geometries are built on first use
+    std::vector<std::unique_ptr<IndexedGeometry>> indexB(m_geomsB.size());
+    std::vector<std::once_flag> indexBInit(m_geomsB.size());
+
+    auto isWithinDistance = [&](const Geometry& a, std::unique_ptr<IndexedGeometry>& indexA,
+                                std::size_t j) {
+        const Geometry& b = *m_geomsB[j];
+        if (a.getGeometryTypeId() == geom::GEOS_POINT && b.getGeometryTypeId() == geom::GEOS_POINT) {
+            return isPointWithinDistance(a, b, m_distance);
+        }
+        if (isIndexable(b, m_indexThreshold)) {
+            std::call_once(indexBInit[j], [&]() {
+                indexB[j].reset(new IndexedGeometry(b));
+            });
+            return indexB[j]->isWithinDistance(a, m_distance);
+        }
+        if (isIndexable(a, m_indexThreshold)) {
+            if (! indexA) {
+                indexA.reset(new IndexedGeometry(a));
+            }
+            return indexA->isWithinDistance(b, m_distance);
+        }
+        return DistanceOp::isWithinDistance(a, b, m_distance);
+    };
+
+    static constexpr std::size_t BLOCK_SIZE = 256;
+    std::size_t numBlocks = (m_geomsA.size() + BLOCK_SIZE - 1) / BLOCK_SIZE;
+
+    auto processBlock = [&](std::size_t block, std::vector<std::pair<std::size_t, std::size_t>>& pairs) {
+        std::vector<std::size_t> hits;
+        std::size_t end = std::min(m_geomsA.size(), (block + 1) * BLOCK_SIZE);
+
+        for (std::size_t i = block * BLOCK_SIZE; i < end; i++) {
+            const Geometry& a = *m_geomsA[i];
+            if (a.isEmpty()) {
+                continue;
+            }
+            const Envelope& envA = *a.getEnvelopeInternal();
+            Envelope queryEnv(envA);
+            queryEnv.expandBy(m_distance);
+
+            hits.clear();
+            tree.query(queryEnv, hits);
+            std::sort(hits.begin(), hits.end());
+
+            std::unique_ptr<IndexedGeometry> indexA;
+            for (std::size_t j : hits) {
+                if (envA.distance(*m_geomsB[j]->getEnvelopeInternal()) > m_distance) {
+                    continue;
+                }
+                if (isWithinDistance(a, indexA, j)) {
+                    pairs.emplace_back(i, j);
+                }
+            }
+        }
+    };
+
+    //-- blocks are processed in rounds, so that the matches can be passed
+    //-- to the visitor in order without holding all of them in memory
+    std::size_t numThreads = m_numThreads == 0 ? util::defaultThreadCount() : m_numThreads;
+    std::size_t roundSize = 4 * numThreads;
+    std::vector<std::vector<std::pair<std::size_t, std::size_t>>> roundPairs;
+
+    for (std::size_t start = 0; start < numBlocks; start += roundSize) {
+        std::size_t n = std::min(roundSize, numBlocks - start);
+        roundPairs.clear();
+        roundPairs.resize(n);
+
+        util::parallelFor(n, numThreads, [&](std::size_t k) {
+            processBlock(start + k, roundPairs[k]);
+        });
+
+        for (const auto& pairs : roundPairs) {
+            for (const auto& p : pairs) {
+                visitor(p.first, p.second);
+            }
+        }
+    }
+}
+
+} // namespace geos::operation::distance
+} // namespace geos::operation
+} // namespace geos
@@ -17,8 +17,11 @@
  **********************************************************************/
 
 #include <geos/geom/Coordinate.h>
+#include <geos/geom/Envelope.h>
+#include <geos/geom/Point.h>
 #include <geos/index/strtree/STRtree.h>
 #include <geos/operation/distance/IndexedFacetDistance.h>
+#include <geos/util/parallel.h>
 
 using namespace geos::geom;
 using namespace geos::index::strtree;
@@ -46,6 +49,10 @@ IndexedFacetDistance::nearestPoints(const geom::Geometry* g1, const geom::Geomet
 double
 IndexedFacetDistance::distance(const Geometry* g) const
 {
+    if (g->getGeometryTypeId() == GEOS_POINT && ! g->isEmpty()) {
+        return pointDistance(g);
+    }
+
     auto tree2 = FacetSequenceTreeBuilder::build(g);
     auto nearest = cachedTree->nearestNeighbour<FacetDistance>(*tree2);
 
@@ -56,15 +63,90 @@ IndexedFacetDistance::distance(const Geometry* g) const
     return nearest.first->distance(*nearest.second);
 }
 
+double
+IndexedFacetDistance::pointDistance(const Geometry* pt) const
+{
+    FacetSequence ptFacet(pt, static_cast<const Point*>(pt)->getCoordinatesRO(), 0, 1);
+    const FacetSequence* ptItem = &ptFacet;
+    FacetDistance facetDist;
+    const FacetSequence* nearest = cachedTree->nearestNeighbour<FacetDistance>(*ptFacet.getEnvelope(), ptItem, facetDist);
+
+    if (!nearest) {
+        throw util::GEOSException("Cannot calculate IndexedFacetDistance on empty geometries.");
+    }
+
+    return nearest->distance(ptFacet);
+}
+
+bool
+IndexedFacetDistance::isPointWithinDistance(const Geometry* pt, double maxDistance) const
+{
+    FacetSequence ptFacet(pt, static_cast<const Point*>(pt)->getCoordinatesRO(), 0, 1);
+    Envelope queryEnv(*pt->getEnvelopeInternal());
+    queryEnv.expandBy(maxDistance);
+
+    bool isWithin = false;
+    cachedTree->query(queryEnv, [&](const FacetSequence* facet) {
+        if (facet->distance(ptFacet) <= maxDistance) {
+            isWithin = true;
+            return false;
+        }
+        return true;
+    });
+    return isWithin;
+}
+
+std::vector<double>
+IndexedFacetDistance::distance(const std::vector<const Geometry*>& geoms, std::size_t numThreads) const
+{
+    //-- make sure lazily-computed envelopes are not computed concurrently
+    baseGeometry.getEnvelopeInternal();
+    for (const Geometry* g : geoms) {
+        g->getEnvelopeInternal();
+    }
+
+    std::vector<double> result(geoms.size());
+    util::parallelFor(geoms.size(), numThreads, [&](std::size_t i) {
+        result[i] = distance(geoms[i]);
+    });
+    return result;
+}
+
+std::vector<bool>
+IndexedFacetDistance::isWithinDistance(const std::vector<const Geometry*>& geoms,
+                                       double maxDistance, std::size_t numThreads) const
+{
+    //-- make sure lazily-computed envelopes are not computed concurrently
+    baseGeometry.getEnvelopeInternal();
+    for (const Geometry* g : geoms) {
+        g->getEnvelopeInternal();
+    }
+
+    //-- std::vector<bool> elements cannot be written concurrently
+    std::vector<char> isWithin(geoms.size());
+    util::parallelFor(geoms.size(), numThreads, [&](std::size_t i) {
+        isWithin[i] = isWithinDistance(geoms[i], maxDistance);
+    });
+    return std::vector<bool>(isWithin.begin(), isWithin.end());
+}
+
 bool
 IndexedFacetDistance::isWithinDistance(const Geometry* g, double maxDistance) const
 {
+    if (g->isEmpty() || baseGeometry.isEmpty()) {
+        return false;
+    }
+
     // short-circuit check
     double envDist = baseGeometry.getEnvelopeInternal()->distance(*g->getEnvelopeInternal());
     if (envDist > maxDistance) {
         return false;
     }
 
+    if (g->getGeometryTypeId() == GEOS_POINT) {
+        return isPointWithinDistance(g, maxDistance);
+    }
+
     //-- heuristic: for atomic indexed geom, test distance to envelope of test geom
     if (baseGeometry.getNumGeometries() == 1
         && ! g->getEnvelopeInternal()->contains(baseGeometry.getEnvelopeInternal()))
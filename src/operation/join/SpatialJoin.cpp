@@ -0,0 +1,308 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/geom/Envelope.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/prep/PreparedGeometry.h>
+#include <geos/geom/prep/PreparedGeometryFactory.h>
+#include <geos/index/strtree/TemplateSTRtree.h>
+#include <geos/operation/distance/DistanceWithinJoin.h>
+#include <geos/operation/join/SpatialJoin.h>
+#include <geos/shape/fractal/HilbertEncoder.h>
+#include <geos/util/parallel.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <unordered_map>
+
+using geos::geom::Envelope;
+using geos::geom::Geometry;
+using geos::geom::prep::PreparedGeometry;
+using geos::geom::prep::PreparedGeometryFactory;
+using geos::operation::distance::DistanceWithinJoin;
+
+namespace geos {
+namespace operation {
+namespace join {
+
+namespace {
+
+/*
+ * Orders the non-empty geometries by the Hilbert code
+ * of the centre of their envelopes.
+ */
+std::vector<std::size_t>
+hilbertOrder(const std::vector<const Geometry*>& geoms)
+{
+    std::vector<std::size_t> order;
+    order.reserve(geoms.size());
+    Envelope extent;
+    for (std::size_t i = 0; i < geoms.size(); i++) {
+        if (! geoms[i]->isEmpty()) {
+            order.push_back(i);
+            extent.expandToInclude(geoms[i]->getEnvelopeInternal());
+        }
+    }
+
+    if (order.empty()) {
+        return order;
+    }
+
+    shape::fractal::HilbertEncoder encoder(12, extent);
+    std::vector<uint32_t> codes(geoms.size());
+    for (std::size_t i : order) {
+        codes[i] = encoder.encode(geoms[i]->getEnvelopeInternal());
+    }
+    std::stable_sort(order.begin(), order.end(), [&codes](std::size_t a, std::size_t b) {
+        return codes[a] < codes[b];
+    });
+    return order;
+}
+
+double
+averageNumPoints(const std::vector<const Geometry*>& geoms)
+{
+    if (geoms.empty()) {
+        return 0;
+    }
+    double numPoints = 0;
+    for (const Geometry* g : geoms) {
+        numPoints += static_cast<double>(g->getNumPoints());
+    }
+    return numPoints / static_cast<double>(geoms.size());
+}
+
+/*
+ * A bounded cache of prepared indexed geometries.
+ * When full, the least recently used geometry is evicted.
+ * Queries are processed in Hilbert order, so the geometries
+ * they hit are mostly those hit by the previous queries.
+ */
+class PreparedCache {
+public:
+    explicit PreparedCache(std::size_t p_capacity)
+        : capacity(p_capacity)
+    {}
+
+    const PreparedGeometry&
+    get(std::size_t j, const Geometry* g)
+    {
+        auto it = index.find(j);
+        if (it != index.end()) {
+            entries.splice(entries.begin(), entries, it->second);
+            return *it->second->second;
+        }
+
+        if (entries.size() >= capacity) {
+            index.erase(entries.back().first);
+            entries.pop_back();
+        }
+        entries.emplace_front(j, PreparedGeometryFactory::prepare(g));
+        index[j] = entries.begin();
+        return *entries.front().second;
+    }
+
+private:
+    using Entry = std::pair<std::size_t, std::unique_ptr<PreparedGeometry>>;
+
+    std::size_t capacity;
+    //-- most recently used first
+    std::list<Entry> entries;
+    std::unordered_map<std::size_t, std::list<Entry>::iterator> index;
+};
+
+} // anonymous namespace
+
+SpatialJoin::SpatialJoin(const std::vector<const Geometry*>& geomsA,
+                         const std::vector<const Geometry*>& geomsB,
+                         Predicate predicate)
+    : m_geomsA(geomsA)
+    , m_geomsB(geomsB)
+    , m_predicate(predicate)
+{}
+
+/*public static*/
+std::vector<std::pair<std::size_t, std::size_t>>
+SpatialJoin::join(const std::vector<const Geometry*>& geomsA,
+                  const std::vector<const Geometry*>& geomsB,
+                  Predicate predicate,
+                  std::size_t numThreads)
+{
+    SpatialJoin sj(geomsA, geomsB, predicate);
+    sj.setNumThreads(numThreads);
+    return sj.join();
+}
+
+std::vector<std::pair<std::size_t, std::size_t>>
+SpatialJoin::join() const
+{
+    std::vector<std::pair<std::size_t, std::size_t>> pairs;
+    join([&pairs](std::size_t i, std::size_t j) {
+        pairs.emplace_back(i, j);
+    });
+    std::sort(pairs.begin(), pairs.end());
+    return pairs;
+}
+
+bool
+SpatialJoin::isIndexA() const
+{
+    switch (m_predicate) {
+    case CONTAINS:
+    case COVERS:
+        return true;
+    case WITHIN:
+    case COVEREDBY:
+        return false;
+    default:
+        //-- larger geometries benefit most from preparation
+        return averageNumPoints(m_geomsA) > averageNumPoints(m_geomsB);
+    }
+}
+
+void
+SpatialJoin::join(const std::function<void(std::size_t, std::size_t)>& visitor) const
+{
+    bool isIndexedA = isIndexA();
+    const auto& query = isIndexedA ? m_geomsB : m_geomsA;
+    const auto& indexed = isIndexedA ? m_geomsA : m_geomsB;
+
+    auto visitQueryPair = [&](std::size_t queryIndex, std::size_t indexedIndex) {
+        if (isIndexedA) {
+            visitor(indexedIndex, queryIndex);
+        }
+        else {
+            visitor(queryIndex, indexedIndex);
+        }
+    };
+
+    if (m_predicate == DWITHIN) {
+        std::vector<std::size_t> order = hilbertOrder(query);
+        std::vector<const Geometry*> sortedQuery;
+        sortedQuery.reserve(order.size());
+        for (std::size_t i : order) {
+            sortedQuery.push_back(query[i]);
+        }
+
+        DistanceWithinJoin dwj(sortedQuery, indexed, m_distance);
+        dwj.setNumThreads(m_numThreads);
+        dwj.join([&](std::size_t k, std::size_t j) {
+            visitQueryPair(order[k], j);
+        });
+        return;
+    }
+
+    joinIndexed(query, indexed, visitQueryPair);
+}
+
+void
+SpatialJoin::joinIndexed(const std::vector<const Geometry*>& query,
+                         const std::vector<const Geometry*>& indexed,
+                         const std::function<void(std::size_t, std::size_t)>& visitor) const
+{
+    index::strtree::TemplateSTRtree<std::size_t> tree(10, indexed.size());
+    for (std::size_t j = 0; j < indexed.size(); j++) {
+        if (! indexed[j]->isEmpty()) {
+            tree.insert(*indexed[j]->getEnvelopeInternal(), j);
+        }
+    }
+    // the tree is queried concurrently, so must be built up front
+    tree.build();
+
+    //-- computes the lazily-computed query envelopes before going parallel
+    std::vector<std::size_t> order = hilbertOrder(query);
+
+    //-- the indexed geometry must contain the query geometry for all
+    //-- predicates other than intersects
+    bool isContainment = m_predicate != INTERSECTS;
+    auto isMatch = [this](const PreparedGeometry& prep, const Geometry* g) {
+        switch (m_predicate) {
+        case INTERSECTS:
+            return prep.intersects(g);
+        case CONTAINS:
+        case WITHIN:
+            return prep.contains(g);
+        default:
+            return prep.covers(g);
+        }
+    };
+
+    static constexpr std::size_t BLOCK_SIZE = 256;
+    static constexpr std::size_t BLOCKS_PER_WORKER = 16;
+    //-- the number of prepared geometries kept by each worker
+    static constexpr std::size_t MAX_CACHED_PREPARED = 1024;
+    std::size_t numBlocks = (order.size() + BLOCK_SIZE - 1) / BLOCK_SIZE;
+    std::size_t numWorkers = m_numThreads == 0 ? util::defaultThreadCount() : m_numThreads;
+    numWorkers = std::max<std::size_t>(1, std::min(numWorkers, numBlocks));
+    //-- prepared geometries are not thread-safe, so each worker has its own cache
+    std::vector<PreparedCache> caches;
+    caches.reserve(numWorkers);
+    for (std::size_t w = 0; w < numWorkers; w++) {
+        caches.emplace_back(MAX_CACHED_PREPARED);
+    }
+
+    auto processBlock = [&](std::size_t block, PreparedCache& cache,
+                            std::vector<std::pair<std::size_t, std::size_t>>& pairs) {
+        std::vector<std::size_t> hits;
+        std::size_t end = std::min(order.size(), (block + 1) * BLOCK_SIZE);
+
+        for (std::size_t k = block * BLOCK_SIZE; k < end; k++) {
+            std::size_t i = order[k];
+            const Geometry* g = query[i];
+            const Envelope& env = *g->getEnvelopeInternal();
+
+            hits.clear();
+            tree.query(env, hits);
+            std::sort(hits.begin(), hits.end());
+
+            for (std::size_t j : hits) {
+                if (isContainment && ! indexed[j]->getEnvelopeInternal()->covers(&env)) {
+                    continue;
+                }
+                if (isMatch(cache.get(j, indexed[j]), g)) {
+                    pairs.emplace_back(i, j);
+                }
+            }
+        }
+    };
+
+    //-- blocks are processed in rounds, so that the matches can be passed
+    //-- to the visitor in a fixed order without holding all of them in memory
+    std::size_t roundSize = BLOCKS_PER_WORKER * numWorkers;
+    std::vector<std::vector<std::pair<std::size_t, std::size_t>>> roundPairs;
+
+    for (std::size_t start = 0; start < numBlocks; start += roundSize) {
+        std::size_t n = std::min(roundSize, numBlocks - start);
+        roundPairs.clear();
+        roundPairs.resize(n);
+
+        std::atomic<std::size_t> next(0);
+        util::parallelFor(numWorkers, numWorkers, [&](std::size_t w) {
+            for (std::size_t b = next++; b < n; b = next++) {
+                processBlock(start + b, caches[w], roundPairs[b]);
+            }
+        });
+
+        for (const auto& pairs : roundPairs) {
+            for (const auto& p : pairs) {
+                visitor(p.first, p.second);
+            }
+        }
+    }
+}
+
+} // namespace geos::operation::join
+} // namespace geos::operation
+} // namespace geos
@@ -32,7 +32,10 @@ using namespace geos::geom;
 * Creates a new graph for a set of noded, labelled {@link Edge}s.
 */
 //std::vector<std::unique_ptr<Edge>> && edges
-OverlayGraph::OverlayGraph()
+OverlayGraph::OverlayGraph(geos::util::Arena* arena)
+    : nodeMap(NodeMap::allocator_type(arena))
+    , ovEdgeQue(geos::util::ArenaAllocator<OverlayEdge>(arena))
+    , ovLabelQue(geos::util::ArenaAllocator<OverlayLabel>(arena))
 {}
 
 /*public*/
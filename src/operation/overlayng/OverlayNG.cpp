@@ -35,6 +35,9 @@
 #include <geos/geom/Envelope.h>
 #include <geos/geom/Location.h>
 #include <geos/geom/Geometry.h>
+#include <geos/geom/Polygon.h>
+#include <geos/noding/RectangleSideNoder.h>
+#include <geos/util/Arena.h>
 #include <geos/util/Interrupt.h>
 #include <geos/util/TopologyException.h>
 
@@ -57,6 +60,65 @@ namespace overlayng { // geos.operation.overlayng
 
 using namespace geos::geom;
 
+namespace {
+
+/**
+* Provides the arena used for the topology graph of an overlay
+* when the caller has not supplied one.
+* A per-thread arena is reused across overlay calls, so that
+* after warm-up the graph is built without heap allocations.
+* If the thread arena is already in use (e.g. by an overlay
+* invoked while another is being computed) the graph falls back
+* to heap allocation.
+*/
+class GraphArenaScope {
+
+public:
+
+    explicit GraphArenaScope(geos::util::Arena* userArena)
+        : arena(userArena)
+        , isThreadArena(false)
+    {
+        if (arena == nullptr && ! threadArenaInUse) {
+            threadArenaInUse = true;
+            isThreadArena = true;
+            arena = &threadArena;
+        }
+    }
+
+    ~GraphArenaScope()
+    {
+        if (isThreadArena) {
+            threadArena.reset(MAX_RETAINED_BYTES);
+            threadArenaInUse = false;
+        }
+    }
+
+    GraphArenaScope(const GraphArenaScope&) = delete;
+    GraphArenaScope& operator=(const GraphArenaScope&) = delete;
+
+    geos::util::Arena* get() const { return arena; }
+
+private:
+
+    // memory kept by each thread for later overlays; a larger
+    // overlay's memory is freed, so it is not held for the
+    // life of the thread
+    static constexpr std::size_t MAX_RETAINED_BYTES = 1024 * 1024;
+
+    static thread_local geos::util::Arena threadArena;
+    static thread_local bool threadArenaInUse;
+
+    geos::util::Arena* arena;
+    bool isThreadArena;
+
+};
+
+thread_local geos::util::Arena GraphArenaScope::threadArena;
+thread_local bool GraphArenaScope::threadArenaInUse = false;
+
+} // anonymous namespace
+
 
 /*public static*/
 bool
@@ -202,26 +264,93 @@ OverlayNG::getResult()
 }
 
 
+/*private*/
+bool
+OverlayNG::isRectangleClipped(Envelope& rectEnv) const
+{
+    if (! isRectangleClipMode
+        || opCode != INTERSECTION
+        || noder != nullptr
+        || ! OverlayUtil::isFloating(pm)
+        || isOutputEdges) {
+        return false;
+    }
+
+    const Geometry* g0 = inputGeom.getGeometry(0);
+    const Geometry* g1 = inputGeom.getGeometry(1);
+    if (g1 == nullptr || ! g0->isPolygonal() || ! g1->isPolygonal()) {
+        return false;
+    }
+
+    const Geometry* rect = nullptr;
+    if (g0->getGeometryTypeId() == GEOS_POLYGON
+        && static_cast<const Polygon*>(g0)->isRectangle()) {
+        rect = g0;
+    }
+    else if (g1->getGeometryTypeId() == GEOS_POLYGON
+        && static_cast<const Polygon*>(g1)->isRectangle()) {
+        rect = g1;
+    }
+    if (rect == nullptr) {
+        return false;
+    }
+
+    rectEnv = *(rect->getEnvelopeInternal());
+    return true;
+}
+
 /*private*/
 std::unique_ptr<Geometry>
 OverlayNG::computeEdgeOverlay()
+{
+    Envelope rectEnv;
+    if (isRectangleClipped(rectEnv)) {
+        try {
+            return computeEdgeOverlay(&rectEnv);
+        }
+        catch (const util::TopologyException&) {
+            // fall back to full noding
+        }
+    }
+    return computeEdgeOverlay(nullptr);
+}
+
+/*private*/
+std::unique_ptr<Geometry>
+OverlayNG::computeEdgeOverlay(const Envelope* rectEnv)
 {
     /**
      * Node the edges, using whatever noder is being used
      * Formerly in nodeEdges())
+     *
+     * The arena scope must outlive the noding builder and graph,
+     * since their storage is allocated from it.
      */
-    EdgeNodingBuilder nodingBuilder(pm, noder);
+    GraphArenaScope arenaScope(arena);
+
     // clipEnv not always used, but needs to remain in scope
     // as long as nodingBuilder when it is.
     Envelope clipEnv;
+    bool gotClipEnv = false;
+    if (isOptimized) {
+        gotClipEnv = OverlayUtil::clippingEnvelope(opCode, &inputGeom, pm, clipEnv);
+    }
+
+    /**
+     * When overlaying with a rectangle the only intersections
+     * lie along the rectangle sides and the clipping envelope sides,
+     * so a one-dimensional noding suffices.
+     */
+    std::unique_ptr<noding::Noder> rectNoder;
+    if (rectEnv != nullptr) {
+        rectNoder.reset(new noding::RectangleSideNoder(*rectEnv, gotClipEnv ? &clipEnv : nullptr));
+    }
+    EdgeNodingBuilder nodingBuilder(pm, rectNoder ? rectNoder.get() : noder, arenaScope.get());
 
     GEOS_CHECK_FOR_INTERRUPTS();
 
-    if (isOptimized) {
-        bool gotClipEnv = OverlayUtil::clippingEnvelope(opCode, &inputGeom, pm, clipEnv);
-        if (gotClipEnv) {
-            nodingBuilder.setClipEnvelope(&clipEnv);
-        }
+    if (gotClipEnv) {
+        nodingBuilder.setClipEnvelope(&clipEnv);
     }
 
     std::vector<Edge*> edges = nodingBuilder.build(
@@ -245,7 +374,7 @@ OverlayNG::computeEdgeOverlay()
     */
     // Sort the edges first, for comparison with JTS results
     // std::sort(edges.begin(), edges.end(), EdgeComparator);
-    OverlayGraph graph;
+    OverlayGraph graph(arenaScope.get());
     for (Edge* e : edges) {
         // Write out edge coordinates
         // std::cout << *e->getCoordinatesRO() << std::endl;
@@ -0,0 +1,405 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/operation/overlayng/PreparedOverlay.h>
+
+#include <geos/algorithm/locate/IndexedPointInAreaLocator.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/LineSegment.h>
+#include <geos/geom/LineString.h>
+#include <geos/geom/Location.h>
+#include <geos/geom/Point.h>
+#include <geos/geom/Polygon.h>
+#include <geos/geom/util/LinearComponentExtracter.h>
+#include <geos/index/chain/MonotoneChainBuilder.h>
+#include <geos/index/chain/MonotoneChainSelectAction.h>
+#include <geos/operation/overlayng/OverlayNG.h>
+#include <geos/operation/overlayng/OverlayNGRobust.h>
+#include <geos/operation/polygonize/Polygonizer.h>
+#include <geos/util/IllegalArgumentException.h>
+
+#include <algorithm>
+
+using geos::algorithm::locate::IndexedPointInAreaLocator;
+using geos::index::chain::MonotoneChain;
+using geos::index::chain::MonotoneChainBuilder;
+using geos::index::chain::MonotoneChainSelectAction;
+using namespace geos::geom;
+
+namespace geos {      // geos
+namespace operation { // geos.operation
+namespace overlayng { // geos.operation.overlayng
+
+namespace {
+
+/**
+ * Clips a line segment to a rectangle (using the Liang-Barsky algorithm).
+ * Endpoints created by clipping are placed exactly
+ * on the rectangle side they lie on, so that the clipped segments
+ * are noded correctly with the rectangle boundary.
+ * Their Z and M values are interpolated along the segment.
+ *
+ * @return false if the segment does not intersect the rectangle interior
+ */
+bool
+clipSegment(const Envelope& env, CoordinateXYZM& p0, CoordinateXYZM& p1)
+{
+    enum { LEFT, RIGHT, BOTTOM, TOP };
+
+    const double dx = p1.x - p0.x;
+    const double dy = p1.y - p0.y;
+    const double p[] = { -dx, dx, -dy, dy };
+    const double q[] = { p0.x - env.getMinX(), env.getMaxX() - p0.x,
+                         p0.y - env.getMinY(), env.getMaxY() - p0.y };
+
+    double t0 = 0.0;
+    double t1 = 1.0;
+    int side0 = -1;
+    int side1 = -1;
+
+    for (int k = 0; k < 4; k++) {
+        if (p[k] == 0.0) {
+            if (q[k] < 0.0) return false;
+            continue;
+        }
+        double r = q[k] / p[k];
+        if (p[k] < 0.0) {
+            if (r > t1) return false;
+            if (r > t0) {
+                t0 = r;
+                side0 = k;
+            }
+        }
+        else {
+            if (r < t0) return false;
+            if (r < t1) {
+                t1 = r;
+                side1 = k;
+            }
+        }
+    }
+
+    auto pointOnSide = [&env, &p0, &p1, dx, dy](int side, double t) {
+        CoordinateXYZM pt;
+        pt.z = p0.z + t * (p1.z - p0.z);
+        pt.m = p0.m + t * (p1.m - p0.m);
+        switch (side) {
+        case LEFT:
+        case RIGHT:
+            pt.x = side == LEFT ? env.getMinX() : env.getMaxX();
+            pt.y = std::min(env.getMaxY(), std::max(env.getMinY(), p0.y + t * dy));
+            break;
+        default:
+            pt.y = side == BOTTOM ? env.getMinY() : env.getMaxY();
+            pt.x = std::min(env.getMaxX(), std::max(env.getMinX(), p0.x + t * dx));
+        }
+        return pt;
+    };
+
+    CoordinateXYZM c0 = side0 < 0 ? p0 : pointOnSide(side0, t0);
+    CoordinateXYZM c1 = side1 < 0 ? p1 : pointOnSide(side1, t1);
+    if (c0.equals2D(c1)) {
+        return false;
+    }
+    p0 = c0;
+    p1 = c1;
+    return true;
+}
+
+/**
+ * Collects the sections of selected chain segments lying in the clip envelope,
+ * joining consecutive sections into lines.
+ */
+class ClippedSegmentCollector : public MonotoneChainSelectAction {
+
+public:
+
+    ClippedSegmentCollector(const Envelope& p_clipEnv)
+        : clipEnv(p_clipEnv)
+        , numSelected(0)
+    {}
+
+    void select(const MonotoneChain& mc, std::size_t start) override
+    {
+        // the chain context is its coordinate sequence (see addLinework)
+        const auto* pts = static_cast<const CoordinateSequence*>(mc.getContext());
+        CoordinateXYZM p0;
+        CoordinateXYZM p1;
+        pts->getAt(start, p0);
+        pts->getAt(start + 1, p1);
+        // chain selection may report segments which lie outside the envelope
+        if (! clipEnv.intersects(p0, p1)) {
+            return;
+        }
+        numSelected++;
+
+        if (! clipSegment(clipEnv, p0, p1)) {
+            return;
+        }
+
+        if (current == nullptr || ! current->back<CoordinateXY>().equals2D(p0)) {
+            finishLine();
+            current.reset(new CoordinateSequence(0u, pts->hasZ(), pts->hasM()));
+            current->add(p0);
+        }
+        current->add(p1);
+    }
+
+    void select(const LineSegment&) override {}
+
+    std::vector<std::unique_ptr<CoordinateSequence>>& getLines()
+    {
+        finishLine();
+        return lines;
+    }
+
+    std::size_t getNumSelected() const
+    {
+        return numSelected;
+    }
+
+private:
+
+    void finishLine()
+    {
+        if (current != nullptr) {
+            lines.push_back(std::move(current));
+        }
+    }
+
+    const Envelope& clipEnv;
+    std::size_t numSelected;
+    std::unique_ptr<CoordinateSequence> current;
+    std::vector<std::unique_ptr<CoordinateSequence>> lines;
+};
+
+/**
+ * Expands an envelope to include the selected chain segments
+ * (as in {@link RobustClipEnvelopeComputer}).
+ */
+class SegmentEnvelopeExpander : public MonotoneChainSelectAction {
+
+public:
+
+    SegmentEnvelopeExpander(const Envelope& p_targetEnv, Envelope& p_env)
+        : targetEnv(p_targetEnv)
+        , env(p_env)
+    {}
+
+    void select(const LineSegment& seg) override
+    {
+        if (targetEnv.intersects(seg.p0, seg.p1)) {
+            env.expandToInclude(seg.p0);
+            env.expandToInclude(seg.p1);
+        }
+    }
+
+private:
+
+    const Envelope& targetEnv;
+    Envelope& env;
+};
+
+} // anonymous namespace
+
+/*public*/
+PreparedOverlay::PreparedOverlay(const Geometry& p_mask)
+    : mask(p_mask)
+    , geomFact(p_mask.getFactory())
+    , isPolygonal(! p_mask.isEmpty() && p_mask.isPolygonal())
+    , isLineal(! p_mask.isEmpty() && p_mask.isLineal())
+    , numSegments(0)
+{
+    if (! isPolygonal && ! isLineal) {
+        return;
+    }
+
+    addLinework(mask);
+    for (const MonotoneChain& mc : chains) {
+        chainIndex.insert(mc.getEnvelope(), &mc);
+    }
+    chainIndex.build();
+
+    if (isPolygonal) {
+        locator.reset(new IndexedPointInAreaLocator(mask));
+        // force the locator index to be built, so that
+        // concurrent use does not modify it
+        CoordinateXY pt = *mask.getCoordinate();
+        locator->locate(&pt);
+    }
+}
+
+PreparedOverlay::~PreparedOverlay() = default;
+
+/*private*/
+void
+PreparedOverlay::addLinework(const Geometry& g)
+{
+    std::vector<const LineString*> lines;
+    geom::util::LinearComponentExtracter::getLines(g, lines);
+    for (const LineString* line : lines) {
+        const CoordinateSequence* pts = line->getCoordinatesRO();
+        if (pts->size() < 2) continue;
+        numSegments += pts->size() - 1;
+        MonotoneChainBuilder::getChains(pts, const_cast<CoordinateSequence*>(pts), chains);
+    }
+}
+
+/*public*/
+std::unique_ptr<Geometry>
+PreparedOverlay::intersection(const Geometry* geom) const
+{
+    return overlay(geom, OverlayNG::INTERSECTION);
+}
+
+/*public*/
+std::unique_ptr<Geometry>
+PreparedOverlay::difference(const Geometry* geom) const
+{
+    return overlay(geom, OverlayNG::DIFFERENCE);
+}
+
+/*public*/
+std::unique_ptr<Geometry>
+PreparedOverlay::overlay(const Geometry* geom, int opCode) const
+{
+    if (opCode != OverlayNG::INTERSECTION && opCode != OverlayNG::DIFFERENCE) {
+        throw geos::util::IllegalArgumentException("PreparedOverlay only supports intersection and difference");
+    }
+
+    std::unique_ptr<Geometry> clipped;
+    if (! geom->isEmpty()) {
+        clipped = clipMask(computeClipEnvelope(*geom->getEnvelopeInternal()));
+    }
+    if (clipped == nullptr) {
+        return OverlayNGRobust::Overlay(geom, &mask, opCode);
+    }
+    return OverlayNGRobust::Overlay(geom, clipped.get(), opCode);
+}
+
+/*private*/
+Envelope
+PreparedOverlay::computeClipEnvelope(const Envelope& env) const
+{
+    /**
+     * The clip envelope contains all mask segments which
+     * may interact with the operand, so that these are not
+     * altered by clipping.
+     * It is then expanded, so that the clip boundary
+     * lies strictly outside the operand.
+     */
+    Envelope clipEnv(env);
+    SegmentEnvelopeExpander expander(env, clipEnv);
+    chainIndex.query(env, [&env, &expander](const MonotoneChain* mc) {
+        mc->select(env, expander);
+    });
+
+    double size = std::max(clipEnv.getWidth(), clipEnv.getHeight());
+    if (size == 0.0) {
+        const Envelope* maskEnv = mask.getEnvelopeInternal();
+        size = std::max(maskEnv->getWidth(), maskEnv->getHeight());
+    }
+    if (size == 0.0) {
+        size = 1.0;
+    }
+    clipEnv.expandBy(size * CLIP_ENV_EXPANSION_FACTOR);
+    return clipEnv;
+}
+
+/*public*/
+std::unique_ptr<Geometry>
+PreparedOverlay::clipMask(const Envelope& clipEnv) const
+{
+    if (! isPolygonal && ! isLineal) {
+        return nullptr;
+    }
+    if (! clipEnv.intersects(mask.getEnvelopeInternal())) {
+        return geomFact->createEmpty(mask.getDimension());
+    }
+
+    ClippedSegmentCollector collector(clipEnv);
+    chainIndex.query(clipEnv, [&clipEnv, &collector](const MonotoneChain* mc) {
+        mc->select(clipEnv, collector);
+    });
+
+    if (static_cast<double>(collector.getNumSelected()) > MAX_CLIP_SEGMENT_FRACTION * static_cast<double>(numSegments)) {
+        return nullptr;
+    }
+
+    std::vector<std::unique_ptr<Geometry>> lines;
+    for (auto& pts : collector.getLines()) {
+        lines.push_back(geomFact->createLineString(std::move(pts)));
+    }
+
+    if (isLineal) {
+        if (lines.empty()) {
+            return geomFact->createLineString();
+        }
+        return geomFact->buildGeometry(std::move(lines));
+    }
+    return clipPolygonal(clipEnv, lines);
+}
+
+/*private*/
+std::unique_ptr<Geometry>
+PreparedOverlay::clipPolygonal(const Envelope& clipEnv,
+                               std::vector<std::unique_ptr<Geometry>>& lines) const
+{
+    /**
+     * If no mask boundary lies in the clip envelope,
+     * the envelope is either completely inside or outside the mask.
+     */
+    if (lines.empty()) {
+        CoordinateXY centre;
+        clipEnv.centre(centre);
+        if (locator->locate(&centre) == Location::INTERIOR) {
+            return geomFact->toGeometry(&clipEnv);
+        }
+        return geomFact->createPolygon();
+    }
+
+    /**
+     * Node the clipped mask linework together with the clip
+     * rectangle boundary, polygonize, and keep the faces
+     * which lie in the interior of the mask.
+     */
+    std::unique_ptr<Geometry> clipPoly = geomFact->toGeometry(&clipEnv);
+    lines.push_back(static_cast<Polygon*>(clipPoly.get())->getExteriorRing()->clone());
+
+    std::unique_ptr<Geometry> linework = geomFact->buildGeometry(std::move(lines));
+    std::unique_ptr<Geometry> nodedLinework = OverlayNGRobust::Union(linework.get());
+
+    polygonize::Polygonizer polygonizer;
+    polygonizer.add(nodedLinework.get());
+
+    std::vector<std::unique_ptr<Polygon>> faces = polygonizer.getPolygons();
+    std::vector<std::unique_ptr<Polygon>> interiorFaces;
+    for (auto& face : faces) {
+        std::unique_ptr<Point> pt = face->getInteriorPoint();
+        if (pt->isEmpty()) continue;
+        if (locator->locate(pt->getCoordinate()) == Location::INTERIOR) {
+            interiorFaces.push_back(std::move(face));
+        }
+    }
+    if (interiorFaces.empty()) {
+        return geomFact->createPolygon();
+    }
+    return geomFact->buildGeometry(std::move(interiorFaces));
+}
+
+
+} // namespace geos.operation.overlayng
+} // namespace geos.operation
+} // namespace geos
+
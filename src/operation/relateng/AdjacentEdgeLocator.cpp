@@ -0,0 +1,115 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/operation/relateng/AdjacentEdgeLocator.h>
+
+#include <geos/algorithm/PointLocation.h>
+#include <geos/geom/Dimension.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/GeometryCollection.h>
+#include <geos/geom/LinearRing.h>
+#include <geos/geom/Polygon.h>
+#include <geos/operation/relateng/NodeSections.h>
+#include <geos/operation/relateng/RelateGeometry.h>
+#include <geos/operation/relateng/RelateNode.h>
+
+using geos::algorithm::PointLocation;
+using geos::geom::CoordinateSequence;
+using geos::geom::CoordinateXY;
+using geos::geom::Dimension;
+using geos::geom::Geometry;
+using geos::geom::LinearRing;
+using geos::geom::Location;
+using geos::geom::Polygon;
+
+namespace geos {      // geos
+namespace operation { // geos.operation
+namespace relateng {  // geos.operation.relateng
+
+
+/* public */
+Location
+AdjacentEdgeLocator::locate(const CoordinateXY& p) const
+{
+    NodeSections sections(p);
+    for (const auto& ring : ringList) {
+        addSections(p, *ring, sections);
+    }
+    std::unique_ptr<RelateNode> node = sections.createNode();
+    return node->hasExteriorEdge(true) ? Location::BOUNDARY : Location::INTERIOR;
+}
+
+/* private */
+void
+AdjacentEdgeLocator::addSections(const CoordinateXY& p, const CoordinateSequence& ring,
+                                 NodeSections& sections) const
+{
+    for (std::size_t i = 0; i < ring.size() - 1; i++) {
+        const CoordinateXY& p0 = ring.getAt<CoordinateXY>(i);
+        const CoordinateXY& pnext = ring.getAt<CoordinateXY>(i + 1);
+
+        if (p.equals2D(pnext)) {
+            //-- segment final point is assigned to next segment
+            continue;
+        }
+        else if (p.equals2D(p0)) {
+            std::size_t iprev = i > 0 ? i - 1 : ring.size() - 2;
+            const CoordinateXY& pprev = ring.getAt<CoordinateXY>(iprev);
+            sections.addNodeSection(NodeSection(true, Dimension::A, 1, 0, nullptr, false, &pprev, p, &pnext));
+        }
+        else if (PointLocation::isOnSegment(p, p0, pnext)) {
+            sections.addNodeSection(NodeSection(true, Dimension::A, 1, 0, nullptr, false, &p0, p, &pnext));
+        }
+    }
+}
+
+/* private */
+void
+AdjacentEdgeLocator::init(const Geometry& geom)
+{
+    if (geom.isEmpty())
+        return;
+    addRings(geom);
+}
+
+/* private */
+void
+AdjacentEdgeLocator::addRings(const Geometry& geom)
+{
+    if (const Polygon* poly = dynamic_cast<const Polygon*>(&geom)) {
+        addRing(poly->getExteriorRing(), true);
+        for (std::size_t i = 0; i < poly->getNumInteriorRing(); i++) {
+            addRing(poly->getInteriorRingN(i), false);
+        }
+    }
+    else if (geom.isCollection()) {
+        //-- recurse through collections
+        for (std::size_t i = 0; i < geom.getNumGeometries(); i++) {
+            addRings(*geom.getGeometryN(i));
+        }
+    }
+}
+
+/* private */
+void
+AdjacentEdgeLocator::addRing(const LinearRing* ring, bool requireCW)
+{
+    if (ring->isEmpty())
+        return;
+    //-- orient and remove repeated points
+    ringList.push_back(RelateGeometry::orientAndRemoveRepeated(ring->getCoordinatesRO(), requireCW));
+}
+
+
+} // namespace geos.operation.relateng
+} // namespace geos.operation
+} // namespace geos
@@ -0,0 +1,93 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/operation/relateng/EdgeSegmentIntersector.h>
+
+#include <geos/operation/relateng/NodeSection.h>
+#include <geos/operation/relateng/RelateSegmentString.h>
+#include <geos/operation/relateng/TopologyComputer.h>
+
+using geos::geom::CoordinateXY;
+using geos::noding::SegmentString;
+
+namespace geos {      // geos
+namespace operation { // geos.operation
+namespace relateng {  // geos.operation.relateng
+
+
+/* public */
+bool
+EdgeSegmentIntersector::isDone() const
+{
+    return topoComputer.isResultKnown();
+}
+
+/* public */
+void
+EdgeSegmentIntersector::processIntersections(
+    SegmentString* ss0, std::size_t segIndex0,
+    SegmentString* ss1, std::size_t segIndex1)
+{
+    //--- don't bother intersecting a segment with itself
+    if (ss0 == ss1 && segIndex0 == segIndex1)
+        return;
+
+    RelateSegmentString* rss0 = static_cast<RelateSegmentString*>(ss0);
+    RelateSegmentString* rss1 = static_cast<RelateSegmentString*>(ss1);
+    //-- order the sections so that A is always first
+    if (rss0->isA()) {
+        addIntersections(rss0, segIndex0, rss1, segIndex1);
+    }
+    else {
+        addIntersections(rss1, segIndex1, rss0, segIndex0);
+    }
+}
+
+/* private */
+void
+EdgeSegmentIntersector::addIntersections(
+    RelateSegmentString* ssA, std::size_t segIndexA,
+    RelateSegmentString* ssB, std::size_t segIndexB)
+{
+    const CoordinateXY& a0 = ssA->getCoordinate<CoordinateXY>(segIndexA);
+    const CoordinateXY& a1 = ssA->getCoordinate<CoordinateXY>(segIndexA + 1);
+    const CoordinateXY& b0 = ssB->getCoordinate<CoordinateXY>(segIndexB);
+    const CoordinateXY& b1 = ssB->getCoordinate<CoordinateXY>(segIndexB + 1);
+
+    li.computeIntersection(a0, a1, b0, b1);
+
+    if (! li.hasIntersection())
+        return;
+
+    for (std::size_t i = 0; i < li.getIntersectionNum(); i++) {
+        const CoordinateXY& intPt = li.getIntersection(i);
+        /**
+         * Ensure endpoint intersections are added once only, for their canonical segments.
+         * Proper intersections lie on a unique segment so do not need to be checked.
+         * And it is important that the Containing Segment check not be used,
+         * since due to intersection computation roundoff,
+         * it is not reliable in that situation.
+         */
+        if (li.isProper()
+            || (ssA->isContainingSegment(segIndexA, intPt)
+                && ssB->isContainingSegment(segIndexB, intPt))) {
+            NodeSection nsa = ssA->createNodeSection(segIndexA, intPt);
+            NodeSection nsb = ssB->createNodeSection(segIndexB, intPt);
+            topoComputer.addIntersection(nsa, nsb);
+        }
+    }
+}
+
+
+} // namespace geos.operation.relateng
+} // namespace geos.operation
+} // namespace geos
@@ -0,0 +1,87 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/operation/relateng/EdgeSetIntersector.h>
+
+#include <geos/geom/Envelope.h>
+#include <geos/index/chain/MonotoneChainBuilder.h>
+#include <geos/noding/MCIndexSegmentSetMutualIntersector.h>
+#include <geos/operation/relateng/EdgeSegmentIntersector.h>
+#include <geos/operation/relateng/RelateSegmentString.h>
+
+using geos::geom::Envelope;
+using geos::index::chain::MonotoneChain;
+using geos::index::chain::MonotoneChainBuilder;
+using geos::noding::MCIndexSegmentSetMutualIntersector;
+
+namespace geos {      // geos
+namespace operation { // geos.operation
+namespace relateng {  // geos.operation.relateng
+
+
+EdgeSetIntersector::EdgeSetIntersector(
+    const std::vector<std::unique_ptr<RelateSegmentString>>& edgesA,
+    const std::vector<std::unique_ptr<RelateSegmentString>>& edgesB,
+    const Envelope* env)
+    : envelope(env)
+{
+    addEdges(edgesA);
+    addEdges(edgesB);
+    // build index to ensure thread-safety
+    for (const MonotoneChain& mc : monoChains) {
+        index.insert(mc.getEnvelope(), &mc);
+    }
+    index.build();
+}
+
+/* private */
+void
+EdgeSetIntersector::addEdges(const std::vector<std::unique_ptr<RelateSegmentString>>& segStrings)
+{
+    for (const auto& ss : segStrings) {
+        addToIndex(ss.get());
+    }
+}
+
+/* private */
+void
+EdgeSetIntersector::addToIndex(RelateSegmentString* segStr)
+{
+    std::vector<MonotoneChain> segChains;
+    MonotoneChainBuilder::getChains(segStr->getCoordinates(), segStr, segChains);
+    for (MonotoneChain& mc : segChains) {
+        if (envelope == nullptr || envelope->intersects(mc.getEnvelope())) {
+            monoChains.push_back(std::move(mc));
+        }
+    }
+}
+
+/* public */
+void
+EdgeSetIntersector::process(EdgeSegmentIntersector& intersector)
+{
+    MCIndexSegmentSetMutualIntersector::SegmentOverlapAction overlapAction(intersector);
+
+    //-- each pair of distinct chains is visited once only
+    index.queryPairs([&overlapAction, &intersector](const MonotoneChain* queryChain,
+                                                    const MonotoneChain* testChain) {
+        if (intersector.isDone())
+            return false;
+        testChain->computeOverlaps(queryChain, &overlapAction);
+        return ! intersector.isDone();
+    });
+}
+
+
+} // namespace geos.operation.relateng
+} // namespace geos.operation
+} // namespace geos
@@ -0,0 +1,225 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/operation/relateng/IMPatternMatcher.h>
+
+#include <geos/geom/Dimension.h>
+#include <geos/geom/Envelope.h>
+#include <geos/util/IllegalArgumentException.h>
+
+#include <algorithm>
+
+using geos::geom::Dimension;
+using geos::geom::Envelope;
+using geos::geom::IntersectionMatrix;
+using geos::geom::Location;
+
+namespace geos {      // geos
+namespace operation { // geos.operation
+namespace relateng {  // geos.operation.relateng
+
+namespace {
+
+const std::string&
+checkPattern(const std::string& imPattern)
+{
+    if (imPattern.length() != 9) {
+        throw util::IllegalArgumentException("Invalid DE-9IM pattern: " + imPattern);
+    }
+    return imPattern;
+}
+
+}
+
+
+IMPatternMatcher::IMPatternMatcher(const std::string& p_imPattern)
+    : imPattern(checkPattern(p_imPattern))
+    , patternMatrix(imPattern)
+{
+}
+
+/* public */
+std::string
+IMPatternMatcher::name() const
+{
+    return "IMPattern";
+}
+
+/* public */
+void
+IMPatternMatcher::init(int dA, int dB)
+{
+    IMPredicate::init(dA, dB);
+    //-- pattern may require an entry dimension which the inputs cannot provide
+    setValueIf(false, ! isDimsCompatible());
+    //-- a pattern which does not constrain any entries is always matched
+    if (! isKnown() && isDetermined()) {
+        setValue(valueIM());
+    }
+}
+
+/* private */
+bool
+IMPatternMatcher::isDimsCompatible() const
+{
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++) {
+            Location locA = static_cast<Location>(i);
+            Location locB = static_cast<Location>(j);
+            int patternEntry = patternMatrix.get(locA, locB);
+            if (patternEntry == Dimension::DONTCARE || patternEntry == Dimension::False)
+                continue;
+            int maxDim = std::min(maxDimension(locA, dimA), maxDimension(locB, dimB));
+            if (patternEntry == Dimension::True) {
+                if (maxDim < Dimension::P)
+                    return false;
+            }
+            else if (maxDim < patternEntry)
+                return false;
+        }
+    }
+    return true;
+}
+
+/* private static */
+int
+IMPatternMatcher::maxDimension(Location loc, int dim)
+{
+    switch (loc) {
+    case Location::INTERIOR:
+        return dim;
+    case Location::BOUNDARY:
+        //-- boundary of a point is empty
+        return dim > Dimension::P ? dim - 1 : Dimension::False;
+    default:
+        return Dimension::A;
+    }
+}
+
+/* public */
+bool
+IMPatternMatcher::requireCovers(bool isSourceA) const
+{
+    /**
+     * If the pattern requires the target to lie wholly inside the source
+     * then the source envelope must cover the target envelope.
+     * An interaction is also required, since an empty target
+     * would otherwise be rejected incorrectly.
+     */
+    Location locSrc = Location::EXTERIOR;
+    Location locInt = Location::INTERIOR;
+    Location locBdy = Location::BOUNDARY;
+    int entryInt = isSourceA ? patternMatrix.get(locSrc, locInt) : patternMatrix.get(locInt, locSrc);
+    int entryBdy = isSourceA ? patternMatrix.get(locSrc, locBdy) : patternMatrix.get(locBdy, locSrc);
+    return entryInt == Dimension::False
+        && entryBdy == Dimension::False
+        && requireInteraction(patternMatrix);
+}
+
+/* public */
+bool
+IMPatternMatcher::requireExteriorCheck(bool isSourceA) const
+{
+    //-- exterior locations are only needed if the pattern constrains them
+    Location locExt = Location::EXTERIOR;
+    Location locInt = Location::INTERIOR;
+    Location locBdy = Location::BOUNDARY;
+    int entryInt = isSourceA ? patternMatrix.get(locInt, locExt) : patternMatrix.get(locExt, locInt);
+    int entryBdy = isSourceA ? patternMatrix.get(locBdy, locExt) : patternMatrix.get(locExt, locBdy);
+    return entryInt != Dimension::DONTCARE
+        || entryBdy != Dimension::DONTCARE;
+}
+
+/* public */
+void
+IMPatternMatcher::init(const Envelope& envA, const Envelope& envB)
+{
+    //-- if pattern specifies any non-E/non-E interaction, envelopes must not be disjoint
+    bool requiresInteraction = requireInteraction(patternMatrix);
+    bool isDisjoint = envA.disjoint(envB);
+    setValueIf(false, requiresInteraction && isDisjoint);
+}
+
+/* public */
+bool
+IMPatternMatcher::requireInteraction() const
+{
+    return requireInteraction(patternMatrix);
+}
+
+/* private static */
+bool
+IMPatternMatcher::requireInteraction(const IntersectionMatrix& im)
+{
+    return isInteraction(im.get(Location::INTERIOR, Location::INTERIOR))
+        || isInteraction(im.get(Location::INTERIOR, Location::BOUNDARY))
+        || isInteraction(im.get(Location::BOUNDARY, Location::INTERIOR))
+        || isInteraction(im.get(Location::BOUNDARY, Location::BOUNDARY));
+}
+
+/* private static */
+bool
+IMPatternMatcher::isInteraction(int imDim)
+{
+    return imDim == Dimension::True || imDim >= Dimension::P;
+}
+
+/* protected */
+bool
+IMPatternMatcher::isDetermined() const
+{
+    /**
+     * Matrix entries only increase in dimension as topology is computed.
+     * The predicate can be short-circuited (as false) if
+     * any computed entry is greater than the mask value.
+     * It can be short-circuited (as true) if every constrained entry
+     * is satisfied and cannot change any further;
+     * i.e. it is a T entry which is known,
+     * or a 2 entry which has reached the maximum dimension.
+     */
+    bool isMatchFinal = true;
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++) {
+            Location locA = static_cast<Location>(i);
+            Location locB = static_cast<Location>(j);
+            int patternEntry = patternMatrix.get(locA, locB);
+            if (patternEntry == Dimension::DONTCARE)
+                continue;
+            int matrixVal = getDimension(locA, locB);
+            //-- mask entry TRUE requires a known matrix entry
+            if (patternEntry == Dimension::True) {
+                if (matrixVal < 0)
+                    isMatchFinal = false;
+            }
+            //-- result is known (false) if matrix entry has exceeded mask
+            else if (matrixVal > patternEntry) {
+                return true;
+            }
+            else if (patternEntry < Dimension::A || matrixVal < patternEntry) {
+                isMatchFinal = false;
+            }
+        }
+    }
+    return isMatchFinal;
+}
+
+/* protected */
+bool
+IMPatternMatcher::valueIM() const
+{
+    return intMatrix.matches(imPattern);
+}
+
+
+} // namespace geos.operation.relateng
+} // namespace geos.operation
+} // namespace geos
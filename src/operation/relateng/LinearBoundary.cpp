@@ -0,0 +1,82 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/operation/relateng/LinearBoundary.h>
+
+#include <geos/algorithm/BoundaryNodeRule.h>
+#include <geos/geom/LineString.h>
+
+using geos::algorithm::BoundaryNodeRule;
+using geos::geom::CoordinateXY;
+using geos::geom::LineString;
+
+namespace geos {      // geos
+namespace operation { // geos.operation
+namespace relateng {  // geos.operation.relateng
+
+
+LinearBoundary::LinearBoundary(const std::vector<const LineString*>& lines,
+                               const BoundaryNodeRule& bnRule)
+    : boundaryNodeRule(bnRule)
+{
+    //assert: dim(geom) == 1
+    computeBoundaryPoints(lines, vertexDegree);
+    m_hasBoundary = checkBoundary();
+}
+
+/* private */
+bool
+LinearBoundary::checkBoundary() const
+{
+    for (const auto& entry : vertexDegree) {
+        if (boundaryNodeRule.isInBoundary(entry.second)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/* public */
+bool
+LinearBoundary::isBoundary(const CoordinateXY& pt) const
+{
+    auto it = vertexDegree.find(pt);
+    if (it == vertexDegree.end())
+        return false;
+    return boundaryNodeRule.isInBoundary(it->second);
+}
+
+/* private static */
+void
+LinearBoundary::computeBoundaryPoints(const std::vector<const LineString*>& lines,
+                                      VertexDegreeMap& degree)
+{
+    for (const LineString* line : lines) {
+        if (line->isEmpty())
+            continue;
+        const geom::CoordinateSequence* seq = line->getCoordinatesRO();
+        addEndpoint(seq->front<CoordinateXY>(), degree);
+        addEndpoint(seq->back<CoordinateXY>(), degree);
+    }
+}
+
+/* private static */
+void
+LinearBoundary::addEndpoint(const CoordinateXY& p, VertexDegreeMap& degree)
+{
+    degree[p] += 1;
+}
+
+
+} // namespace geos.operation.relateng
+} // namespace geos.operation
+} // namespace geos
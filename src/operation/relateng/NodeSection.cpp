@@ -0,0 +1,120 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/operation/relateng/NodeSection.h>
+
+#include <geos/algorithm/PolygonNodeTopology.h>
+#include <geos/geom/Dimension.h>
+
+#include <sstream>
+
+using geos::algorithm::PolygonNodeTopology;
+using geos::geom::CoordinateXY;
+using geos::geom::Dimension;
+
+namespace geos {      // geos
+namespace operation { // geos.operation
+namespace relateng {  // geos.operation.relateng
+
+
+/* public */
+bool
+NodeSection::EdgeAngleComparator::operator()(const NodeSection& ns1, const NodeSection& ns2) const
+{
+    return PolygonNodeTopology::compareAngle(&ns1.m_nodePt, ns1.getVertex(0), ns2.getVertex(0)) < 0;
+}
+
+/* public static */
+bool
+NodeSection::isAreaArea(const NodeSection& a, const NodeSection& b)
+{
+    return a.dimension() == Dimension::A && b.dimension() == Dimension::A;
+}
+
+/* public static */
+bool
+NodeSection::isProper(const NodeSection& a, const NodeSection& b)
+{
+    return a.isProper() && b.isProper();
+}
+
+/* public */
+bool
+NodeSection::isArea() const
+{
+    return m_dim == Dimension::A;
+}
+
+/* public */
+int
+NodeSection::compareTo(const NodeSection& o) const
+{
+    //-- sort A before B
+    if (m_isA != o.m_isA) {
+        if (m_isA) return -1;
+        return 1;
+    }
+    //-- sort on dimensions
+    int compDim = compare(m_dim, o.m_dim);
+    if (compDim != 0) return compDim;
+
+    //-- sort on id and ring id
+    int compId = compare(m_id, o.m_id);
+    if (compId != 0) return compId;
+
+    int compRingId = compare(m_ringId, o.m_ringId);
+    if (compRingId != 0) return compRingId;
+
+    //-- sort on edge coordinates
+    int compV0 = compareWithNull(m_v0, o.m_v0);
+    if (compV0 != 0) return compV0;
+
+    return compareWithNull(m_v1, o.m_v1);
+}
+
+/* private static */
+int
+NodeSection::compareWithNull(const CoordinateXY* v0, const CoordinateXY* v1)
+{
+    if (v0 == nullptr) {
+        if (v1 == nullptr)
+            return 0;
+        //-- null is lower than non-null
+        return -1;
+    }
+    // v0 is non-null
+    if (v1 == nullptr)
+        return 1;
+    return v0->compareTo(*v1);
+}
+
+/* public */
+std::string
+NodeSection::toString() const
+{
+    std::stringstream ss;
+    ss << (m_isA ? "A" : "B") << m_dim;
+    if (m_id >= 0) {
+        ss << "[" << m_id << ":" << m_ringId << "]";
+    }
+    ss << ": ";
+    if (m_v0 == nullptr) ss << "null"; else ss << *m_v0;
+    ss << " -> " << m_nodePt << " -> ";
+    if (m_v1 == nullptr) ss << "null"; else ss << *m_v1;
+    if (m_isNodeAtVertex) ss << " (V)";
+    return ss.str();
+}
+
+
+} // namespace geos.operation.relateng
+} // namespace geos.operation
+} // namespace geos
@@ -0,0 +1,124 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/operation/relateng/NodeSections.h>
+
+#include <geos/operation/relateng/PolygonNodeConverter.h>
+#include <geos/operation/relateng/RelateNode.h>
+
+#include <algorithm>
+
+using geos::geom::Geometry;
+
+namespace geos {      // geos
+namespace operation { // geos.operation
+namespace relateng {  // geos.operation.relateng
+
+
+/* public */
+bool
+NodeSections::hasInteractionAB() const
+{
+    bool isA = false;
+    bool isB = false;
+    for (const NodeSection& ns : sections) {
+        if (ns.isA())
+            isA = true;
+        else
+            isB = true;
+        if (isA && isB)
+            return true;
+    }
+    return false;
+}
+
+/* public */
+const Geometry*
+NodeSections::getPolygonal(bool isA) const
+{
+    for (const NodeSection& ns : sections) {
+        if (ns.isA() == isA) {
+            const Geometry* poly = ns.getPolygonal();
+            if (poly != nullptr)
+                return poly;
+        }
+    }
+    return nullptr;
+}
+
+/* public */
+std::unique_ptr<RelateNode>
+NodeSections::createNode()
+{
+    prepareSections();
+
+    std::unique_ptr<RelateNode> node(new RelateNode(nodePt));
+    std::size_t i = 0;
+    while (i < sections.size()) {
+        const NodeSection& ns = sections[i];
+        //-- if there multiple polygon sections incident at node convert them to maximal-ring structure
+        if (ns.isArea() && hasMultiplePolygonSections(sections, i)) {
+            std::vector<NodeSection> polySections = collectPolygonSections(sections, i);
+            std::vector<NodeSection> nsConvert = PolygonNodeConverter::convert(polySections);
+            node->addEdges(nsConvert);
+            i += polySections.size();
+        }
+        else {
+            //-- the most common case is a line or a single polygon ring section
+            node->addEdges(ns);
+            i += 1;
+        }
+    }
+    return node;
+}
+
+/* private */
+void
+NodeSections::prepareSections()
+{
+    std::stable_sort(sections.begin(), sections.end(),
+        [](const NodeSection& a, const NodeSection& b) {
+            return a.compareTo(b) < 0;
+        });
+}
+
+/* private static */
+bool
+NodeSections::hasMultiplePolygonSections(const std::vector<NodeSection>& secs, std::size_t i)
+{
+    //-- if last section can only be one
+    if (i >= secs.size() - 1)
+        return false;
+    //-- check if there are at least two sections for same polygon
+    const NodeSection& ns = secs[i];
+    const NodeSection& nsNext = secs[i + 1];
+    return ns.isSamePolygon(nsNext);
+}
+
+/* private static */
+std::vector<NodeSection>
+NodeSections::collectPolygonSections(const std::vector<NodeSection>& secs, std::size_t i)
+{
+    std::vector<NodeSection> polySections;
+    //-- note ids are only unique to a geometry
+    const NodeSection& polySection = secs[i];
+    while (i < secs.size() && polySection.isSamePolygon(secs[i])) {
+        polySections.push_back(secs[i]);
+        i++;
+    }
+    return polySections;
+}
+
+
+} // namespace geos.operation.relateng
+} // namespace geos.operation
+} // namespace geos
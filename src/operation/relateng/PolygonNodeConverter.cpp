@@ -0,0 +1,148 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/operation/relateng/PolygonNodeConverter.h>
+
+#include <geos/geom/Dimension.h>
+
+#include <algorithm>
+
+using geos::geom::CoordinateXY;
+using geos::geom::Dimension;
+
+namespace geos {      // geos
+namespace operation { // geos.operation
+namespace relateng {  // geos.operation.relateng
+
+
+/* public static */
+std::vector<NodeSection>
+PolygonNodeConverter::convert(std::vector<NodeSection>& polySections)
+{
+    std::stable_sort(polySections.begin(), polySections.end(),
+                     NodeSection::EdgeAngleComparator());
+
+    //TODO: move uniquing up to caller
+    std::vector<NodeSection> sections = extractUnique(polySections);
+    if (sections.size() == 1)
+        return sections;
+
+    //-- find shell section index
+    int shellIndex = findShell(sections);
+    if (shellIndex < 0) {
+        return convertHoles(sections);
+    }
+
+    //-- at least one shell is present.  Handle multiple ones if present
+    std::vector<NodeSection> convertedSections;
+    std::size_t nextShellIndex = static_cast<std::size_t>(shellIndex);
+    do {
+        nextShellIndex = convertShellAndHoles(sections, nextShellIndex, convertedSections);
+    } while (nextShellIndex != static_cast<std::size_t>(shellIndex));
+
+    return convertedSections;
+}
+
+/* private static */
+std::size_t
+PolygonNodeConverter::convertShellAndHoles(
+    const std::vector<NodeSection>& sections,
+    std::size_t shellIndex,
+    std::vector<NodeSection>& convertedSections)
+{
+    const NodeSection& shellSection = sections[shellIndex];
+    const CoordinateXY* inVertex = shellSection.getVertex(0);
+    std::size_t i = next(sections, shellIndex);
+    while (! sections[i].isShell()) {
+        const NodeSection& holeSection = sections[i];
+        // Assert: holeSection.isShell() = false
+        const CoordinateXY* outVertex = holeSection.getVertex(1);
+        convertedSections.push_back(createSection(shellSection, inVertex, outVertex));
+
+        inVertex = holeSection.getVertex(0);
+        i = next(sections, i);
+    }
+    //-- create final section for corner from last hole to shell
+    const CoordinateXY* outVertex = shellSection.getVertex(1);
+    convertedSections.push_back(createSection(shellSection, inVertex, outVertex));
+    return i;
+}
+
+/* private static */
+std::vector<NodeSection>
+PolygonNodeConverter::convertHoles(const std::vector<NodeSection>& sections)
+{
+    std::vector<NodeSection> convertedSections;
+    const NodeSection& copySection = sections[0];
+    for (std::size_t i = 0; i < sections.size(); i++) {
+        std::size_t inext = next(sections, i);
+        const CoordinateXY* inVertex = sections[i].getVertex(0);
+        const CoordinateXY* outVertex = sections[inext].getVertex(1);
+        convertedSections.push_back(createSection(copySection, inVertex, outVertex));
+    }
+    return convertedSections;
+}
+
+/* private static */
+NodeSection
+PolygonNodeConverter::createSection(const NodeSection& ns,
+    const CoordinateXY* v0, const CoordinateXY* v1)
+{
+    return NodeSection(ns.isA(),
+                       Dimension::A,
+                       ns.id(), 0,
+                       ns.getPolygonal(),
+                       ns.isNodeAtVertex(),
+                       v0, ns.nodePt(), v1);
+}
+
+/* private static */
+std::vector<NodeSection>
+PolygonNodeConverter::extractUnique(const std::vector<NodeSection>& sections)
+{
+    std::vector<NodeSection> uniqueSections;
+    const NodeSection* lastUnique = &sections[0];
+    uniqueSections.push_back(*lastUnique);
+    for (const NodeSection& ns : sections) {
+        if (0 != lastUnique->compareTo(ns)) {
+            uniqueSections.push_back(ns);
+            lastUnique = &ns;
+        }
+    }
+    return uniqueSections;
+}
+
+/* private static */
+std::size_t
+PolygonNodeConverter::next(const std::vector<NodeSection>& ns, std::size_t i)
+{
+    std::size_t nxt = i + 1;
+    if (nxt >= ns.size())
+        nxt = 0;
+    return nxt;
+}
+
+/* private static */
+int
+PolygonNodeConverter::findShell(const std::vector<NodeSection>& polySections)
+{
+    for (std::size_t i = 0; i < polySections.size(); i++) {
+        if (polySections[i].isShell())
+            return static_cast<int>(i);
+    }
+    return -1;
+}
+
+
+} // namespace geos.operation.relateng
+} // namespace geos.operation
+} // namespace geos
@@ -0,0 +1,310 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/operation/relateng/RelateEdge.h>
+
+#include <geos/algorithm/PolygonNodeTopology.h>
+#include <geos/geom/Dimension.h>
+#include <geos/geom/Position.h>
+#include <geos/operation/relateng/RelateNode.h>
+#include <geos/util/IllegalStateException.h>
+
+#include <sstream>
+
+using geos::algorithm::PolygonNodeTopology;
+using geos::geom::CoordinateXY;
+using geos::geom::Dimension;
+using geos::geom::Location;
+using geos::geom::Position;
+
+namespace geos {      // geos
+namespace operation { // geos.operation
+namespace relateng {  // geos.operation.relateng
+
+constexpr int RelateEdge::DIM_UNKNOWN;
+constexpr Location RelateEdge::LOC_UNKNOWN;
+
+
+RelateEdge::RelateEdge(const RelateNode* p_node, const CoordinateXY* pt, bool isA, bool isForward)
+    : node(p_node)
+    , dirPt(pt)
+{
+    setLocationsArea(isA, isForward);
+}
+
+RelateEdge::RelateEdge(const RelateNode* p_node, const CoordinateXY* pt, bool isA)
+    : node(p_node)
+    , dirPt(pt)
+{
+    setLocationsLine(isA);
+}
+
+/* public static */
+std::unique_ptr<RelateEdge>
+RelateEdge::create(const RelateNode* node, const CoordinateXY* dirPt, bool isA, int dim, bool isForward)
+{
+    if (dim == Dimension::A) {
+        //-- create an area edge
+        return std::unique_ptr<RelateEdge>(new RelateEdge(node, dirPt, isA, isForward));
+    }
+    //-- create line edge
+    return std::unique_ptr<RelateEdge>(new RelateEdge(node, dirPt, isA));
+}
+
+/* public static */
+int
+RelateEdge::findKnownEdgeIndex(const std::vector<std::unique_ptr<RelateEdge>>& edges, bool isA)
+{
+    for (std::size_t i = 0; i < edges.size(); i++) {
+        if (edges[i]->isKnown(isA))
+            return static_cast<int>(i);
+    }
+    return -1;
+}
+
+/* public static */
+void
+RelateEdge::setAreaInterior(const std::vector<std::unique_ptr<RelateEdge>>& edges, bool isA)
+{
+    for (const auto& e : edges) {
+        e->setAreaInterior(isA);
+    }
+}
+
+/* private */
+void
+RelateEdge::setLocationsLine(bool isA)
+{
+    if (isA) {
+        aDim = Dimension::L;
+        aLocLeft = Location::EXTERIOR;
+        aLocRight = Location::EXTERIOR;
+        aLocLine = Location::INTERIOR;
+    }
+    else {
+        bDim = Dimension::L;
+        bLocLeft = Location::EXTERIOR;
+        bLocRight = Location::EXTERIOR;
+        bLocLine = Location::INTERIOR;
+    }
+}
+
+/* private */
+void
+RelateEdge::setLocationsArea(bool isA, bool isForward)
+{
+    Location locLeft = isForward ? Location::EXTERIOR : Location::INTERIOR;
+    Location locRight = isForward ? Location::INTERIOR : Location::EXTERIOR;
+    if (isA) {
+        aDim = Dimension::A;
+        aLocLeft = locLeft;
+        aLocRight = locRight;
+        aLocLine = Location::BOUNDARY;
+    }
+    else {
+        bDim = Dimension::A;
+        bLocLeft = locLeft;
+        bLocRight = locRight;
+        bLocLine = Location::BOUNDARY;
+    }
+}
+
+/* public */
+int
+RelateEdge::compareToEdge(const CoordinateXY* edgeDirPt) const
+{
+    return PolygonNodeTopology::compareAngle(&node->getCoordinate(), dirPt, edgeDirPt);
+}
+
+/* public */
+void
+RelateEdge::merge(bool isA, int dim, bool isForward)
+{
+    Location locEdge = Location::INTERIOR;
+    Location locLeft = Location::EXTERIOR;
+    Location locRight = Location::EXTERIOR;
+    if (dim == Dimension::A) {
+        locEdge = Location::BOUNDARY;
+        locLeft = isForward ? Location::EXTERIOR : Location::INTERIOR;
+        locRight = isForward ? Location::INTERIOR : Location::EXTERIOR;
+    }
+
+    if (! isKnown(isA)) {
+        setDimension(isA, dim);
+        setOn(isA, locEdge);
+        setLeft(isA, locLeft);
+        setRight(isA, locRight);
+        return;
+    }
+
+    // Assert: node-dirpt is collinear with node-pt
+    mergeDimEdgeLoc(isA, locEdge);
+    mergeSideLocation(isA, Position::LEFT, locLeft);
+    mergeSideLocation(isA, Position::RIGHT, locRight);
+}
+
+/* private */
+void
+RelateEdge::mergeDimEdgeLoc(bool isA, Location locEdge)
+{
+    //TODO: this logic needs work - ie handling A edges marked as Interior
+    int dim = locEdge == Location::BOUNDARY ? Dimension::A : Dimension::L;
+    if (dim == Dimension::A && dimension(isA) == Dimension::L) {
+        setDimension(isA, dim);
+        setOn(isA, Location::BOUNDARY);
+    }
+}
+
+/* private */
+void
+RelateEdge::mergeSideLocation(bool isA, int pos, Location loc)
+{
+    Location currLoc = location(isA, pos);
+    //-- INTERIOR takes precedence over EXTERIOR
+    if (currLoc != Location::INTERIOR) {
+        setLocation(isA, pos, loc);
+    }
+}
+
+/* private */
+void
+RelateEdge::setDimension(bool isA, int dimension)
+{
+    if (isA)
+        aDim = dimension;
+    else
+        bDim = dimension;
+}
+
+/* public */
+void
+RelateEdge::setLocation(bool isA, int pos, Location loc)
+{
+    switch (pos) {
+    case Position::LEFT:
+        setLeft(isA, loc);
+        break;
+    case Position::RIGHT:
+        setRight(isA, loc);
+        break;
+    case Position::ON:
+        setOn(isA, loc);
+        break;
+    }
+}
+
+/* public */
+void
+RelateEdge::setAllLocations(bool isA, Location loc)
+{
+    setLeft(isA, loc);
+    setRight(isA, loc);
+    setOn(isA, loc);
+}
+
+/* public */
+void
+RelateEdge::setUnknownLocations(bool isA, Location loc)
+{
+    if (! isKnown(isA, Position::LEFT)) {
+        setLocation(isA, Position::LEFT, loc);
+    }
+    if (! isKnown(isA, Position::RIGHT)) {
+        setLocation(isA, Position::RIGHT, loc);
+    }
+    if (! isKnown(isA, Position::ON)) {
+        setLocation(isA, Position::ON, loc);
+    }
+}
+
+/* private */
+void
+RelateEdge::setLeft(bool isA, Location loc)
+{
+    if (isA)
+        aLocLeft = loc;
+    else
+        bLocLeft = loc;
+}
+
+/* private */
+void
+RelateEdge::setRight(bool isA, Location loc)
+{
+    if (isA)
+        aLocRight = loc;
+    else
+        bLocRight = loc;
+}
+
+/* private */
+void
+RelateEdge::setOn(bool isA, Location loc)
+{
+    if (isA)
+        aLocLine = loc;
+    else
+        bLocLine = loc;
+}
+
+/* public */
+Location
+RelateEdge::location(bool isA, int position) const
+{
+    if (isA) {
+        switch (position) {
+        case Position::LEFT: return aLocLeft;
+        case Position::RIGHT: return aLocRight;
+        case Position::ON: return aLocLine;
+        }
+    }
+    else {
+        switch (position) {
+        case Position::LEFT: return bLocLeft;
+        case Position::RIGHT: return bLocRight;
+        case Position::ON: return bLocLine;
+        }
+    }
+    throw util::IllegalStateException("Unknown edge position");
+}
+
+/* public */
+void
+RelateEdge::setAreaInterior(bool isA)
+{
+    if (isA) {
+        aLocLeft = Location::INTERIOR;
+        aLocRight = Location::INTERIOR;
+        aLocLine = Location::INTERIOR;
+    }
+    else {
+        bLocLeft = Location::INTERIOR;
+        bLocRight = Location::INTERIOR;
+        bLocLine = Location::INTERIOR;
+    }
+}
+
+/* public */
+std::string
+RelateEdge::toString() const
+{
+    std::stringstream ss;
+    ss << "-> " << *dirPt
+       << " A:" << aDim << "(" << aLocLeft << "/" << aLocLine << "/" << aLocRight << ")"
+       << " B:" << bDim << "(" << bLocLeft << "/" << bLocLine << "/" << bLocRight << ")";
+    return ss.str();
+}
+
+
+} // namespace geos.operation.relateng
+} // namespace geos.operation
+} // namespace geos
@@ -0,0 +1,444 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/operation/relateng/RelateGeometry.h>
+
+#include <geos/algorithm/BoundaryNodeRule.h>
+#include <geos/algorithm/Orientation.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/LineString.h>
+#include <geos/geom/LinearRing.h>
+#include <geos/geom/Point.h>
+#include <geos/geom/Polygon.h>
+#include <geos/geom/util/ComponentCoordinateExtracter.h>
+#include <geos/geom/util/GeometryExtracter.h>
+#include <geos/operation/relateng/DimensionLocation.h>
+#include <geos/operation/relateng/RelatePointLocator.h>
+#include <geos/operation/relateng/RelateSegmentString.h>
+
+using geos::algorithm::BoundaryNodeRule;
+using geos::algorithm::Orientation;
+using geos::geom::CoordinateSequence;
+using geos::geom::CoordinateXY;
+using geos::geom::Dimension;
+using geos::geom::Envelope;
+using geos::geom::Geometry;
+using geos::geom::GeometryTypeId;
+using geos::geom::LinearRing;
+using geos::geom::LineString;
+using geos::geom::Location;
+using geos::geom::Point;
+using geos::geom::Polygon;
+using geos::geom::util::GeometryExtracter;
+
+namespace geos {      // geos
+namespace operation { // geos.operation
+namespace relateng {  // geos.operation.relateng
+
+constexpr bool RelateGeometry::GEOM_A;
+constexpr bool RelateGeometry::GEOM_B;
+
+
+RelateGeometry::RelateGeometry(const Geometry& input, bool isPrepared,
+                               const BoundaryNodeRule& bnRule)
+    : geom(input)
+    , m_isPrepared(isPrepared)
+    , geomEnv(*input.getEnvelopeInternal())
+    , boundaryNodeRule(bnRule)
+{
+    //-- cache geometry metadata
+    isGeomEmpty = geom.isEmpty();
+    geomDim = input.getDimension();
+    analyzeDimensions();
+    isLineZeroLen = isZeroLengthLine(geom);
+}
+
+RelateGeometry::RelateGeometry(const Geometry& input, const BoundaryNodeRule& bnRule)
+    : RelateGeometry(input, false, bnRule)
+{}
+
+RelateGeometry::RelateGeometry(const Geometry& input)
+    : RelateGeometry(input, false, BoundaryNodeRule::getBoundaryOGCSFS())
+{}
+
+RelateGeometry::~RelateGeometry() = default;
+
+/* private */
+bool
+RelateGeometry::isZeroLengthLine(const Geometry& g) const
+{
+    // avoid expensive zero-length calculation if not linear
+    if (getDimension() != Dimension::L)
+        return false;
+    return isZeroLength(g);
+}
+
+/* private */
+void
+RelateGeometry::analyzeDimensions()
+{
+    if (isGeomEmpty) {
+        return;
+    }
+    GeometryTypeId typeId = geom.getGeometryTypeId();
+    if (typeId == GeometryTypeId::GEOS_POINT || typeId == GeometryTypeId::GEOS_MULTIPOINT) {
+        hasPoints = true;
+        geomDim = Dimension::P;
+        return;
+    }
+    if (typeId == GeometryTypeId::GEOS_LINESTRING || typeId == GeometryTypeId::GEOS_LINEARRING ||
+        typeId == GeometryTypeId::GEOS_MULTILINESTRING) {
+        hasLines = true;
+        geomDim = Dimension::L;
+        return;
+    }
+    if (typeId == GeometryTypeId::GEOS_POLYGON || typeId == GeometryTypeId::GEOS_MULTIPOLYGON) {
+        hasAreas = true;
+        geomDim = Dimension::A;
+        return;
+    }
+    //-- analyze a (possibly mixed type) collection
+    analyzeElementDimensions(geom);
+}
+
+/* private */
+void
+RelateGeometry::analyzeElementDimensions(const Geometry& g)
+{
+    for (std::size_t i = 0; i < g.getNumGeometries(); i++) {
+        const Geometry* elem = g.getGeometryN(i);
+        if (elem->isCollection()) {
+            analyzeElementDimensions(*elem);
+            continue;
+        }
+        if (elem->isEmpty())
+            continue;
+        switch (elem->getDimension()) {
+        case Dimension::P:
+            hasPoints = true;
+            if (geomDim < Dimension::P) geomDim = Dimension::P;
+            break;
+        case Dimension::L:
+            hasLines = true;
+            if (geomDim < Dimension::L) geomDim = Dimension::L;
+            break;
+        case Dimension::A:
+            hasAreas = true;
+            if (geomDim < Dimension::A) geomDim = Dimension::A;
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+/* private static */
+bool
+RelateGeometry::isZeroLength(const Geometry& g)
+{
+    std::vector<const LineString*> lines;
+    GeometryExtracter::extract<LineString>(g, lines);
+    for (const LineString* line : lines) {
+        if (! isZeroLength(line))
+            return false;
+    }
+    return true;
+}
+
+/* private static */
+bool
+RelateGeometry::isZeroLength(const LineString* line)
+{
+    if (line->getNumPoints() >= 2) {
+        const CoordinateSequence* seq = line->getCoordinatesRO();
+        const CoordinateXY& p0 = seq->getAt<CoordinateXY>(0);
+        for (std::size_t i = 0 ; i < seq->size(); i++) {
+            const CoordinateXY& pi = seq->getAt<CoordinateXY>(i);
+            //-- most non-zero-len lines will trigger this right away
+            if (! p0.equals2D(pi)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/* public */
+bool
+RelateGeometry::hasDimension(int dim) const
+{
+    switch (dim) {
+    case Dimension::P: return hasPoints;
+    case Dimension::L: return hasLines;
+    case Dimension::A: return hasAreas;
+    }
+    return false;
+}
+
+/* public */
+int
+RelateGeometry::getDimensionReal() const
+{
+    if (isGeomEmpty) return Dimension::False;
+    if (getDimension() == Dimension::L && isLineZeroLen)
+        return Dimension::P;
+    if (hasAreas) return Dimension::A;
+    if (hasLines) return Dimension::L;
+    return Dimension::P;
+}
+
+/* private */
+RelatePointLocator*
+RelateGeometry::getLocator()
+{
+    if (locator == nullptr)
+        locator.reset(new RelatePointLocator(geom, m_isPrepared, boundaryNodeRule));
+    return locator.get();
+}
+
+/* public */
+bool
+RelateGeometry::isNodeInArea(const CoordinateXY& nodePt, const Geometry* parentPolygonal)
+{
+    int dimLoc = getLocator()->locateNodeWithDim(nodePt, parentPolygonal);
+    return dimLoc == DimensionLocation::AREA_INTERIOR;
+}
+
+/* public */
+int
+RelateGeometry::locateLineEndWithDim(const CoordinateXY& p)
+{
+    return getLocator()->locateLineEndWithDim(p);
+}
+
+/* public */
+Location
+RelateGeometry::locateAreaVertex(const CoordinateXY& pt)
+{
+    /**
+     * Can pass a null polygon, because the point is an exact vertex,
+     * which will be detected as being on the boundary of its polygon
+     */
+    return locateNode(pt, nullptr);
+}
+
+/* public */
+Location
+RelateGeometry::locateNode(const CoordinateXY& pt, const Geometry* parentPolygonal)
+{
+    return getLocator()->locateNode(pt, parentPolygonal);
+}
+
+/* public */
+int
+RelateGeometry::locateWithDim(const CoordinateXY& pt)
+{
+    return getLocator()->locateWithDim(pt);
+}
+
+/* public */
+bool
+RelateGeometry::isSelfNodingRequired() const
+{
+    GeometryTypeId typeId = geom.getGeometryTypeId();
+    if (typeId == GeometryTypeId::GEOS_POINT
+        || typeId == GeometryTypeId::GEOS_MULTIPOINT
+        || typeId == GeometryTypeId::GEOS_POLYGON
+        || typeId == GeometryTypeId::GEOS_MULTIPOLYGON) {
+        return false;
+    }
+    //-- a GC with a single polygon does not need noding
+    if (hasAreas && geom.getNumGeometries() == 1)
+        return false;
+    return true;
+}
+
+/* public */
+bool
+RelateGeometry::isPolygonal() const
+{
+    //TODO: also true for a GC containing one polygonal element (and possibly some lower-dimension elements)
+    GeometryTypeId typeId = geom.getGeometryTypeId();
+    return typeId == GeometryTypeId::GEOS_POLYGON
+        || typeId == GeometryTypeId::GEOS_MULTIPOLYGON;
+}
+
+/* public */
+bool
+RelateGeometry::hasBoundary()
+{
+    return getLocator()->hasBoundary();
+}
+
+/* public */
+const std::unordered_set<CoordinateXY, CoordinateXY::HashCode>&
+RelateGeometry::getUniquePoints()
+{
+    //-- will be re-used in prepared mode
+    if (uniquePoints == nullptr) {
+        createUniquePoints();
+    }
+    return *uniquePoints;
+}
+
+/* private */
+void
+RelateGeometry::createUniquePoints()
+{
+    //-- only called on P geometries
+    std::vector<const CoordinateXY*> pts;
+    geom::util::ComponentCoordinateExtracter::getCoordinates(geom, pts);
+    uniquePoints.reset(new std::unordered_set<CoordinateXY, CoordinateXY::HashCode>());
+    for (const CoordinateXY* p : pts) {
+        uniquePoints->insert(*p);
+    }
+}
+
+/* public */
+std::vector<const Point*>
+RelateGeometry::getEffectivePoints()
+{
+    std::vector<const Point*> ptListAll;
+    GeometryExtracter::extract<Point>(geom, ptListAll);
+
+    if (getDimensionReal() <= Dimension::P)
+        return ptListAll;
+
+    //-- only return Points not covered by another element
+    std::vector<const Point*> ptList;
+    for (const Point* p : ptListAll) {
+        if (p->isEmpty())
+            continue;
+        int locDim = locateWithDim(*p->getCoordinate());
+        if (DimensionLocation::dimension(locDim) == Dimension::P) {
+            ptList.push_back(p);
+        }
+    }
+    return ptList;
+}
+
+/* public */
+void
+RelateGeometry::extractSegmentStrings(bool isA, const Envelope* env,
+                                      std::vector<std::unique_ptr<RelateSegmentString>>& segStrings)
+{
+    extractSegmentStrings(isA, env, geom, segStrings);
+}
+
+/* private */
+void
+RelateGeometry::extractSegmentStrings(bool isA, const Envelope* env, const Geometry& g,
+                                      std::vector<std::unique_ptr<RelateSegmentString>>& segStrings)
+{
+    //-- record if parent is MultiPolygon
+    const Geometry* parentPolygonal = nullptr;
+    if (g.getGeometryTypeId() == GeometryTypeId::GEOS_MULTIPOLYGON) {
+        parentPolygonal = &g;
+    }
+
+    for (std::size_t i = 0; i < g.getNumGeometries(); i++) {
+        const Geometry* elem = g.getGeometryN(i);
+        if (elem->isCollection()) {
+            extractSegmentStrings(isA, env, *elem, segStrings);
+        }
+        else {
+            extractSegmentStringsFromAtomic(isA, *elem, parentPolygonal, env, segStrings);
+        }
+    }
+}
+
+/* private */
+void
+RelateGeometry::extractSegmentStringsFromAtomic(bool isA, const Geometry& g,
+        const Geometry* parentPolygonal, const Envelope* env,
+        std::vector<std::unique_ptr<RelateSegmentString>>& segStrings)
+{
+    if (g.isEmpty())
+        return;
+
+    bool doExtract = (env == nullptr) || env->intersects(g.getEnvelopeInternal());
+    if (! doExtract)
+        return;
+
+    elementId++;
+    GeometryTypeId typeId = g.getGeometryTypeId();
+    if (typeId == GeometryTypeId::GEOS_LINESTRING || typeId == GeometryTypeId::GEOS_LINEARRING) {
+        const LineString* line = static_cast<const LineString*>(&g);
+        segStrings.push_back(RelateSegmentString::createLine(
+            removeRepeated(line->getCoordinatesRO()), isA, elementId));
+    }
+    else if (typeId == GeometryTypeId::GEOS_POLYGON) {
+        const Polygon* poly = static_cast<const Polygon*>(&g);
+        const Geometry* parentPoly = parentPolygonal != nullptr ? parentPolygonal : poly;
+        extractRingToSegmentString(isA, poly->getExteriorRing(), 0, env, parentPoly, segStrings);
+        for (std::size_t i = 0; i < poly->getNumInteriorRing(); i++) {
+            extractRingToSegmentString(isA, poly->getInteriorRingN(i), static_cast<int>(i + 1),
+                                       env, parentPoly, segStrings);
+        }
+    }
+}
+
+/* private */
+void
+RelateGeometry::extractRingToSegmentString(bool isA, const LinearRing* ring, int ringId,
+        const Envelope* env, const Geometry* parentPoly,
+        std::vector<std::unique_ptr<RelateSegmentString>>& segStrings)
+{
+    if (ring->isEmpty())
+        return;
+    if (env != nullptr && ! env->intersects(ring->getEnvelopeInternal()))
+        return;
+
+    //-- orient the points if required
+    bool requireCW = ringId == 0;
+    segStrings.push_back(RelateSegmentString::createRing(
+        orientAndRemoveRepeated(ring->getCoordinatesRO(), requireCW),
+        isA, elementId, ringId, parentPoly));
+}
+
+/* public static */
+std::unique_ptr<CoordinateSequence>
+RelateGeometry::orientAndRemoveRepeated(const CoordinateSequence* seq, bool orientCW)
+{
+    bool isFlipped = orientCW == Orientation::isCCW(seq);
+    std::unique_ptr<CoordinateSequence> pts(
+        new CoordinateSequence(0u, seq->hasZ(), seq->hasM()));
+    pts->reserve(seq->size());
+    pts->add(*seq, false, ! isFlipped);
+    return pts;
+}
+
+/* public static */
+std::unique_ptr<CoordinateSequence>
+RelateGeometry::removeRepeated(const CoordinateSequence* seq)
+{
+    if (! seq->hasRepeatedPoints()) {
+        return seq->clone();
+    }
+    std::unique_ptr<CoordinateSequence> pts(
+        new CoordinateSequence(0u, seq->hasZ(), seq->hasM()));
+    pts->reserve(seq->size());
+    pts->add(*seq, false);
+    return pts;
+}
+
+/* public */
+std::string
+RelateGeometry::toString() const
+{
+    return geom.toString();
+}
+
+
+} // namespace geos.operation.relateng
+} // namespace geos.operation
+} // namespace geos
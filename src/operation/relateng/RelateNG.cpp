@@ -0,0 +1,582 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/operation/relateng/RelateNG.h>
+
+#include <geos/algorithm/BoundaryNodeRule.h>
+#include <geos/geom/Dimension.h>
+#include <geos/geom/Envelope.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/IntersectionMatrix.h>
+#include <geos/geom/LinearRing.h>
+#include <geos/geom/LineString.h>
+#include <geos/geom/Point.h>
+#include <geos/geom/Polygon.h>
+#include <geos/geom/util/GeometryExtracter.h>
+#include <geos/noding/MCIndexSegmentSetMutualIntersector.h>
+#include <geos/operation/relateng/DimensionLocation.h>
+#include <geos/operation/relateng/EdgeSegmentIntersector.h>
+#include <geos/operation/relateng/EdgeSetIntersector.h>
+#include <geos/operation/relateng/IMPatternMatcher.h>
+#include <geos/operation/relateng/RelateMatrixPredicate.h>
+#include <geos/operation/relateng/RelatePredicate.h>
+#include <geos/operation/relateng/RelateSegmentString.h>
+#include <geos/operation/relateng/TopologyComputer.h>
+#include <geos/operation/relateng/TopologyPredicate.h>
+
+using geos::algorithm::BoundaryNodeRule;
+using geos::geom::CoordinateSequence;
+using geos::geom::CoordinateXY;
+using geos::geom::Dimension;
+using geos::geom::Envelope;
+using geos::geom::Geometry;
+using geos::geom::IntersectionMatrix;
+using geos::geom::LinearRing;
+using geos::geom::LineString;
+using geos::geom::Location;
+using geos::geom::Point;
+using geos::geom::Polygon;
+using geos::geom::util::GeometryExtracter;
+using geos::noding::MCIndexSegmentSetMutualIntersector;
+using geos::noding::SegmentString;
+
+namespace geos {      // geos
+namespace operation { // geos.operation
+namespace relateng {  // geos.operation.relateng
+
+
+RelateNG::RelateNG(const Geometry* inputA, bool isPrepared, const BoundaryNodeRule& bnRule)
+    : boundaryNodeRule(bnRule)
+    , geomA(*inputA, isPrepared, bnRule)
+{}
+
+RelateNG::RelateNG(const Geometry* inputA, bool isPrepared)
+    : RelateNG(inputA, isPrepared, BoundaryNodeRule::getBoundaryOGCSFS())
+{}
+
+RelateNG::~RelateNG() = default;
+
+/* public static */
+bool
+RelateNG::relate(const Geometry* a, const Geometry* b, TopologyPredicate& pred)
+{
+    RelateNG rng(a, false);
+    return rng.evaluate(b, pred);
+}
+
+/* public static */
+bool
+RelateNG::relate(const Geometry* a, const Geometry* b, TopologyPredicate& pred,
+                 const BoundaryNodeRule& bnRule)
+{
+    RelateNG rng(a, false, bnRule);
+    return rng.evaluate(b, pred);
+}
+
+/* public static */
+bool
+RelateNG::relate(const Geometry* a, const Geometry* b, const std::string& imPattern)
+{
+    RelateNG rng(a, false);
+    return rng.evaluate(b, imPattern);
+}
+
+/* public static */
+std::unique_ptr<IntersectionMatrix>
+RelateNG::relate(const Geometry* a, const Geometry* b)
+{
+    RelateNG rng(a, false);
+    return rng.evaluate(b);
+}
+
+/* public static */
+std::unique_ptr<IntersectionMatrix>
+RelateNG::relate(const Geometry* a, const Geometry* b, const BoundaryNodeRule& bnRule)
+{
+    RelateNG rng(a, false, bnRule);
+    return rng.evaluate(b);
+}
+
+/* public static */
+std::unique_ptr<RelateNG>
+RelateNG::prepare(const Geometry* a)
+{
+    return std::unique_ptr<RelateNG>(new RelateNG(a, true));
+}
+
+/* public static */
+std::unique_ptr<RelateNG>
+RelateNG::prepare(const Geometry* a, const BoundaryNodeRule& bnRule)
+{
+    return std::unique_ptr<RelateNG>(new RelateNG(a, true, bnRule));
+}
+
+/* public */
+std::unique_ptr<IntersectionMatrix>
+RelateNG::evaluate(const Geometry* b)
+{
+    RelateMatrixPredicate rel;
+    evaluate(b, rel);
+    return rel.getIM();
+}
+
+/* public */
+bool
+RelateNG::evaluate(const Geometry* b, const std::string& imPattern)
+{
+    IMPatternMatcher matcher(imPattern);
+    return evaluate(b, matcher);
+}
+
+/* public */
+bool
+RelateNG::evaluate(const Geometry* b, TopologyPredicate& predicate)
+{
+    //-- fast envelope checks
+    if (! hasRequiredEnvelopeInteraction(b, predicate)) {
+        return false;
+    }
+
+    RelateGeometry geomB(*b, boundaryNodeRule);
+
+    if (geomA.isEmpty() && geomB.isEmpty()) {
+        //TODO: what if predicate is disjoint?  Perhaps use result on disjoint envs?
+        return finishValue(predicate);
+    }
+    int dimA = geomA.getDimensionReal();
+    int dimB = geomB.getDimensionReal();
+
+    //-- check if predicate is determined by dimension or envelope
+    predicate.init(dimA, dimB);
+    if (predicate.isKnown())
+        return finishValue(predicate);
+
+    predicate.init(geomA.getEnvelope(), geomB.getEnvelope());
+    if (predicate.isKnown())
+        return finishValue(predicate);
+
+    TopologyComputer topoComputer(predicate, geomA, geomB);
+
+    //-- optimized P/P evaluation
+    if (dimA == Dimension::P && dimB == Dimension::P) {
+        computePP(geomB, topoComputer);
+        topoComputer.finish();
+        return topoComputer.getResult();
+    }
+
+    //-- test points against (potentially) indexed geometry first
+    computeAtPoints(geomB, RelateGeometry::GEOM_B, geomA, topoComputer);
+    if (topoComputer.isResultKnown()) {
+        return topoComputer.getResult();
+    }
+    computeAtPoints(geomA, RelateGeometry::GEOM_A, geomB, topoComputer);
+    if (topoComputer.isResultKnown()) {
+        return topoComputer.getResult();
+    }
+
+    if (geomA.hasEdges() && geomB.hasEdges()) {
+        computeAtEdges(geomB, topoComputer);
+    }
+
+    //-- after all processing, set remaining unknown values in IM
+    topoComputer.finish();
+    return topoComputer.getResult();
+}
+
+/* private */
+bool
+RelateNG::hasRequiredEnvelopeInteraction(const Geometry* b, TopologyPredicate& predicate)
+{
+    const Envelope* envB = b->getEnvelopeInternal();
+    bool isInteracts = false;
+    if (predicate.requireCovers(RelateGeometry::GEOM_A)) {
+        if (! geomA.getEnvelope().covers(envB)) {
+            return false;
+        }
+        isInteracts = true;
+    }
+    else if (predicate.requireCovers(RelateGeometry::GEOM_B)) {
+        if (! envB->covers(&geomA.getEnvelope())) {
+            return false;
+        }
+        isInteracts = true;
+    }
+    if (! isInteracts
+        && predicate.requireInteraction()
+        && ! geomA.getEnvelope().intersects(envB)) {
+        return false;
+    }
+    return true;
+}
+
+/* private */
+bool
+RelateNG::finishValue(TopologyPredicate& predicate)
+{
+    predicate.finish();
+    return predicate.value();
+}
+
+/* private */
+void
+RelateNG::computePP(RelateGeometry& geomB, TopologyComputer& topoComputer)
+{
+    const auto& ptsA = geomA.getUniquePoints();
+    //TODO: only query points in interaction extent?
+    const auto& ptsB = geomB.getUniquePoints();
+
+    std::size_t numBinA = 0;
+    for (const CoordinateXY& ptB : ptsB) {
+        if (ptsA.find(ptB) != ptsA.end()) {
+            numBinA++;
+            topoComputer.addPointOnPointInterior();
+        }
+        else {
+            topoComputer.addPointOnPointExterior(RelateGeometry::GEOM_B);
+        }
+        if (topoComputer.isResultKnown()) {
+            return;
+        }
+    }
+    /**
+     * If number of matched B points is less than size of A,
+     * there must be at least one A point in the exterior of B
+     */
+    if (numBinA < ptsA.size()) {
+        topoComputer.addPointOnPointExterior(RelateGeometry::GEOM_A);
+    }
+}
+
+/* private */
+void
+RelateNG::computeAtPoints(RelateGeometry& geom, bool isA,
+                          RelateGeometry& geomTarget, TopologyComputer& topoComputer)
+{
+    bool isResultKnown = computePoints(geom, isA, geomTarget, topoComputer);
+    if (isResultKnown)
+        return;
+
+    /**
+     * Performance optimization: only check points against target
+     * if it has areas OR if the predicate requires checking for
+     * exterior interaction.
+     * In particular, this avoids testing line ends against lines
+     * for the intersects predicate (since these are checked
+     * during segment/segment intersection checking anyway).
+     * Checking points against areas is necessary, since the input
+     * linework is disjoint if one input lies wholly inside an area,
+     * so segment intersection checking is not sufficient.
+     */
+    bool checkDisjointPoints = geomTarget.hasDimension(Dimension::A)
+                               || topoComputer.isExteriorCheckRequired(isA);
+    if (! checkDisjointPoints)
+        return;
+
+    isResultKnown = computeLineEnds(geom, isA, geomTarget, topoComputer);
+    if (isResultKnown)
+        return;
+
+    computeAreaVertex(geom, isA, geomTarget, topoComputer);
+}
+
+/* private */
+bool
+RelateNG::computePoints(RelateGeometry& geom, bool isA,
+                        RelateGeometry& geomTarget, TopologyComputer& topoComputer)
+{
+    if (! geom.hasDimension(Dimension::P)) {
+        return false;
+    }
+
+    std::vector<const Point*> points = geom.getEffectivePoints();
+    for (const Point* point : points) {
+        //TODO: exit when all possible target locations (E,I,B) have been found?
+        if (point->isEmpty())
+            continue;
+
+        computePoint(isA, *point->getCoordinate(), geomTarget, topoComputer);
+        if (topoComputer.isResultKnown()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/* private */
+void
+RelateNG::computePoint(bool isA, const CoordinateXY& pt,
+                       RelateGeometry& geomTarget, TopologyComputer& topoComputer)
+{
+    int locDimTarget = geomTarget.locateWithDim(pt);
+    Location locTarget = DimensionLocation::location(locDimTarget);
+    int dimTarget = DimensionLocation::dimension(locDimTarget, topoComputer.getDimension(! isA));
+    topoComputer.addPointOnGeometry(isA, locTarget, dimTarget);
+}
+
+/* private */
+bool
+RelateNG::computeLineEnds(RelateGeometry& geom, bool isA,
+                          RelateGeometry& geomTarget, TopologyComputer& topoComputer)
+{
+    if (! geom.hasDimension(Dimension::L)) {
+        return false;
+    }
+
+    /**
+     * Unlike area vertices, line ends located in the target exterior
+     * cannot be skipped once an exterior intersection is known,
+     * since whether they are line boundary points
+     * determines the matrix entry they contribute to.
+     */
+    std::vector<const LineString*> lines;
+    GeometryExtracter::extract<LineString>(geom.getGeometry(), lines);
+    for (const LineString* line : lines) {
+        if (line->isEmpty())
+            continue;
+
+        const CoordinateSequence* seq = line->getCoordinatesRO();
+        const CoordinateXY& e0 = seq->getAt<CoordinateXY>(0);
+        computeLineEnd(geom, isA, e0, geomTarget, topoComputer);
+        if (topoComputer.isResultKnown()) {
+            return true;
+        }
+
+        if (! line->isClosed()) {
+            const CoordinateXY& e1 = seq->getAt<CoordinateXY>(seq->size() - 1);
+            computeLineEnd(geom, isA, e1, geomTarget, topoComputer);
+            if (topoComputer.isResultKnown()) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+/* private */
+bool
+RelateNG::computeLineEnd(RelateGeometry& geom, bool isA, const CoordinateXY& pt,
+                         RelateGeometry& geomTarget, TopologyComputer& topoComputer)
+{
+    int locDimLineEnd = geom.locateLineEndWithDim(pt);
+    int dimLineEnd = DimensionLocation::dimension(locDimLineEnd, topoComputer.getDimension(isA));
+    //-- skip line ends which are in a GC area
+    if (dimLineEnd != Dimension::L)
+        return false;
+    Location locLineEnd = DimensionLocation::location(locDimLineEnd);
+
+    int locDimTarget = geomTarget.locateWithDim(pt);
+    Location locTarget = DimensionLocation::location(locDimTarget);
+    int dimTarget = DimensionLocation::dimension(locDimTarget, topoComputer.getDimension(! isA));
+    topoComputer.addLineEndOnGeometry(isA, locLineEnd, locTarget, dimTarget);
+    return locTarget == Location::EXTERIOR;
+}
+
+/* private */
+bool
+RelateNG::computeAreaVertex(RelateGeometry& geom, bool isA,
+                            RelateGeometry& geomTarget, TopologyComputer& topoComputer)
+{
+    if (! geom.hasDimension(Dimension::A)) {
+        return false;
+    }
+    //-- evaluate for line and area targets only, since points are handled in the reverse direction
+    if (geomTarget.getDimension() < Dimension::L)
+        return false;
+
+    bool hasExteriorIntersection = false;
+    std::vector<const Polygon*> polys;
+    GeometryExtracter::extract<Polygon>(geom.getGeometry(), polys);
+    for (const Polygon* poly : polys) {
+        if (poly->isEmpty())
+            continue;
+
+        //-- once an intersection with target exterior is recorded, skip further known-exterior points
+        if (hasExteriorIntersection
+            && poly->getEnvelopeInternal()->disjoint(&geomTarget.getEnvelope()))
+            continue;
+
+        hasExteriorIntersection |= computeAreaVertex(geom, isA, poly->getExteriorRing(), geomTarget, topoComputer);
+        if (topoComputer.isResultKnown()) {
+            return true;
+        }
+        for (std::size_t j = 0; j < poly->getNumInteriorRing(); j++) {
+            hasExteriorIntersection |= computeAreaVertex(geom, isA, poly->getInteriorRingN(j), geomTarget, topoComputer);
+            if (topoComputer.isResultKnown()) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+/* private */
+bool
+RelateNG::computeAreaVertex(RelateGeometry& geom, bool isA, const LinearRing* ring,
+                            RelateGeometry& geomTarget, TopologyComputer& topoComputer)
+{
+    if (ring->isEmpty())
+        return false;
+
+    //TODO: use extremal (highest) point to ensure one is on boundary of polygon cluster
+    const CoordinateXY& pt = ring->getCoordinatesRO()->getAt<CoordinateXY>(0);
+
+    Location locArea = geom.locateAreaVertex(pt);
+    int locDimTarget = geomTarget.locateWithDim(pt);
+    Location locTarget = DimensionLocation::location(locDimTarget);
+    int dimTarget = DimensionLocation::dimension(locDimTarget, topoComputer.getDimension(! isA));
+    topoComputer.addAreaVertex(isA, locArea, locTarget, dimTarget);
+    return locTarget == Location::EXTERIOR;
+}
+
+/* private */
+void
+RelateNG::computeAtEdges(RelateGeometry& geomB, TopologyComputer& topoComputer)
+{
+    Envelope envInt;
+    geomA.getEnvelope().intersection(geomB.getEnvelope(), envInt);
+    if (envInt.isNull())
+        return;
+
+    std::vector<std::unique_ptr<RelateSegmentString>> edgesB;
+    geomB.extractSegmentStrings(RelateGeometry::GEOM_B, &envInt, edgesB);
+    EdgeSegmentIntersector intersector(topoComputer);
+
+    //-- node sections refer to edge vertices, so edges must outlive node evaluation
+    std::vector<std::unique_ptr<RelateSegmentString>> edgesA;
+    if (topoComputer.isSelfNodingRequired()) {
+        computeEdgesAll(edgesA, edgesB, &envInt, intersector);
+    }
+    else {
+        computeEdgesMutual(edgesB, &envInt, intersector);
+    }
+    if (topoComputer.isResultKnown()) {
+        return;
+    }
+
+    topoComputer.evaluateNodes();
+}
+
+/* private */
+void
+RelateNG::computeEdgesAll(std::vector<std::unique_ptr<RelateSegmentString>>& edgesA,
+                          std::vector<std::unique_ptr<RelateSegmentString>>& edgesB,
+                          const Envelope* envInt, EdgeSegmentIntersector& intersector)
+{
+    //TODO: find a more efficient way to includes edgesA
+    geomA.extractSegmentStrings(RelateGeometry::GEOM_A, envInt, edgesA);
+
+    EdgeSetIntersector edgeInt(edgesA, edgesB, envInt);
+    edgeInt.process(intersector);
+}
+
+/* private */
+void
+RelateNG::computeEdgesMutual(std::vector<std::unique_ptr<RelateSegmentString>>& edgesB,
+                             const Envelope* envInt, EdgeSegmentIntersector& intersector)
+{
+    //-- in prepared mode the A edge index is reused
+    if (edgeMutualInt == nullptr) {
+        const Envelope* envExtract = geomA.isPrepared() ? nullptr : envInt;
+        geomA.extractSegmentStrings(RelateGeometry::GEOM_A, envExtract, edgesMutualA);
+
+        SegmentString::ConstVect baseSegs;
+        baseSegs.reserve(edgesMutualA.size());
+        for (const auto& ss : edgesMutualA) {
+            baseSegs.push_back(ss.get());
+        }
+        edgeMutualInt.reset(new MCIndexSegmentSetMutualIntersector());
+        edgeMutualInt->setBaseSegments(&baseSegs);
+    }
+
+    SegmentString::ConstVect segsB;
+    segsB.reserve(edgesB.size());
+    for (const auto& ss : edgesB) {
+        segsB.push_back(ss.get());
+    }
+    edgeMutualInt->setSegmentIntersector(&intersector);
+    edgeMutualInt->process(&segsB);
+}
+
+/* public */
+bool
+RelateNG::intersects(const Geometry* b)
+{
+    return evaluate(b, *RelatePredicate::intersects());
+}
+
+/* public */
+bool
+RelateNG::crosses(const Geometry* b)
+{
+    return evaluate(b, *RelatePredicate::crosses());
+}
+
+/* public */
+bool
+RelateNG::disjoint(const Geometry* b)
+{
+    return evaluate(b, *RelatePredicate::disjoint());
+}
+
+/* public */
+bool
+RelateNG::touches(const Geometry* b)
+{
+    return evaluate(b, *RelatePredicate::touches());
+}
+
+/* public */
+bool
+RelateNG::within(const Geometry* b)
+{
+    return evaluate(b, *RelatePredicate::within());
+}
+
+/* public */
+bool
+RelateNG::contains(const Geometry* b)
+{
+    return evaluate(b, *RelatePredicate::contains());
+}
+
+/* public */
+bool
+RelateNG::overlaps(const Geometry* b)
+{
+    return evaluate(b, *RelatePredicate::overlaps());
+}
+
+/* public */
+bool
+RelateNG::covers(const Geometry* b)
+{
+    return evaluate(b, *RelatePredicate::covers());
+}
+
+/* public */
+bool
+RelateNG::coveredBy(const Geometry* b)
+{
+    return evaluate(b, *RelatePredicate::coveredBy());
+}
+
+/* public */
+bool
+RelateNG::equalsTopo(const Geometry* b)
+{
+    return evaluate(b, *RelatePredicate::equalsTopo());
+}
+
+
+} // namespace geos.operation.relateng
+} // namespace geos.operation
+} // namespace geos
@@ -0,0 +1,240 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/operation/relateng/RelateNode.h>
+
+#include <geos/geom/Dimension.h>
+#include <geos/geom/Location.h>
+#include <geos/geom/Position.h>
+#include <geos/operation/relateng/RelateGeometry.h>
+
+#include <sstream>
+
+using geos::geom::CoordinateXY;
+using geos::geom::Dimension;
+using geos::geom::Location;
+using geos::geom::Position;
+
+namespace geos {      // geos
+namespace operation { // geos.operation
+namespace relateng {  // geos.operation.relateng
+
+
+/* public */
+void
+RelateNode::addEdges(const std::vector<NodeSection>& nss)
+{
+    for (const NodeSection& ns : nss) {
+        addEdges(ns);
+    }
+}
+
+/* public */
+void
+RelateNode::addEdges(const NodeSection& ns)
+{
+    switch (ns.dimension()) {
+    case Dimension::L:
+        addLineEdge(ns.isA(), ns.getVertex(0));
+        addLineEdge(ns.isA(), ns.getVertex(1));
+        break;
+    case Dimension::A: {
+        //-- assumes node edges have CW orientation (as per JTS norm)
+        //-- entering edge - interior on L
+        const RelateEdge* e0 = addAreaEdge(ns.isA(), ns.getVertex(0), false);
+        //-- exiting edge - interior on R
+        const RelateEdge* e1 = addAreaEdge(ns.isA(), ns.getVertex(1), true);
+        if (e0 == nullptr || e1 == nullptr)
+            break;
+
+        std::size_t index0 = indexOf(e0);
+        std::size_t index1 = indexOf(e1);
+        updateEdgesInArea(ns.isA(), index0, index1);
+        updateIfAreaPrev(ns.isA(), index0);
+        updateIfAreaNext(ns.isA(), index1);
+        break;
+    }
+    }
+}
+
+/* private */
+std::size_t
+RelateNode::indexOf(const RelateEdge* e) const
+{
+    for (std::size_t i = 0; i < edges.size(); i++) {
+        if (edges[i].get() == e)
+            return i;
+    }
+    return edges.size();
+}
+
+/* private */
+void
+RelateNode::updateEdgesInArea(bool isA, std::size_t indexFrom, std::size_t indexTo)
+{
+    std::size_t index = nextIndex(indexFrom);
+    while (index != indexTo) {
+        edges[index]->setAreaInterior(isA);
+        index = nextIndex(index);
+    }
+}
+
+/* private */
+void
+RelateNode::updateIfAreaPrev(bool isA, std::size_t index)
+{
+    std::size_t indexPrev = prevIndex(index);
+    if (edges[indexPrev]->isInterior(isA, Position::LEFT)) {
+        edges[index]->setAreaInterior(isA);
+    }
+}
+
+/* private */
+void
+RelateNode::updateIfAreaNext(bool isA, std::size_t index)
+{
+    std::size_t indexNext = nextIndex(index);
+    if (edges[indexNext]->isInterior(isA, Position::RIGHT)) {
+        edges[index]->setAreaInterior(isA);
+    }
+}
+
+/* private */
+RelateEdge*
+RelateNode::addLineEdge(bool isA, const CoordinateXY* dirPt)
+{
+    return addEdge(isA, dirPt, Dimension::L, false);
+}
+
+/* private */
+RelateEdge*
+RelateNode::addAreaEdge(bool isA, const CoordinateXY* dirPt, bool isForward)
+{
+    return addEdge(isA, dirPt, Dimension::A, isForward);
+}
+
+/* private */
+RelateEdge*
+RelateNode::addEdge(bool isA, const CoordinateXY* dirPt, int dim, bool isForward)
+{
+    //-- check for well-formed edge - skip null or zero-len input
+    if (dirPt == nullptr)
+        return nullptr;
+    if (nodePt.equals2D(*dirPt))
+        return nullptr;
+
+    std::size_t insertIndex = edges.size();
+    for (std::size_t i = 0; i < edges.size(); i++) {
+        RelateEdge* e = edges[i].get();
+        int comp = e->compareToEdge(dirPt);
+        if (comp == 0) {
+            e->merge(isA, dim, isForward);
+            return e;
+        }
+        if (comp == 1) {
+            //-- found further edge, so insert a new edge at this position
+            insertIndex = i;
+            break;
+        }
+    }
+    //-- add a new edge before higher edge found (or at end of list)
+    auto it = edges.insert(edges.begin() + static_cast<std::ptrdiff_t>(insertIndex),
+                           RelateEdge::create(this, dirPt, isA, dim, isForward));
+    return it->get();
+}
+
+/* public */
+void
+RelateNode::finish(bool isAreaInteriorA, bool isAreaInteriorB)
+{
+    finishNode(RelateGeometry::GEOM_A, isAreaInteriorA);
+    finishNode(RelateGeometry::GEOM_B, isAreaInteriorB);
+}
+
+/* private */
+void
+RelateNode::finishNode(bool isA, bool isAreaInterior)
+{
+    if (isAreaInterior) {
+        RelateEdge::setAreaInterior(edges, isA);
+    }
+    else {
+        int startIndex = RelateEdge::findKnownEdgeIndex(edges, isA);
+        //-- only interacting nodes are finished, so this should never happen
+        if (startIndex < 0)
+            return;
+        propagateSideLocations(isA, static_cast<std::size_t>(startIndex));
+    }
+}
+
+/* private */
+void
+RelateNode::propagateSideLocations(bool isA, std::size_t startIndex)
+{
+    Location currLoc = edges[startIndex]->location(isA, Position::LEFT);
+    //-- edges are stored in CCW order
+    std::size_t index = nextIndex(startIndex);
+    while (index != startIndex) {
+        RelateEdge* e = edges[index].get();
+        e->setUnknownLocations(isA, currLoc);
+        currLoc = e->location(isA, Position::LEFT);
+        index = nextIndex(index);
+    }
+}
+
+/* public */
+bool
+RelateNode::hasExteriorEdge(bool isA) const
+{
+    for (const auto& e : edges) {
+        if (Location::EXTERIOR == e->location(isA, Position::LEFT) ||
+            Location::EXTERIOR == e->location(isA, Position::RIGHT)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/* private */
+std::size_t
+RelateNode::prevIndex(std::size_t index) const
+{
+    if (index > 0)
+        return index - 1;
+    return edges.size() - 1;
+}
+
+/* private */
+std::size_t
+RelateNode::nextIndex(std::size_t index) const
+{
+    if (index >= edges.size() - 1)
+        return 0;
+    return index + 1;
+}
+
+/* public */
+std::string
+RelateNode::toString() const
+{
+    std::stringstream ss;
+    ss << "Node[" << nodePt << "]:" << std::endl;
+    for (const auto& e : edges) {
+        ss << e->toString() << std::endl;
+    }
+    return ss.str();
+}
+
+
+} // namespace geos.operation.relateng
+} // namespace geos.operation
+} // namespace geos
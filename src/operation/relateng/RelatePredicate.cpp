@@ -0,0 +1,431 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/operation/relateng/RelatePredicate.h>
+
+#include <geos/geom/Dimension.h>
+#include <geos/geom/Envelope.h>
+#include <geos/operation/relateng/BasicPredicate.h>
+#include <geos/operation/relateng/IMPatternMatcher.h>
+#include <geos/operation/relateng/IMPredicate.h>
+#include <geos/operation/relateng/RelateGeometry.h>
+
+using geos::geom::Dimension;
+using geos::geom::Envelope;
+using geos::geom::Location;
+
+namespace geos {      // geos
+namespace operation { // geos.operation
+namespace relateng {  // geos.operation.relateng
+
+namespace {
+
+class IntersectsPredicate : public BasicPredicate {
+public:
+    std::string name() const override { return "intersects"; }
+
+    bool requireSelfNoding() const override
+    {
+        //-- self-noding is not required to check for a simple interaction
+        return false;
+    }
+
+    bool requireExteriorCheck(bool) const override
+    {
+        //-- intersects only requires testing interaction
+        return false;
+    }
+
+    using BasicPredicate::init;
+
+    void init(const Envelope& envA, const Envelope& envB) override
+    {
+        require(envA.intersects(envB));
+    }
+
+    void updateDimension(Location locA, Location locB, int) override
+    {
+        setValueIf(true, isIntersection(locA, locB));
+    }
+
+    void finish() override
+    {
+        //-- if no intersecting locations were found
+        setValue(false);
+    }
+};
+
+class DisjointPredicate : public BasicPredicate {
+public:
+    std::string name() const override { return "disjoint"; }
+
+    bool requireSelfNoding() const override
+    {
+        //-- self-noding is not required to check for a simple interaction
+        return false;
+    }
+
+    bool requireInteraction() const override
+    {
+        //-- ensure entire matrix is computed
+        return false;
+    }
+
+    bool requireExteriorCheck(bool) const override
+    {
+        //-- disjoint only requires testing interaction
+        return false;
+    }
+
+    using BasicPredicate::init;
+
+    void init(const Envelope& envA, const Envelope& envB) override
+    {
+        setValueIf(true, envA.disjoint(envB));
+    }
+
+    void updateDimension(Location locA, Location locB, int) override
+    {
+        setValueIf(false, isIntersection(locA, locB));
+    }
+
+    void finish() override
+    {
+        //-- if no intersecting locations were found
+        setValue(true);
+    }
+};
+
+/**
+ * Base for the contains and covers predicates,
+ * which differ only in the final matrix test.
+ */
+class ContainsBasePredicate : public IMPredicate {
+public:
+    bool requireCovers(bool isSourceA) const override
+    {
+        return isSourceA == RelateGeometry::GEOM_A;
+    }
+
+    bool requireExteriorCheck(bool isSourceA) const override
+    {
+        //-- only need to check B against Exterior of A
+        return isSourceA == RelateGeometry::GEOM_B;
+    }
+
+    void init(int dA, int dB) override
+    {
+        IMPredicate::init(dA, dB);
+        require(isDimsCompatibleWithCovers(dimA, dimB));
+    }
+
+    void init(const Envelope& envA, const Envelope& envB) override
+    {
+        BasicPredicate::requireCovers(envA, envB);
+    }
+
+protected:
+    bool isDetermined() const override
+    {
+        return intersectsExteriorOf(RelateGeometry::GEOM_A);
+    }
+};
+
+class ContainsPredicate : public ContainsBasePredicate {
+public:
+    std::string name() const override { return "contains"; }
+protected:
+    bool valueIM() const override { return intMatrix.isContains(); }
+};
+
+class CoversPredicate : public ContainsBasePredicate {
+public:
+    std::string name() const override { return "covers"; }
+protected:
+    bool valueIM() const override { return intMatrix.isCovers(); }
+};
+
+/**
+ * Base for the within and coveredBy predicates,
+ * which differ only in the final matrix test.
+ */
+class WithinBasePredicate : public IMPredicate {
+public:
+    bool requireCovers(bool isSourceA) const override
+    {
+        return isSourceA == RelateGeometry::GEOM_B;
+    }
+
+    bool requireExteriorCheck(bool isSourceA) const override
+    {
+        //-- only need to check A against Exterior of B
+        return isSourceA == RelateGeometry::GEOM_A;
+    }
+
+    void init(int dA, int dB) override
+    {
+        IMPredicate::init(dA, dB);
+        require(isDimsCompatibleWithCovers(dimB, dimA));
+    }
+
+    void init(const Envelope& envA, const Envelope& envB) override
+    {
+        BasicPredicate::requireCovers(envB, envA);
+    }
+
+protected:
+    bool isDetermined() const override
+    {
+        return intersectsExteriorOf(RelateGeometry::GEOM_B);
+    }
+};
+
+class WithinPredicate : public WithinBasePredicate {
+public:
+    std::string name() const override { return "within"; }
+protected:
+    bool valueIM() const override { return intMatrix.isWithin(); }
+};
+
+class CoveredByPredicate : public WithinBasePredicate {
+public:
+    std::string name() const override { return "coveredBy"; }
+protected:
+    bool valueIM() const override { return intMatrix.isCoveredBy(); }
+};
+
+class CrossesPredicate : public IMPredicate {
+public:
+    std::string name() const override { return "crosses"; }
+
+    using IMPredicate::init;
+
+    void init(int dA, int dB) override
+    {
+        IMPredicate::init(dA, dB);
+        bool isBothPointsOrAreas =
+            (dimA == Dimension::P && dimB == Dimension::P) ||
+            (dimA == Dimension::A && dimB == Dimension::A);
+        require(! isBothPointsOrAreas);
+    }
+
+protected:
+    bool isDetermined() const override
+    {
+        if (dimA == Dimension::L && dimB == Dimension::L) {
+            //-- L/L interaction can only be dim = P
+            if (getDimension(Location::INTERIOR, Location::INTERIOR) > Dimension::P)
+                return true;
+        }
+        else if (dimA < dimB) {
+            if (isIntersects(Location::INTERIOR, Location::INTERIOR) &&
+                isIntersects(Location::INTERIOR, Location::EXTERIOR)) {
+                return true;
+            }
+        }
+        else if (dimA > dimB) {
+            if (isIntersects(Location::INTERIOR, Location::INTERIOR) &&
+                isIntersects(Location::EXTERIOR, Location::INTERIOR)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool valueIM() const override
+    {
+        return intMatrix.isCrosses(dimA, dimB);
+    }
+};
+
+class EqualsTopoPredicate : public IMPredicate {
+public:
+    std::string name() const override { return "equals"; }
+
+    void init(int dA, int dB) override
+    {
+        IMPredicate::init(dA, dB);
+        require(dimA == dimB);
+    }
+
+    void init(const Envelope& envA, const Envelope& envB) override
+    {
+        require(envA.equals(&envB));
+    }
+
+protected:
+    bool isDetermined() const override
+    {
+        bool isEitherExteriorIntersects =
+            isIntersects(Location::INTERIOR, Location::EXTERIOR) ||
+            isIntersects(Location::BOUNDARY, Location::EXTERIOR) ||
+            isIntersects(Location::EXTERIOR, Location::INTERIOR) ||
+            isIntersects(Location::EXTERIOR, Location::BOUNDARY);
+        return isEitherExteriorIntersects;
+    }
+
+    bool valueIM() const override
+    {
+        return intMatrix.isEquals(dimA, dimB);
+    }
+};
+
+class OverlapsPredicate : public IMPredicate {
+public:
+    std::string name() const override { return "overlaps"; }
+
+    using IMPredicate::init;
+
+    void init(int dA, int dB) override
+    {
+        IMPredicate::init(dA, dB);
+        require(dimA == dimB);
+    }
+
+protected:
+    bool isDetermined() const override
+    {
+        if (dimA == Dimension::A || dimA == Dimension::P) {
+            if (isIntersects(Location::INTERIOR, Location::INTERIOR) &&
+                isIntersects(Location::INTERIOR, Location::EXTERIOR) &&
+                isIntersects(Location::EXTERIOR, Location::INTERIOR)) {
+                return true;
+            }
+        }
+        if (dimA == Dimension::L) {
+            if (isDimension(Location::INTERIOR, Location::INTERIOR, Dimension::L) &&
+                isIntersects(Location::INTERIOR, Location::EXTERIOR) &&
+                isIntersects(Location::EXTERIOR, Location::INTERIOR)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool valueIM() const override
+    {
+        return intMatrix.isOverlaps(dimA, dimB);
+    }
+};
+
+class TouchesPredicate : public IMPredicate {
+public:
+    std::string name() const override { return "touches"; }
+
+    using IMPredicate::init;
+
+    void init(int dA, int dB) override
+    {
+        IMPredicate::init(dA, dB);
+        //-- Points have only interiors, so cannot touch
+        bool isBothPoints = dimA == Dimension::P && dimB == Dimension::P;
+        require(! isBothPoints);
+    }
+
+protected:
+    bool isDetermined() const override
+    {
+        //-- for touches, interiors cannot intersect
+        bool isInteriorsIntersects = isIntersects(Location::INTERIOR, Location::INTERIOR);
+        return isInteriorsIntersects;
+    }
+
+    bool valueIM() const override
+    {
+        return intMatrix.isTouches(dimA, dimB);
+    }
+};
+
+} // anonymous namespace
+
+
+/* public static */
+std::unique_ptr<TopologyPredicate>
+RelatePredicate::intersects()
+{
+    return std::unique_ptr<TopologyPredicate>(new IntersectsPredicate());
+}
+
+/* public static */
+std::unique_ptr<TopologyPredicate>
+RelatePredicate::disjoint()
+{
+    return std::unique_ptr<TopologyPredicate>(new DisjointPredicate());
+}
+
+/* public static */
+std::unique_ptr<TopologyPredicate>
+RelatePredicate::contains()
+{
+    return std::unique_ptr<TopologyPredicate>(new ContainsPredicate());
+}
+
+/* public static */
+std::unique_ptr<TopologyPredicate>
+RelatePredicate::within()
+{
+    return std::unique_ptr<TopologyPredicate>(new WithinPredicate());
+}
+
+/* public static */
+std::unique_ptr<TopologyPredicate>
+RelatePredicate::covers()
+{
+    return std::unique_ptr<TopologyPredicate>(new CoversPredicate());
+}
+
+/* public static */
+std::unique_ptr<TopologyPredicate>
+RelatePredicate::coveredBy()
+{
+    return std::unique_ptr<TopologyPredicate>(new CoveredByPredicate());
+}
+
+/* public static */
+std::unique_ptr<TopologyPredicate>
+RelatePredicate::crosses()
+{
+    return std::unique_ptr<TopologyPredicate>(new CrossesPredicate());
+}
+
+/* public static */
+std::unique_ptr<TopologyPredicate>
+RelatePredicate::equalsTopo()
+{
+    return std::unique_ptr<TopologyPredicate>(new EqualsTopoPredicate());
+}
+
+/* public static */
+std::unique_ptr<TopologyPredicate>
+RelatePredicate::overlaps()
+{
+    return std::unique_ptr<TopologyPredicate>(new OverlapsPredicate());
+}
+
+/* public static */
+std::unique_ptr<TopologyPredicate>
+RelatePredicate::touches()
+{
+    return std::unique_ptr<TopologyPredicate>(new TouchesPredicate());
+}
+
+/* public static */
+std::unique_ptr<TopologyPredicate>
+RelatePredicate::matches(const std::string& imPattern)
+{
+    return std::unique_ptr<TopologyPredicate>(new IMPatternMatcher(imPattern));
+}
+
+
+} // namespace geos.operation.relateng
+} // namespace geos.operation
+} // namespace geos
@@ -0,0 +1,117 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/operation/relateng/RelateSegmentString.h>
+
+#include <geos/geom/Dimension.h>
+
+using geos::geom::CoordinateSequence;
+using geos::geom::CoordinateXY;
+using geos::geom::Dimension;
+using geos::geom::Geometry;
+
+namespace geos {      // geos
+namespace operation { // geos.operation
+namespace relateng {  // geos.operation.relateng
+
+
+/* public static */
+std::unique_ptr<RelateSegmentString>
+RelateSegmentString::createLine(std::unique_ptr<CoordinateSequence>&& pts,
+    bool isA, int elementId)
+{
+    return std::unique_ptr<RelateSegmentString>(new RelateSegmentString(
+        std::move(pts), isA, Dimension::L, elementId, -1, nullptr));
+}
+
+/* public static */
+std::unique_ptr<RelateSegmentString>
+RelateSegmentString::createRing(std::unique_ptr<CoordinateSequence>&& pts,
+    bool isA, int elementId, int ringId, const Geometry* poly)
+{
+    return std::unique_ptr<RelateSegmentString>(new RelateSegmentString(
+        std::move(pts), isA, Dimension::A, elementId, ringId, poly));
+}
+
+/* public */
+NodeSection
+RelateSegmentString::createNodeSection(std::size_t segIndex, const CoordinateXY& intPt) const
+{
+    const CoordinateXY& c0 = getCoordinate<CoordinateXY>(segIndex);
+    const CoordinateXY& c1 = getCoordinate<CoordinateXY>(segIndex + 1);
+    bool isNodeAtVertex = intPt.equals2D(c0) || intPt.equals2D(c1);
+    const CoordinateXY* prev = prevVertex(segIndex, intPt);
+    const CoordinateXY* next = nextVertex(segIndex, intPt);
+    return NodeSection(m_isA, m_dimension, m_id, m_ringId, m_parentPolygonal,
+                       isNodeAtVertex, prev, intPt, next);
+}
+
+/* private */
+const CoordinateXY*
+RelateSegmentString::prevVertex(std::size_t segIndex, const CoordinateXY& pt) const
+{
+    const CoordinateXY& segStart = getCoordinate<CoordinateXY>(segIndex);
+    if (! segStart.equals2D(pt))
+        return &segStart;
+
+    //-- pt is at segment start, so get previous vertex
+    if (segIndex > 0)
+        return &getCoordinate<CoordinateXY>(segIndex - 1);
+
+    if (isClosed())
+        return &getCoordinate<CoordinateXY>(size() - 2);
+
+    return nullptr;
+}
+
+/* private */
+const CoordinateXY*
+RelateSegmentString::nextVertex(std::size_t segIndex, const CoordinateXY& pt) const
+{
+    const CoordinateXY& segEnd = getCoordinate<CoordinateXY>(segIndex + 1);
+    if (! segEnd.equals2D(pt))
+        return &segEnd;
+
+    //-- pt is at seg end, so get next vertex
+    if (segIndex < size() - 2)
+        return &getCoordinate<CoordinateXY>(segIndex + 2);
+
+    if (isClosed())
+        return &getCoordinate<CoordinateXY>(1);
+
+    //-- segStart is at end of line, so no next vertex
+    return nullptr;
+}
+
+/* public */
+bool
+RelateSegmentString::isContainingSegment(std::size_t segIndex, const CoordinateXY& pt) const
+{
+    //-- intersection is at segment start vertex - process it
+    if (pt.equals2D(getCoordinate<CoordinateXY>(segIndex)))
+        return true;
+
+    if (pt.equals2D(getCoordinate<CoordinateXY>(segIndex + 1))) {
+        bool isFinalSegment = segIndex == size() - 2;
+        if (isClosed() || ! isFinalSegment)
+            return false;
+        //-- for final segment, process intersections with final endpoint
+        return true;
+    }
+    //-- intersection is interior - process it
+    return true;
+}
+
+
+} // namespace geos.operation.relateng
+} // namespace geos.operation
+} // namespace geos
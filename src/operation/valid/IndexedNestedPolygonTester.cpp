@@ -25,6 +25,12 @@
 #include <geos/index/strtree/STRtree.h>
 #include <geos/operation/valid/PolygonTopologyAnalyzer.h>
 #include <geos/operation/valid/IndexedNestedPolygonTester.h>
+#include <geos/util/parallel.h>
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <mutex>
 
 
 namespace geos {      // geos
@@ -55,22 +61,22 @@ IndexedNestedPolygonTester::loadIndex()
 }
 
 
-/* private */
+/* private static */
 IndexedPointInAreaLocator&
-IndexedNestedPolygonTester::getLocator(const Polygon* poly)
+IndexedNestedPolygonTester::getLocator(const Polygon* poly,
+    std::map<const Polygon*, IndexedPointInAreaLocator>& locatorCache)
 {
-    auto search = locators.find(poly);
+    auto search = locatorCache.find(poly);
 
     // Entry not found
-    if (search == locators.end())
+    if (search == locatorCache.end())
     {
         // uses pair's piecewise constructor to emplace into
         // std::map<const Polygon*, IndexedPointInAreaLocator> locators;
-        locators.emplace(std::piecewise_construct,
+        auto result = locatorCache.emplace(std::piecewise_construct,
             std::forward_as_tuple(poly),
             std::forward_as_tuple(*poly));
-        auto search2 = locators.find(poly);
-        return search2->second;
+        return result.first->second;
     }
 
     IndexedPointInAreaLocator& locator = search->second;
@@ -84,25 +90,85 @@ IndexedNestedPolygonTester::isNested()
 {
     for (std::size_t i = 0; i < multiPoly->getNumGeometries(); i++) {
         const Polygon* poly = multiPoly->getGeometryN(i);
-        const LinearRing* shell = poly->getExteriorRing();
+        if (isPolygonNested(poly, locators, nestedPt))
+            return true;
+    }
+    return false;
+}
 
-        std::vector<const Polygon*> results;
-        index.query(*(poly->getEnvelopeInternal()), results);
 
-        for (const Polygon* possibleOuterPoly: results) {
+/* public */
+bool
+IndexedNestedPolygonTester::isNested(std::size_t numThreads)
+{
+    if (numThreads == 1)
+        return isNested();
 
-            if (poly == possibleOuterPoly)
-                continue;
-            /**
-             * If polygon is not fully covered by candidate polygon it cannot be nested
-             */
-            if (! possibleOuterPoly->getEnvelopeInternal()->covers(poly->getEnvelopeInternal()))
-                continue;
+    std::size_t numPolys = multiPoly->getNumGeometries();
+    if (numThreads == 0)
+        numThreads = util::defaultThreadCount();
 
-            bool gotNestedPt = findNestedPoint(shell, possibleOuterPoly, getLocator(possibleOuterPoly), nestedPt);
-            if (gotNestedPt)
-                return true;
+    //-- build now, so that queries do not modify the index
+    index.build();
+
+    /**
+     * Polygons are tested in contiguous blocks,
+     * each with its own locator cache, so locators for
+     * neighbouring outer polygons are mostly reused.
+     */
+    std::size_t numBlocks = std::min(numPolys, numThreads * 4);
+    const std::size_t NONE = std::numeric_limits<std::size_t>::max();
+    std::atomic<std::size_t> firstNested(NONE);
+    std::mutex resultLock;
+
+    util::parallelFor(numBlocks, numThreads, [&](std::size_t block) {
+        std::size_t start = numPolys * block / numBlocks;
+        std::size_t end = numPolys * (block + 1) / numBlocks;
+        std::map<const Polygon*, IndexedPointInAreaLocator> locatorCache;
+        for (std::size_t i = start; i < end; i++) {
+            //-- an earlier polygon is already known to be nested
+            if (i > firstNested.load(std::memory_order_relaxed))
+                return;
+            CoordinateXY pt;
+            if (isPolygonNested(multiPoly->getGeometryN(i), locatorCache, pt)) {
+                std::lock_guard<std::mutex> guard(resultLock);
+                if (i < firstNested.load()) {
+                    firstNested = i;
+                    nestedPt = pt;
+                }
+                return;
+            }
         }
+    });
+    return firstNested.load() != NONE;
+}
+
+
+/* private */
+bool
+IndexedNestedPolygonTester::isPolygonNested(const Polygon* poly,
+    std::map<const Polygon*, IndexedPointInAreaLocator>& locatorCache,
+    CoordinateXY& coordNested)
+{
+    const LinearRing* shell = poly->getExteriorRing();
+
+    std::vector<const Polygon*> results;
+    index.query(*(poly->getEnvelopeInternal()), results);
+
+    for (const Polygon* possibleOuterPoly: results) {
+
+        if (poly == possibleOuterPoly)
+            continue;
+        /**
+         * If polygon is not fully covered by candidate polygon it cannot be nested
+         */
+        if (! possibleOuterPoly->getEnvelopeInternal()->covers(poly->getEnvelopeInternal()))
+            continue;
+
+        bool gotNestedPt = findNestedPoint(shell, possibleOuterPoly,
+            getLocator(possibleOuterPoly, locatorCache), coordNested);
+        if (gotNestedPt)
+            return true;
     }
     return false;
 }
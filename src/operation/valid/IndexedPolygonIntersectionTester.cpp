@@ -0,0 +1,120 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/operation/valid/IndexedPolygonIntersectionTester.h>
+
+#include <geos/geom/LinearRing.h>
+#include <geos/geom/MultiPolygon.h>
+#include <geos/geom/Polygon.h>
+#include <geos/index/chain/MonotoneChainBuilder.h>
+#include <geos/noding/MCIndexNoder.h>
+#include <geos/operation/valid/PolygonIntersectionAnalyzer.h>
+#include <geos/operation/valid/RepeatedPointRemover.h>
+#include <geos/operation/valid/TopologyValidationError.h>
+#include <geos/util/parallel.h>
+
+#include <atomic>
+#include <limits>
+#include <mutex>
+
+using geos::geom::CoordinateSequence;
+using geos::geom::LinearRing;
+using geos::geom::MultiPolygon;
+using geos::geom::Polygon;
+using geos::index::chain::MonotoneChain;
+using geos::index::chain::MonotoneChainBuilder;
+using geos::noding::MCIndexNoder;
+
+namespace geos {      // geos
+namespace operation { // geos.operation
+namespace valid {     // geos.operation.valid
+
+/* public */
+IndexedPolygonIntersectionTester::IndexedPolygonIntersectionTester(const MultiPolygon* multiPoly, bool p_isInvertedRingValid)
+    : isInvertedRingValid(p_isInvertedRingValid)
+    , invalidCode(TopologyValidationError::oNoInvalidIntersection)
+    , invalidLocation(geom::CoordinateXY::getNull())
+{
+    for (std::size_t i = 0; i < multiPoly->getNumGeometries(); i++) {
+        const Polygon* poly = multiPoly->getGeometryN(i);
+        if (poly->isEmpty()) continue;
+        addRing(poly->getExteriorRing(), i);
+        for (std::size_t j = 0; j < poly->getNumInteriorRing(); j++) {
+            addRing(poly->getInteriorRingN(j), i);
+        }
+    }
+    for (const MonotoneChain& mc : chains) {
+        index.insert(mc.getEnvelope(), &mc);
+    }
+    //-- build now, so that queries do not modify the index
+    index.build();
+}
+
+/* private */
+void
+IndexedPolygonIntersectionTester::addRing(const LinearRing* ring, std::size_t polyIndex)
+{
+    if (ring->isEmpty()) return;
+
+    const CoordinateSequence* pts = ring->getCoordinatesRO();
+    //-- repeated points must be removed for accurate intersection detection
+    if (pts->hasRepeatedPoints()) {
+        coordSeqStore.push_back(RepeatedPointRemover::removeRepeatedPoints(pts));
+        pts = coordSeqStore.back().get();
+    }
+    segStrings.emplace_back(const_cast<CoordinateSequence*>(pts), nullptr);
+    MonotoneChainBuilder::getChains(pts, &segStrings.back(), chains);
+    chainPolygon.resize(chains.size(), polyIndex);
+}
+
+/* public */
+bool
+IndexedPolygonIntersectionTester::hasInvalidIntersection(std::size_t numThreads)
+{
+    const std::size_t NONE = std::numeric_limits<std::size_t>::max();
+    std::atomic<std::size_t> firstInvalidChain(NONE);
+    std::mutex resultLock;
+
+    util::parallelFor(chains.size(), numThreads, [&](std::size_t i) {
+        //-- an earlier chain is already known to be invalid
+        if (i > firstInvalidChain.load(std::memory_order_relaxed))
+            return;
+
+        const MonotoneChain& queryChain = chains[i];
+        PolygonIntersectionAnalyzer analyzer(isInvertedRingValid);
+        MCIndexNoder::SegmentOverlapAction overlapAction(analyzer);
+
+        index.query(queryChain.getEnvelope(), [&](const MonotoneChain* testChain) {
+            std::size_t j = chainIndex(testChain);
+            //-- test each pair once, and only between different polygons
+            if (j <= i || chainPolygon[j] == chainPolygon[i])
+                return true;
+            queryChain.computeOverlaps(testChain, &overlapAction);
+            return ! analyzer.isDone();
+        });
+
+        if (! analyzer.isInvalid())
+            return;
+
+        std::lock_guard<std::mutex> guard(resultLock);
+        if (i < firstInvalidChain.load()) {
+            firstInvalidChain = i;
+            invalidCode = analyzer.getInvalidCode();
+            invalidLocation = analyzer.getInvalidLocation();
+        }
+    });
+    return firstInvalidChain.load() != NONE;
+}
+
+} // namespace geos.operation.valid
+} // namespace geos.operation
+} // namespace geos
@@ -27,10 +27,15 @@
 #include <geos/operation/valid/IsValidOp.h>
 #include <geos/operation/valid/IndexedNestedHoleTester.h>
 #include <geos/operation/valid/IndexedNestedPolygonTester.h>
+#include <geos/operation/valid/IndexedPolygonIntersectionTester.h>
+#include <geos/util/parallel.h>
 #include <geos/util/UnsupportedOperationException.h>
 #include <geos/util/IllegalArgumentException.h>
 
+#include <atomic>
 #include <cmath>
+#include <limits>
+#include <mutex>
 
 using namespace geos::geom;
 using geos::algorithm::locate::IndexedPointInAreaLocator;
@@ -205,6 +210,9 @@ IsValidOp::isValid(const Polygon* g)
 bool
 IsValidOp::isValid(const MultiPolygon* g)
 {
+    if (numThreads != 1 && g->getNumGeometries() > 1)
+        return isValidParallel(g);
+
     for (std::size_t i = 0; i < g->getNumGeometries(); i++) {
         const Polygon* p = g->getGeometryN(i);
         checkCoordinatesValid(p);
@@ -244,6 +252,57 @@ IsValidOp::isValid(const MultiPolygon* g)
 }
 
 
+/* private */
+bool
+IsValidOp::isValidParallel(const MultiPolygon* g)
+{
+    /**
+     * Check each polygon on its own.
+     * Polygons before the first invalid one found are always checked,
+     * so the error reported does not depend on the number of threads.
+     */
+    const std::size_t NONE = std::numeric_limits<std::size_t>::max();
+    std::atomic<std::size_t> firstInvalid(NONE);
+    std::mutex errorLock;
+
+    util::parallelFor(g->getNumGeometries(), numThreads, [&](std::size_t i) {
+        if (i > firstInvalid.load(std::memory_order_relaxed))
+            return;
+        IsValidOp polyOp(g->getGeometryN(i));
+        polyOp.setSelfTouchingRingFormingHoleValid(isInvertedRingValid);
+        if (polyOp.isValidGeometry(polyOp.inputGeometry))
+            return;
+
+        std::lock_guard<std::mutex> guard(errorLock);
+        if (i < firstInvalid.load()) {
+            firstInvalid = i;
+            validErr = std::move(polyOp.validErr);
+        }
+    });
+    if (hasInvalidError()) return false;
+
+    /**
+     * Polygons are individually valid,
+     * so check they do not cross or overlap each other...
+     */
+    IndexedPolygonIntersectionTester intersectionTester(g, isInvertedRingValid);
+    if (intersectionTester.hasInvalidIntersection(numThreads)) {
+        logInvalid(intersectionTester.getInvalidCode(),
+                   intersectionTester.getInvalidLocation());
+        return false;
+    }
+
+    //-- ... and that no shell is nested inside another polygon
+    IndexedNestedPolygonTester nestedTester(g);
+    if (nestedTester.isNested(numThreads)) {
+        logInvalid(TopologyValidationError::eNestedShells,
+                   nestedTester.getNestedPoint());
+        return false;
+    }
+    return true;
+}
+
+
 /* private */
 bool
 IsValidOp::isValid(const GeometryCollection* gc)
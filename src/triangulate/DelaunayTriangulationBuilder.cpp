@@ -26,6 +26,7 @@
 #include <geos/operation/valid/RepeatedPointRemover.h>
 #include <geos/triangulate/IncrementalDelaunayTriangulator.h>
 #include <geos/triangulate/quadedge/QuadEdgeSubdivision.h>
+#include <geos/triangulate/quadedge/TriangleVisitor.h>
 #include <geos/operation/valid/RepeatedPointRemover.h>
 #include <geos/operation/valid/RepeatedPointTester.h>
 #include <geos/util.h>
@@ -70,7 +71,7 @@ DelaunayTriangulationBuilder::toVertices(
 }
 
 DelaunayTriangulationBuilder::DelaunayTriangulationBuilder() :
-    siteCoords(nullptr), tolerance(0.0), subdiv(nullptr)
+    siteCoords(nullptr), tolerance(0.0), isRandomizedInsertion(false), subdiv(nullptr)
 {
 }
 
@@ -102,10 +103,16 @@ DelaunayTriangulationBuilder::create()
 
     Envelope siteEnv = siteCoords->getEnvelope();
     auto vertices = toVertices(*siteCoords);
-    std::sort(vertices.begin(),
-              vertices.end()); // Best performance from locator when inserting points near each other
+    if(isRandomizedInsertion) {
+        IncrementalDelaunayTriangulator::sortForInsertion(vertices);
+    }
+    else {
+        std::sort(vertices.begin(),
+                  vertices.end()); // Best performance from locator when inserting points near each other
+    }
 
     subdiv.reset(new quadedge::QuadEdgeSubdivision(siteEnv, tolerance));
+    subdiv->setWalkFromStartEdge(isRandomizedInsertion);
     IncrementalDelaunayTriangulator triangulator = IncrementalDelaunayTriangulator(subdiv.get());
     triangulator.insertSites(vertices);
 }
@@ -141,6 +148,63 @@ DelaunayTriangulationBuilder::getTriangles(
     return subdiv->getTriangles(geomFact);
 }
 
+void
+DelaunayTriangulationBuilder::visitTriangles(quadedge::TriangleVisitor& visitor)
+{
+    create();
+    if (!subdiv) {
+        return;
+    }
+
+    subdiv->visitTriangles(&visitor, false);
+}
+
+namespace {
+
+class TriangleIndexVisitor : public quadedge::TriangleVisitor {
+private:
+    const CoordinateSequence& sites;
+    std::vector<std::size_t>& indices;
+
+    std::size_t
+    indexOf(const CoordinateXY& p) const
+    {
+        // the sites are sorted, and each vertex is a copy of a site
+        auto pts = sites.items<CoordinateXY>();
+        auto it = std::lower_bound(pts.begin(), pts.end(), p, CoordinateLessThan());
+        return static_cast<std::size_t>(it - pts.begin());
+    }
+
+public:
+    TriangleIndexVisitor(const CoordinateSequence& p_sites, std::vector<std::size_t>& p_indices)
+        : sites(p_sites), indices(p_indices)
+    {}
+
+    void
+    visit(std::array<quadedge::QuadEdge*, 3>& triEdges) override
+    {
+        for (const quadedge::QuadEdge* e : triEdges) {
+            indices.push_back(indexOf(e->orig().getCoordinate()));
+        }
+    }
+};
+
+}
+
+std::vector<std::size_t>
+DelaunayTriangulationBuilder::getTriangleIndices()
+{
+    std::vector<std::size_t> indices;
+    create();
+    if (!subdiv) {
+        return indices;
+    }
+
+    TriangleIndexVisitor visitor(*siteCoords, indices);
+    subdiv->visitTriangles(&visitor, false);
+    return indices;
+}
+
 geom::Envelope
 DelaunayTriangulationBuilder::envelope(const geom::CoordinateSequence& coords)
 {
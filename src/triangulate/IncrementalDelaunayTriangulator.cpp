@@ -22,6 +22,14 @@
 #include <geos/triangulate/quadedge/QuadEdgeSubdivision.h>
 #include <geos/triangulate/quadedge/LocateFailureException.h>
 #include <geos/algorithm/Orientation.h>
+#include <geos/geom/Envelope.h>
+#include <geos/shape/fractal/HilbertCode.h>
+#include <geos/shape/fractal/HilbertEncoder.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <random>
 
 namespace geos {
 namespace triangulate { //geos.triangulate
@@ -50,6 +58,57 @@ IncrementalDelaunayTriangulator::insertSites(const VertexList& vertices)
     }
 }
 
+/* public static */
+void
+IncrementalDelaunayTriangulator::sortForInsertion(VertexList& vertices)
+{
+    // rounds smaller than this are not split further
+    static constexpr std::size_t MIN_ROUND_SIZE = 64;
+
+    std::size_t n = vertices.size();
+    if (n < 2) return;
+
+    geom::Envelope extent;
+    for (const Vertex& v : vertices) {
+        extent.expandToInclude(v.getCoordinate());
+    }
+    shape::fractal::HilbertEncoder encoder(shape::fractal::HilbertCode::MAX_LEVEL, extent);
+    std::vector<uint32_t> codes(n);
+    for (std::size_t i = 0; i < n; i++) {
+        geom::Envelope env(vertices[i].getCoordinate());
+        codes[i] = encoder.encode(&env);
+    }
+
+    // fixed seed, so the result is reproducible
+    std::vector<std::size_t> order(n);
+    std::iota(order.begin(), order.end(), 0);
+    std::mt19937 gen(12345);
+    for (std::size_t i = n - 1; i > 0; i--) {
+        std::size_t j = static_cast<std::size_t>(gen()) % (i + 1);
+        std::swap(order[i], order[j]);
+    }
+
+    // the last round holds half the vertices, the one before a quarter, etc.
+    auto byCode = [&codes](std::size_t a, std::size_t b) {
+        if (codes[a] != codes[b]) return codes[a] < codes[b];
+        return a < b;
+    };
+    std::size_t end = n;
+    while (end > 0) {
+        std::size_t start = end > MIN_ROUND_SIZE ? end / 2 : 0;
+        std::sort(order.begin() + static_cast<std::ptrdiff_t>(start),
+                  order.begin() + static_cast<std::ptrdiff_t>(end), byCode);
+        end = start;
+    }
+
+    VertexList sorted;
+    sorted.reserve(n);
+    for (std::size_t i : order) {
+        sorted.push_back(vertices[i]);
+    }
+    vertices.swap(sorted);
+}
+
 QuadEdge&
 IncrementalDelaunayTriangulator::insertSite(const Vertex& v)
 {
@@ -70,10 +129,31 @@ IncrementalDelaunayTriangulator::insertSite(const Vertex& v)
         // point is already in subdivision.
         return *e;
     }
-    else if(subdiv->isOnEdge(*e, v.getCoordinate())) {
+
+    QuadEdge* onEdge = nullptr;
+    if(subdiv->isOnEdge(*e, v.getCoordinate())) {
+        onEdge = e;
+    }
+    else if(subdiv->isWalkFromStartEdge()) {
+        /*
+         * A walk from an arbitrary edge may end on any edge of the
+         * triangle containing the point, so the point may be
+         * a vertex of, or lie on, another of its edges.
+         */
+        if(subdiv->isVertexOfEdge(e->lNext(), v)) {
+            return e->lNext();
+        }
+        if(subdiv->isOnEdge(e->lNext(), v.getCoordinate())) {
+            onEdge = &e->lNext();
+        }
+        else if(subdiv->isOnEdge(e->lPrev(), v.getCoordinate())) {
+            onEdge = &e->lPrev();
+        }
+    }
+    if(onEdge != nullptr) {
         // the point lies exactly on an edge, so delete the edge
         // (it will be replaced by a pair of edges which have the point as a vertex)
-        e = &e->oPrev();
+        e = &onEdge->oPrev();
         subdiv->remove(e->oNext());
     }
 
@@ -81,9 +161,7 @@ IncrementalDelaunayTriangulator::insertSite(const Vertex& v)
      * Connect the new point to the vertices of the containing triangle
      * (or quadrilateral, if the new point fell on an existing edge.)
      */
-    QuadEdge* base = &subdiv->makeEdge(e->orig(), v);
-
-    QuadEdge::splice(*base, *e);
+    QuadEdge* base = &subdiv->connectVertex(*e, v);
     QuadEdge* startEdge = base;
     do {
         base = &subdiv->connect(*e, base->sym());
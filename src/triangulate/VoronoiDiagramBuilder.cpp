@@ -44,7 +44,7 @@ using namespace geos::geom;
 
 
 VoronoiDiagramBuilder::VoronoiDiagramBuilder() :
-    tolerance(0.0), clipEnv(nullptr), inputGeom(nullptr), inputSeq(nullptr), isOrdered(false)
+    tolerance(0.0), clipEnv(nullptr), inputGeom(nullptr), inputSeq(nullptr), isOrdered(false), isRandomizedInsertion(false)
 {
 }
 
@@ -80,6 +80,12 @@ VoronoiDiagramBuilder::setTolerance(double nTolerance)
     tolerance = nTolerance;
 }
 
+void
+VoronoiDiagramBuilder::setRandomizedInsertion(bool p_isRandomizedInsertion)
+{
+    isRandomizedInsertion = p_isRandomizedInsertion;
+}
+
 void
 VoronoiDiagramBuilder::create()
 {
@@ -100,9 +106,15 @@ VoronoiDiagramBuilder::create()
     }
 
     auto vertices = DelaunayTriangulationBuilder::toVertices(*siteCoords);
-    std::sort(vertices.begin(), vertices.end()); // Best performance from locator when inserting points near each other
+    if(isRandomizedInsertion) {
+        IncrementalDelaunayTriangulator::sortForInsertion(vertices);
+    }
+    else {
+        std::sort(vertices.begin(), vertices.end()); // Best performance from locator when inserting points near each other
+    }
 
     subdiv.reset(new quadedge::QuadEdgeSubdivision(diagramEnv, tolerance));
+    subdiv->setWalkFromStartEdge(isRandomizedInsertion);
     IncrementalDelaunayTriangulator triangulator(subdiv.get());
     /**
      * Avoid creating very narrow triangles along triangulation boundary.
@@ -158,6 +170,37 @@ VoronoiDiagramBuilder::getDiagram(const geom::GeometryFactory& geomFact)
     return ret;
 }
 
+void
+VoronoiDiagramBuilder::visitDiagram(const geom::GeometryFactory& geomFact,
+                                    const std::function<void(const geom::CoordinateXY& site,
+                                                             std::unique_ptr<geom::Geometry> cell)>& visitor)
+{
+    create();
+
+    if (!subdiv) {
+        return;
+    }
+
+    std::unique_ptr<geom::Geometry> clipPoly(geomFact.toGeometry(&diagramEnv));
+
+    subdiv->visitVoronoiCellPolygons(geomFact, [&](std::unique_ptr<Geometry> cell) {
+        // Don't let references to Vertex objects
+        // owned by the QuadEdgeSubdivision escape
+        const CoordinateXY site = *static_cast<const Coordinate*>(cell->getUserData());
+        cell->setUserData(nullptr);
+
+        // don't clip unless necessary
+        if(diagramEnv.contains(cell->getEnvelopeInternal())) {
+            visitor(site, std::move(cell));
+        } else if(diagramEnv.intersects(cell->getEnvelopeInternal())) {
+            auto result = clipPoly->intersection(cell.get());
+            if (!result->isEmpty()) {
+                visitor(site, std::move(result));
+            }
+        }
+    });
+}
+
 std::unique_ptr<MultiLineString>
 VoronoiDiagramBuilder::getDiagramEdges(const geom::GeometryFactory& geomFact)
 {
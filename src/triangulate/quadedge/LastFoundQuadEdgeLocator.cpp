@@ -44,7 +44,16 @@ LastFoundQuadEdgeLocator::findEdge()
 QuadEdge*
 LastFoundQuadEdgeLocator::locate(const Vertex& v)
 {
-    if(!lastEdge || !lastEdge->isLive()) {
+    bool isRestart = !lastEdge || !lastEdge->isLive();
+    if(subdiv->isWalkFromStartEdge()) {
+        /*
+         * A location outside the extent of those already located
+         * is reached more directly from the frame.
+         */
+        isRestart = isRestart || !locatedEnv.contains(v.getCoordinate());
+        locatedEnv.expandToInclude(v.getCoordinate());
+    }
+    if(isRestart) {
         init();
     }
 
@@ -115,7 +115,7 @@ std::unique_ptr<LineSegment>
 QuadEdge::toLineSegment() const
 {
     return std::unique_ptr<geom::LineSegment>(
-               new geom::LineSegment(vertex.getCoordinate(), dest().getCoordinate()));
+               new geom::LineSegment(orig().getCoordinate(), dest().getCoordinate()));
 }
 
 std::ostream&
@@ -20,6 +20,7 @@
 
 #include <algorithm>
 #include <vector>
+#include <cstdint>
 #include <set>
 #include <iostream>
 
@@ -67,7 +68,8 @@ QuadEdgeSubdivision::getTriangleEdges(const QuadEdge& startQE,
 QuadEdgeSubdivision::QuadEdgeSubdivision(const geom::Envelope& env, double p_tolerance) :
     tolerance(p_tolerance),
     locator(new LastFoundQuadEdgeLocator(this)),
-    visit_state_clean(true)
+    visit_state_clean(true),
+    walkFromStartEdge(false)
 {
     edgeCoincidenceTolerance = tolerance / EDGE_COINCIDENCE_TOL_FACTOR;
     createFrame(env);
@@ -100,11 +102,11 @@ QuadEdgeSubdivision::initSubdiv()
     assert(quadEdges.empty());
 
     // build initial subdivision from frame
-    startingEdges[0] = QuadEdge::makeEdge(frameVertex[0], frameVertex[1], quadEdges);
-    startingEdges[1] = QuadEdge::makeEdge(frameVertex[1], frameVertex[2], quadEdges);
+    startingEdges[0] = &QuadEdgeQuartet::makeEdgeSharingVertices(frameVertex[0], frameVertex[1], quadEdges);
+    startingEdges[1] = &QuadEdgeQuartet::makeEdgeSharingVertices(frameVertex[1], frameVertex[2], quadEdges);
     QuadEdge::splice(startingEdges[0]->sym(), *startingEdges[1]);
 
-    startingEdges[2] = QuadEdge::makeEdge(frameVertex[2], frameVertex[0], quadEdges);
+    startingEdges[2] = &QuadEdgeQuartet::makeEdgeSharingVertices(frameVertex[2], frameVertex[0], quadEdges);
     QuadEdge::splice(startingEdges[1]->sym(), *startingEdges[2]);
     QuadEdge::splice(startingEdges[2]->sym(), *startingEdges[0]);
 }
@@ -112,15 +114,30 @@ QuadEdgeSubdivision::initSubdiv()
 QuadEdge&
 QuadEdgeSubdivision::makeEdge(const Vertex& o, const Vertex& d)
 {
-    QuadEdge* e = QuadEdge::makeEdge(o, d, quadEdges);
-    return *e;
+    vertices.push_back(o);
+    const Vertex& vo = vertices.back();
+    vertices.push_back(d);
+    const Vertex& vd = vertices.back();
+    return QuadEdgeQuartet::makeEdgeSharingVertices(vo, vd, quadEdges);
+}
+
+QuadEdge&
+QuadEdgeSubdivision::connectVertex(QuadEdge& e, const Vertex& v)
+{
+    vertices.push_back(v);
+    QuadEdge& base = QuadEdgeQuartet::makeEdgeSharingVertices(e.orig(), vertices.back(), quadEdges);
+    QuadEdge::splice(base, e);
+    return base;
 }
 
 QuadEdge&
 QuadEdgeSubdivision::connect(QuadEdge& a, QuadEdge& b)
 {
-    QuadEdge* e = QuadEdge::connect(a, b, quadEdges);
-    return *e;
+    //-- same as QuadEdge::connect, sharing the vertices of a and b
+    QuadEdge& e = QuadEdgeQuartet::makeEdgeSharingVertices(a.dest(), b.orig(), quadEdges);
+    QuadEdge::splice(e, a.lNext());
+    QuadEdge::splice(e.sym(), b);
+    return e;
 }
 
 void
@@ -139,15 +156,29 @@ QuadEdge*
 QuadEdgeSubdivision::locateFromEdge(const Vertex& v,
                                     const QuadEdge& startEdge) const
 {
-    ::geos::ignore_unused_variable_warning(startEdge);
-
     std::size_t iter = 0;
     auto maxIter = quadEdges.size();
 
-    QuadEdge* e = startingEdges[0];
+    QuadEdge* start = walkFromStartEdge ? const_cast<QuadEdge*>(&startEdge) : startingEdges[0];
+    QuadEdge* e = start;
+
+    /*
+     * A walk from an arbitrary edge which always prefers the same edge
+     * can cycle in a non-Delaunay region (such as near the frame).
+     * If that happens the walk is restarted, choosing pseudo-randomly
+     * when both of the other edges of the current triangle face v.
+     * This stochastic walk terminates.
+     */
+    bool isStochastic = false;
+    uint32_t rnd = 0x9E3779B9u;
 
     for(;;) {
         ++iter;
+        if(iter > maxIter && walkFromStartEdge && !isStochastic) {
+            isStochastic = true;
+            iter = 0;
+            e = start;
+        }
         /*
          * So far it has always been the case that failure to locate indicates an
          * invalid subdivision. So just fail completely. (An alternative would be
@@ -166,12 +197,25 @@ QuadEdgeSubdivision::locateFromEdge(const Vertex& v,
         }
         else if(v.rightOf(*e)) {
             e = &e->sym();
+            continue;
+        }
+
+        QuadEdge* first = &e->oNext();
+        QuadEdge* second = &e->dPrev();
+        if(isStochastic) {
+            rnd ^= rnd << 13;
+            rnd ^= rnd >> 17;
+            rnd ^= rnd << 5;
+            if(rnd & 1) {
+                std::swap(first, second);
+            }
         }
-        else if(!v.rightOf(e->oNext())) {
-            e = &e->oNext();
+
+        if(!v.rightOf(*first)) {
+            e = first;
         }
-        else if(!v.rightOf(e->dPrev())) {
-            e = &e->dPrev();
+        else if(!v.rightOf(*second)) {
+            e = second;
         }
         else {
             // on edge or in triangle containing edge
@@ -219,8 +263,7 @@ QuadEdgeSubdivision::insertSite(const Vertex& v)
     // Connect the new point to the vertices of the containing
     // triangle (or quadrilateral, if the new point fell on an
     // existing edge.)
-    QuadEdge* base = &makeEdge(e->orig(), v);
-    QuadEdge::splice(*base, *e);
+    QuadEdge* base = &connectVertex(*e, v);
     QuadEdge* startEdge = base;
     do {
         base = &connect(*e, base->sym());
@@ -381,7 +424,13 @@ public:
 
 class
     QuadEdgeSubdivision::TriangleCircumcentreVisitor : public TriangleVisitor {
+private:
+    std::deque<Vertex>& circumcentres;
 public:
+    TriangleCircumcentreVisitor(std::deque<Vertex>& p_circumcentres)
+        : circumcentres(p_circumcentres)
+    {}
+
     void
     visit(std::array<QuadEdge*, 3>& triEdges) override
     {
@@ -392,7 +441,8 @@ public:
         //TODO: identify heuristic to allow calling faster circumcentre() when possible
         triangle.circumcentreDD(cc);
 
-        Vertex ccVertex(cc);
+        circumcentres.emplace_back(cc);
+        const Vertex& ccVertex = circumcentres.back();
 
         for(uint8_t i = 0 ; i < 3 ; i++) {
             triEdges[i]->rot().setOrig(ccVertex);
@@ -492,25 +542,34 @@ std::vector<std::unique_ptr<geom::Geometry>>
 QuadEdgeSubdivision::getVoronoiCellPolygons(const geom::GeometryFactory& geomFact)
 {
     std::vector<std::unique_ptr<geom::Geometry>> cells;
-    TriangleCircumcentreVisitor tricircumVisitor;
+    visitVoronoiCellPolygons(geomFact, [&cells](std::unique_ptr<geom::Geometry> cell) {
+        cells.push_back(std::move(cell));
+    });
+    return cells;
+}
+
+void
+QuadEdgeSubdivision::visitVoronoiCellPolygons(const geom::GeometryFactory& geomFact,
+        const std::function<void(std::unique_ptr<geom::Geometry>)>& visitor)
+{
+    circumcentres.clear();
+    TriangleCircumcentreVisitor tricircumVisitor(circumcentres);
 
     visitTriangles(&tricircumVisitor, true);
 
     std::unique_ptr<QuadEdgeSubdivision::QuadEdgeList> edges = getVertexUniqueEdges(false);
 
-    cells.reserve(edges->size());
     for(const QuadEdge* qe : *edges) {
-        cells.push_back(getVoronoiCellPolygon(qe, geomFact));
+        visitor(getVoronoiCellPolygon(qe, geomFact));
     }
-
-    return cells;
 }
 
 std::vector<std::unique_ptr<geom::Geometry>>
 QuadEdgeSubdivision::getVoronoiCellEdges(const geom::GeometryFactory& geomFact)
 {
     std::vector<std::unique_ptr<geom::Geometry>> cells;
-    TriangleCircumcentreVisitor tricircumVisitor;
+    circumcentres.clear();
+    TriangleCircumcentreVisitor tricircumVisitor(circumcentres);
 
     visitTriangles((TriangleVisitor*) &tricircumVisitor, true);
 
@@ -592,6 +651,10 @@ QuadEdgeSubdivision::getVertexUniqueEdges(bool includeFrame)
 
     for(auto& quartet : quadEdges) {
         QuadEdge* qe = &quartet.base();
+        // skip edges removed from the subdivision
+        if (!qe->isLive()) {
+            continue;
+        }
         const Vertex& v = qe->orig();
 
         if(visitedVertices.insert(v).second) {
@@ -0,0 +1,121 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/util/Arena.h>
+
+#include <cassert>
+#include <cstdint>
+
+namespace geos {
+namespace util { // geos::util
+
+Arena::Arena(std::size_t p_initialBlockSize)
+    : initialBlockSize(p_initialBlockSize > 0 ? p_initialBlockSize : DEFAULT_BLOCK_SIZE)
+    , nextBlockSize(initialBlockSize)
+    , bytesUsed(0)
+    , cur(nullptr)
+    , end(nullptr)
+{}
+
+Arena::~Arena() = default;
+
+void*
+Arena::allocate(std::size_t bytes, std::size_t alignment)
+{
+    assert(alignment > 0 && (alignment & (alignment - 1)) == 0);
+
+    auto p = reinterpret_cast<std::uintptr_t>(cur);
+    std::size_t pad = (alignment - (p & (alignment - 1))) & (alignment - 1);
+
+    if (cur == nullptr || pad + bytes > static_cast<std::size_t>(end - cur)) {
+        addBlock(bytes + alignment);
+        p = reinterpret_cast<std::uintptr_t>(cur);
+        pad = (alignment - (p & (alignment - 1))) & (alignment - 1);
+    }
+
+    char* result = cur + pad;
+    cur = result + bytes;
+    bytesUsed += bytes;
+    return result;
+}
+
+void
+Arena::addBlock(std::size_t minSize)
+{
+    std::size_t size = nextBlockSize;
+    while (size < minSize) {
+        size *= 2;
+    }
+    nextBlockSize = size * 2;
+
+    blocks.push_back(Block{ std::unique_ptr<char[]>(new char[size]), size });
+    cur = blocks.back().data.get();
+    end = cur + size;
+}
+
+void
+Arena::reset()
+{
+    bytesUsed = 0;
+
+    if (blocks.empty()) {
+        return;
+    }
+
+    // Replace a chain of blocks by a single block able to hold
+    // the same amount of data, so a repeated workload of the same
+    // size runs without further allocations.
+    if (blocks.size() > 1) {
+        std::size_t total = getCapacity();
+        blocks.clear();
+        blocks.push_back(Block{ std::unique_ptr<char[]>(new char[total]), total });
+        nextBlockSize = total * 2;
+    }
+
+    cur = blocks.front().data.get();
+    end = cur + blocks.front().size;
+}
+
+void
+Arena::reset(std::size_t maxRetained)
+{
+    if (getCapacity() > maxRetained) {
+        release();
+    }
+    else {
+        reset();
+    }
+}
+
+void
+Arena::release()
+{
+    blocks.clear();
+    nextBlockSize = initialBlockSize;
+    bytesUsed = 0;
+    cur = nullptr;
+    end = nullptr;
+}
+
+std::size_t
+Arena::getCapacity() const
+{
+    std::size_t total = 0;
+    for (const auto& b : blocks) {
+        total += b.size;
+    }
+    return total;
+}
+
+} // namespace geos::util
+} // namespace geos
+
@@ -0,0 +1,211 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/util/parallel.h>
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace geos {
+namespace util {
+
+std::size_t
+defaultThreadCount()
+{
+    unsigned int n = std::thread::hardware_concurrency();
+    return n == 0 ? 1 : static_cast<std::size_t>(n);
+}
+
+void
+parallelFor(std::size_t n, std::size_t numThreads,
+            const std::function<void(std::size_t)>& fn)
+{
+    if (numThreads == 0) {
+        numThreads = defaultThreadCount();
+    }
+    numThreads = std::min(numThreads, n);
+
+    if (numThreads <= 1) {
+        for (std::size_t i = 0; i < n; i++) {
+            fn(i);
+        }
+        return;
+    }
+
+    std::atomic<std::size_t> next(0);
+    std::atomic<bool> isFailed(false);
+    std::exception_ptr error;
+    std::mutex errorLock;
+
+    auto worker = [&]() {
+        while (! isFailed.load(std::memory_order_relaxed)) {
+            std::size_t i = next.fetch_add(1, std::memory_order_relaxed);
+            if (i >= n) return;
+            try {
+                fn(i);
+            }
+            catch (...) {
+                std::lock_guard<std::mutex> guard(errorLock);
+                if (! error) {
+                    error = std::current_exception();
+                }
+                isFailed = true;
+            }
+        }
+    };
+
+    //-- the calling thread does its share of the work
+    std::vector<std::thread> threads;
+    threads.reserve(numThreads - 1);
+    for (std::size_t t = 1; t < numThreads; t++) {
+        try {
+            threads.emplace_back(worker);
+        }
+        catch (const std::system_error&) {
+            //-- continue with the threads already started
+            break;
+        }
+    }
+    worker();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+ThreadPool::ThreadPool(std::size_t numThreads)
+{
+    if (numThreads == 0) {
+        numThreads = defaultThreadCount();
+    }
+
+    if (numThreads > 1) {
+        threads.reserve(numThreads - 1);
+    }
+    for (std::size_t t = 1; t < numThreads; t++) {
+        try {
+            threads.emplace_back([this]() {
+                run();
+            });
+        }
+        catch (const std::system_error&) {
+            //-- continue with the threads already started
+            break;
+        }
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        isStopping = true;
+    }
+    startCondition.notify_all();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+void
+ThreadPool::parallelFor(std::size_t n, const std::function<void(std::size_t)>& fn)
+{
+    if (threads.empty() || n <= 1) {
+        for (std::size_t i = 0; i < n; i++) {
+            fn(i);
+        }
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        task = &fn;
+        numItems = n;
+        next = 0;
+        isFailed = false;
+        error = nullptr;
+        numBusy = threads.size();
+        generation++;
+    }
+    startCondition.notify_all();
+
+    work();
+
+    std::exception_ptr loopError;
+    {
+        std::unique_lock<std::mutex> guard(lock);
+        doneCondition.wait(guard, [this]() {
+            return numBusy == 0;
+        });
+        task = nullptr;
+        std::swap(loopError, error);
+    }
+
+    if (loopError) {
+        std::rethrow_exception(loopError);
+    }
+}
+
+void
+ThreadPool::run()
+{
+    std::size_t lastGeneration = 0;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> guard(lock);
+            startCondition.wait(guard, [this, lastGeneration]() {
+                return isStopping || generation != lastGeneration;
+            });
+            if (isStopping) {
+                return;
+            }
+            lastGeneration = generation;
+        }
+
+        work();
+
+        std::lock_guard<std::mutex> guard(lock);
+        if (--numBusy == 0) {
+            doneCondition.notify_one();
+        }
+    }
+}
+
+void
+ThreadPool::work()
+{
+    while (! isFailed.load(std::memory_order_relaxed)) {
+        std::size_t i = next.fetch_add(1, std::memory_order_relaxed);
+        if (i >= numItems) return;
+        try {
+            (*task)(i);
+        }
+        catch (...) {
+            std::lock_guard<std::mutex> guard(lock);
+            if (! error) {
+                error = std::current_exception();
+            }
+            isFailed = true;
+        }
+    }
+}
+
+}
+}
@@ -0,0 +1,154 @@
+//
+// Test Suite for geos::algorithm::construct::IndexedPointInPolygonsLocator
+
+#include <tut/tut.hpp>
+// geos
+#include <geos/algorithm/construct/IndexedPointInPolygonsLocator.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/io/WKTReader.h>
+// std
+#include <limits>
+#include <memory>
+#include <random>
+#include <vector>
+
+using geos::algorithm::construct::IndexedPointInPolygonsLocator;
+using geos::geom::CoordinateSequence;
+using geos::geom::CoordinateXY;
+using geos::geom::Geometry;
+using geos::geom::Location;
+
+namespace tut {
+//
+// Test Group
+//
+
+struct test_indexedpointinpolygonslocator_data {
+    geos::geom::GeometryFactory::Ptr factory_;
+    geos::io::WKTReader reader_;
+
+    test_indexedpointinpolygonslocator_data()
+        : factory_(geos::geom::GeometryFactory::create())
+        , reader_(factory_.get())
+    {}
+
+    static void
+    checkLocatePolygons(const Geometry& g, const CoordinateSequence& pts)
+    {
+        std::vector<std::size_t> expected;
+        std::size_t numPolys = g.getNumGeometries();
+        for (std::size_t k = 0; k < pts.size(); k++) {
+            const CoordinateXY& p = pts.getAt<CoordinateXY>(k);
+            std::size_t found = IndexedPointInPolygonsLocator::NOT_FOUND;
+            for (std::size_t i = 0; i < numPolys; i++) {
+                if (g.getGeometryN(i)->getEnvelopeInternal()->intersects(p)) {
+                    IndexedPointInPolygonsLocator single(*g.getGeometryN(i));
+                    if (single.locate(&p) != Location::EXTERIOR) {
+                        found = i;
+                        break;
+                    }
+                }
+            }
+            expected.push_back(found);
+        }
+
+        IndexedPointInPolygonsLocator locator(g);
+        for (std::size_t numThreads : { 1u, 3u }) {
+            ensure(locator.locatePolygons(pts, numThreads) == expected);
+        }
+        for (std::size_t k = 0; k < pts.size(); k++) {
+            bool isFound = expected[k] != IndexedPointInPolygonsLocator::NOT_FOUND;
+            ensure_equals(locator.locate(&pts.getAt<CoordinateXY>(k)) != Location::EXTERIOR, isFound);
+        }
+    }
+};
+
+typedef test_group<test_indexedpointinpolygonslocator_data> group;
+typedef group::object object;
+
+group test_indexedpointinpolygonslocator_group("geos::algorithm::construct::IndexedPointInPolygonsLocator");
+
+//
+// Test Cases
+//
+
+// Overlapping polygons, holes and boundaries
+template<>
+template<>
+void object::test<1>
+()
+{
+    auto g = reader_.read("GEOMETRYCOLLECTION ("
+                          "POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0), (2 2, 8 2, 8 8, 2 8, 2 2)), "
+                          "LINESTRING (0 20, 20 20), "
+                          "POLYGON ((5 5, 15 5, 15 15, 5 15, 5 5)), "
+                          "MULTIPOLYGON (((20 0, 30 0, 30 10, 20 10, 20 0)), ((0 30, 10 30, 10 40, 0 30))))");
+
+    CoordinateSequence pts = CoordinateSequence::XY(0);
+    pts.add(CoordinateXY(1, 1));
+    pts.add(CoordinateXY(5, 5));
+    pts.add(CoordinateXY(6, 6));
+    pts.add(CoordinateXY(12, 12));
+    pts.add(CoordinateXY(10, 5));
+    pts.add(CoordinateXY(25, 5));
+    pts.add(CoordinateXY(5, 35));
+    pts.add(CoordinateXY(10, 20));
+    pts.add(CoordinateXY(std::numeric_limits<double>::quiet_NaN(), 5));
+    pts.add(CoordinateXY(100, 100));
+
+    IndexedPointInPolygonsLocator locator(*g);
+    std::vector<std::size_t> result = locator.locatePolygons(pts);
+    std::size_t NF = IndexedPointInPolygonsLocator::NOT_FOUND;
+    std::vector<std::size_t> expected { 0, 1, 1, 1, 0, 2, 2, NF, NF, NF };
+    ensure(result == expected);
+}
+
+// Random points agree with locating each point separately
+template<>
+template<>
+void object::test<2>
+()
+{
+    std::mt19937 gen(1234);
+    std::uniform_real_distribution<double> coord(0, 200);
+
+    std::vector<std::unique_ptr<Geometry>> polys;
+    for (int i = 0; i < 60; i++) {
+        auto pt = factory_->createPoint(CoordinateXY(coord(gen), coord(gen)));
+        polys.push_back(pt->buffer(coord(gen) / 15 + 2, 4));
+    }
+    CoordinateXY boundaryPt = *polys[0]->getCoordinate();
+    auto g = factory_->createGeometryCollection(std::move(polys));
+
+    CoordinateSequence pts = CoordinateSequence::XY(0);
+    for (int i = 0; i < 3000; i++) {
+        pts.add(CoordinateXY(coord(gen), coord(gen)));
+    }
+    //-- a vertex lies on a boundary
+    pts.add(boundaryPt);
+
+    checkLocatePolygons(*g, pts);
+}
+
+// Empty inputs
+template<>
+template<>
+void object::test<3>
+()
+{
+    CoordinateSequence pts = CoordinateSequence::XY(0);
+    pts.add(CoordinateXY(1, 1));
+
+    auto empty = reader_.read("POLYGON EMPTY");
+    IndexedPointInPolygonsLocator emptyLocator(*empty);
+    ensure(emptyLocator.locatePolygons(pts) == std::vector<std::size_t>{ IndexedPointInPolygonsLocator::NOT_FOUND });
+
+    auto g = reader_.read("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))");
+    IndexedPointInPolygonsLocator locator(*g);
+    ensure(locator.locatePolygons(CoordinateSequence::XY(0)).empty());
+    ensure(locator.locatePolygons(pts) == std::vector<std::size_t>{ 0 });
+}
+
+} // namespace tut
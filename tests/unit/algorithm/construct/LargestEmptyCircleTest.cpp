@@ -7,6 +7,7 @@
 #include <geos/geom/Coordinate.h>
 #include <geos/geom/Geometry.h>
 #include <geos/geom/GeometryFactory.h>
+#include <geos/geom/LineString.h>
 #include <geos/geom/PrecisionModel.h>
 #include <geos/io/WKTReader.h>
 #include <geos/constants.h>
@@ -316,4 +317,28 @@ void object::test<19>()
         0.01, 5.5, 4.5, 2.12 );
 }
 
+// Multithreaded refinement
+template<>
+template<>
+void object::test<20>()
+{
+    std::unique_ptr<Geometry> obstacles(reader_.read(
+        "MULTIPOINT ((10 10), (90 15), (50 50), (20 80), (85 90), (40 30), (70 60), (15 45))"));
+    double tolerance = 0.01;
+
+    LargestEmptyCircle lec1(obstacles.get(), tolerance);
+    double radius1 = lec1.getRadiusLine()->getLength();
+
+    LargestEmptyCircle lec2(obstacles.get(), tolerance);
+    lec2.setNumThreads(2);
+    std::unique_ptr<LineString> line2 = lec2.getRadiusLine();
+
+    LargestEmptyCircle lec4(obstacles.get(), tolerance);
+    lec4.setNumThreads(4);
+    std::unique_ptr<LineString> line4 = lec4.getRadiusLine();
+
+    ensure(line2->equalsExact(line4.get()));
+    ensure_equals("radius", line2->getLength(), radius1, 2 * tolerance);
+}
+
 } // namespace tut
@@ -18,6 +18,7 @@
 #include <sstream>
 #include <string>
 #include <memory>
+#include <vector>
 
 
 
@@ -249,5 +250,61 @@ void object::test<10>
        0.01 );
 }
 
+// Multithreaded refinement
+template<>
+template<>
+void object::test<11>
+()
+{
+    std::unique_ptr<Geometry> geom(reader_.read(
+        "POLYGON ((0 0, 100 0, 100 20, 60 20, 60 80, 100 80, 100 100, 0 100, 0 80, 40 80, 40 20, 0 20, 0 0), (45 45, 55 45, 55 55, 45 55, 45 45))"));
+    double tolerance = 0.01;
+
+    MaximumInscribedCircle mic1(geom.get(), tolerance);
+    double radius1 = mic1.getRadiusLine()->getLength();
+
+    std::unique_ptr<LineString> lines[2];
+    std::size_t threads[2] = { 2, 4 };
+    for (std::size_t i = 0; i < 2; i++) {
+        MaximumInscribedCircle mic(geom.get(), tolerance);
+        mic.setNumThreads(threads[i]);
+        lines[i] = mic.getRadiusLine();
+    }
+
+    ensure(lines[0]->equalsExact(lines[1].get()));
+    ensure_equals("radius", lines[0]->getLength(), radius1, 2 * tolerance);
+    std::unique_ptr<Point> center = lines[0]->getStartPoint();
+    ensure_equals("distance", geom->getBoundary()->distance(center.get()), lines[0]->getLength(), 1e-9);
+}
+
+// Radius lines for a list of polygons
+template<>
+template<>
+void object::test<12>
+()
+{
+    std::vector<std::unique_ptr<Geometry>> geoms;
+    geoms.push_back(reader_.read("POLYGON ((100 200, 200 200, 200 100, 100 100, 100 200))"));
+    geoms.push_back(reader_.read("POLYGON EMPTY"));
+    geoms.push_back(reader_.read("POLYGON ((150 250, 50 150, 150 50, 250 150, 150 250))"));
+    geoms.push_back(reader_.read("MULTIPOLYGON (((150 200, 100 150, 150 100, 250 150, 150 200)), ((400 250, 300 150, 400 50, 560 150, 400 250)))"));
+    std::vector<const Geometry*> list;
+    for (const auto& g : geoms) {
+        list.push_back(g.get());
+    }
+
+    for (std::size_t numThreads : { 1u, 3u }) {
+        auto lines = MaximumInscribedCircle::getRadiusLines(list, 0.001, numThreads);
+        ensure_equals(lines.size(), list.size());
+        for (std::size_t i = 0; i < list.size(); i++) {
+            if (list[i]->isEmpty()) {
+                ensure(lines[i] == nullptr);
+                continue;
+            }
+            auto expected = MaximumInscribedCircle::getRadiusLine(list[i], 0.001);
+            ensure(lines[i]->equalsExact(expected.get()));
+        }
+    }
+}
 
 } // namespace tut
@@ -11,12 +11,14 @@
 #include <geos/geom/GeometryFactory.h>
 #include <geos/geom/Geometry.h> // required for use in unique_ptr
 #include <geos/geom/Coordinate.h>
+#include <geos/geom/CoordinateSequence.h>
 #include <geos/util.h>
 // std
 #include <cmath>
 #include <sstream>
 #include <string>
 #include <memory>
+#include <random>
 
 namespace geos {
 namespace geom {
@@ -184,4 +186,39 @@ void object::test<6>
     }
 }
 
+// Same result whatever the number of threads
+template<>
+template<>
+void object::test<7>
+()
+{
+    std::mt19937 gen(7);
+    std::uniform_real_distribution<double> step(-5, 5);
+    std::vector<GeomPtr> lines;
+    for (std::size_t n : { 1500u, 1200u }) {
+        CoordinateSequence seq;
+        Coordinate c(0, 0);
+        for (std::size_t i = 0; i < n; i++) {
+            seq.add(c);
+            c.x += std::abs(step(gen));
+            c.y += step(gen);
+        }
+        lines.push_back(gf->createLineString(std::move(seq)));
+    }
+
+    for (double densifyFrac : { 0.0, 0.5 }) {
+        DiscreteFrechetDistance dfd1(*lines[0], *lines[1]);
+        DiscreteFrechetDistance dfd4(*lines[0], *lines[1]);
+        if (densifyFrac > 0) {
+            dfd1.setDensifyFraction(densifyFrac);
+            dfd4.setDensifyFraction(densifyFrac);
+        }
+        dfd4.setNumThreads(4);
+
+        ensure_equals(dfd1.distance(), dfd4.distance());
+        ensure(dfd1.getCoordinates()[0].equals2D(dfd4.getCoordinates()[0]));
+        ensure(dfd1.getCoordinates()[1].equals2D(dfd4.getCoordinates()[1]));
+    }
+}
+
 } // namespace tut
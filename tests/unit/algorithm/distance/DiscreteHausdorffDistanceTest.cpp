@@ -12,8 +12,10 @@
 #include <geos/geom/GeometryFactory.h>
 #include <geos/geom/Geometry.h> // required for use in unique_ptr
 #include <geos/geom/Coordinate.h>
+#include <geos/geom/CoordinateSequence.h>
 // std
 #include <cmath>
+#include <random>
 #include <sstream>
 #include <string>
 #include <memory>
@@ -74,6 +76,40 @@ struct test_DiscreteHausdorffDistance_data {
         ensure(diff <= TOLERANCE);
     }
 
+    // The distance computed by testing every point against every segment
+    static PointPairDistance
+    bruteForceDistance(const Geometry& g0, const Geometry& g1, double densifyFrac)
+    {
+        PointPairDistance ptDist;
+        for (int i = 0; i < 2; i++) {
+            const Geometry& discreteGeom = i == 0 ? g0 : g1;
+            const Geometry& geom = i == 0 ? g1 : g0;
+            DiscreteHausdorffDistance::MaxPointDistanceFilter distFilter(geom);
+            discreteGeom.apply_ro(&distFilter);
+            ptDist.setMaximum(distFilter.getMaxPointDistance());
+            if (densifyFrac > 0) {
+                DiscreteHausdorffDistance::MaxDensifiedByFractionDistanceFilter fracFilter(geom, densifyFrac);
+                discreteGeom.apply_ro(fracFilter);
+                ptDist.setMaximum(fracFilter.getMaxPointDistance());
+            }
+        }
+        return ptDist;
+    }
+
+    GeomPtr
+    randomLine(std::mt19937& gen, std::size_t numPoints)
+    {
+        std::uniform_real_distribution<double> step(-5, 5);
+        CoordinateSequence seq;
+        Coordinate c(0, 0);
+        for (std::size_t i = 0; i < numPoints; i++) {
+            seq.add(c);
+            c.x += std::abs(step(gen));
+            c.y += step(gen);
+        }
+        return gf->createLineString(std::move(seq));
+    }
+
     PrecisionModel pm;
     GeometryFactory::Ptr gf;
     geos::io::WKTReader reader;
@@ -216,5 +252,82 @@ void object::test<7>
                   DiscreteHausdorffDistance::distance(*g2, *g3));
 }
 
+// Same result as testing every point against every segment,
+// whatever the number of threads
+template<>
+template<>
+void object::test<8>
+()
+{
+    std::mt19937 gen(1234);
+    std::vector<GeomPtr> geoms;
+    geoms.push_back(randomLine(gen, 3000));
+    geoms.push_back(randomLine(gen, 2000));
+    geoms.push_back(geoms[0]->buffer(10));
+    geoms.push_back(reader.read("MULTIPOINT ((0 0), (100 20), (3000 -50), (500 500))"));
+
+    for (std::size_t i = 0; i < geoms.size(); i++) {
+        for (std::size_t j = i + 1; j < geoms.size(); j++) {
+            for (double densifyFrac : { 0.0, 0.1 }) {
+                PointPairDistance expected = bruteForceDistance(*geoms[i], *geoms[j], densifyFrac);
+                for (std::size_t numThreads : { 1u, 4u }) {
+                    DiscreteHausdorffDistance dhd(*geoms[i], *geoms[j]);
+                    if (densifyFrac > 0) {
+                        dhd.setDensifyFraction(densifyFrac);
+                    }
+                    dhd.setNumThreads(numThreads);
+                    ensure_equals(dhd.distance(), expected.getDistance());
+                    ensure(dhd.getCoordinates()[0].equals2D(expected.getCoordinate(0)));
+                    ensure(dhd.getCoordinates()[1].equals2D(expected.getCoordinate(1)));
+                }
+            }
+        }
+    }
+}
+
+// isWithinDistance
+template<>
+template<>
+void object::test<9>
+()
+{
+    std::mt19937 gen(42);
+    GeomPtr g1 = randomLine(gen, 2000);
+    GeomPtr g2 = randomLine(gen, 1500);
+
+    for (double densifyFrac : { 0.0, 0.25 }) {
+        DiscreteHausdorffDistance dhd(*g1, *g2);
+        if (densifyFrac > 0) {
+            dhd.setDensifyFraction(densifyFrac);
+        }
+        double d = dhd.distance();
+        for (std::size_t numThreads : { 1u, 3u }) {
+            dhd.setNumThreads(numThreads);
+            ensure(dhd.isWithinDistance(d));
+            ensure(dhd.isWithinDistance(d * 1.01));
+            ensure(! dhd.isWithinDistance(d * 0.99));
+        }
+    }
+
+    GeomPtr p1 = reader.read("LINESTRING (0 0, 10 0)");
+    GeomPtr p2 = reader.read("LINESTRING (0 1, 10 1, 10 4)");
+    ensure(DiscreteHausdorffDistance::isWithinDistance(*p1, *p2, 4));
+    ensure(! DiscreteHausdorffDistance::isWithinDistance(*p1, *p2, 3.9));
+}
+
+// isWithinDistance is false for empty inputs
+template<>
+template<>
+void object::test<10>
+()
+{
+    GeomPtr g1 = reader.read("LINESTRING EMPTY");
+    GeomPtr g2 = reader.read("LINESTRING (0 0, 1 1)");
+
+    ensure(! DiscreteHausdorffDistance::isWithinDistance(*g1, *g2, 10));
+    ensure(! DiscreteHausdorffDistance::isWithinDistance(*g2, *g1, 10));
+    ensure(DiscreteHausdorffDistance::isWithinDistance(*g2, *g2, 0));
+}
+
 } // namespace tut
 
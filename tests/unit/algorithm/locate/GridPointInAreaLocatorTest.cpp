@@ -0,0 +1,154 @@
+//
+// Test Suite for geos::algorithm::locate::GridPointInAreaLocator
+
+#include <tut/tut.hpp>
+// geos
+#include <geos/algorithm/locate/GridPointInAreaLocator.h>
+#include <geos/algorithm/locate/IndexedPointInAreaLocator.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/Point.h>
+#include <geos/io/WKTReader.h>
+// std
+#include <limits>
+#include <memory>
+#include <random>
+#include <string>
+
+using geos::algorithm::locate::GridPointInAreaLocator;
+using geos::algorithm::locate::IndexedPointInAreaLocator;
+using geos::geom::CoordinateSequence;
+using geos::geom::CoordinateXY;
+using geos::geom::Geometry;
+using geos::geom::Location;
+
+namespace tut {
+//
+// Test Group
+//
+
+struct test_gridpointinarealocator_data {
+    geos::geom::GeometryFactory::Ptr factory_;
+    geos::io::WKTReader reader_;
+
+    test_gridpointinarealocator_data()
+        : factory_(geos::geom::GeometryFactory::create())
+        , reader_(factory_.get())
+    {}
+
+    /*
+     * Checks that random points, the geometry vertices and the midpoints
+     * of its segments are located as by IndexedPointInAreaLocator.
+     */
+    static void
+    checkLocate(const Geometry& g, std::size_t numRandomPts)
+    {
+        GridPointInAreaLocator gridLocator(g);
+        IndexedPointInAreaLocator indexedLocator(g);
+
+        auto check = [&](const CoordinateXY& p) {
+            ensure_equals(gridLocator.locate(&p), indexedLocator.locate(&p));
+        };
+
+        auto pts = g.getCoordinates();
+        for (std::size_t i = 0; i < pts->size(); i++) {
+            const CoordinateXY& p = pts->getAt<CoordinateXY>(i);
+            check(p);
+            if (i > 0) {
+                const CoordinateXY& p0 = pts->getAt<CoordinateXY>(i - 1);
+                check(CoordinateXY((p0.x + p.x) / 2, (p0.y + p.y) / 2));
+            }
+        }
+
+        const geos::geom::Envelope& env = *g.getEnvelopeInternal();
+        if (env.isNull()) {
+            CoordinateXY origin(0, 0);
+            check(origin);
+            return;
+        }
+        std::mt19937 gen(1357);
+        std::uniform_real_distribution<double> x(env.getMinX() - 1, env.getMaxX() + 1);
+        std::uniform_real_distribution<double> y(env.getMinY() - 1, env.getMaxY() + 1);
+        for (std::size_t i = 0; i < numRandomPts; i++) {
+            check(CoordinateXY(x(gen), y(gen)));
+        }
+    }
+};
+
+typedef test_group<test_gridpointinarealocator_data> group;
+typedef group::object object;
+
+group test_gridpointinarealocator_group("geos::algorithm::locate::GridPointInAreaLocator");
+
+//
+// Test Cases
+//
+
+// Polygon with a hole
+template<>
+template<>
+void object::test<1>
+()
+{
+    auto g = reader_.read("POLYGON ((0 0, 100 0, 100 100, 0 100, 0 0), (20 20, 80 20, 50 80, 20 20))");
+    GridPointInAreaLocator locator(*g);
+
+    CoordinateXY interior(10, 10);
+    CoordinateXY hole(50, 40);
+    CoordinateXY boundary(50, 20);
+    CoordinateXY exterior(150, 50);
+    CoordinateXY nan(std::numeric_limits<double>::quiet_NaN(), 50);
+    ensure_equals(locator.locate(&interior), Location::INTERIOR);
+    ensure_equals(locator.locate(&hole), Location::EXTERIOR);
+    ensure_equals(locator.locate(&boundary), Location::BOUNDARY);
+    ensure_equals(locator.locate(&exterior), Location::EXTERIOR);
+    ensure_equals(locator.locate(&nan), Location::EXTERIOR);
+
+    checkLocate(*g, 5000);
+}
+
+// Vertices and edges on grid lines
+template<>
+template<>
+void object::test<2>
+()
+{
+    checkLocate(*reader_.read("POLYGON ((0 0, 16 0, 16 16, 0 16, 0 0), (4 4, 4 8, 8 8, 8 4, 4 4))"), 5000);
+    checkLocate(*reader_.read("MULTIPOLYGON (((0 0, 1 0, 1 1, 0 1, 0 0)), ((2 2, 3 2, 3 3, 2 3, 2 2)), ((1 1, 2 1, 2 2, 1 2, 1 1)))"), 5000);
+    checkLocate(*reader_.read("LINEARRING (0 0, 10 0, 10 1, 0 1, 0 0)"), 5000);
+}
+
+// Many-vertex polygons
+template<>
+template<>
+void object::test<3>
+()
+{
+    auto circle = factory_->createPoint(CoordinateXY(1e6, -3e6))->buffer(500, 2000);
+    checkLocate(*circle, 20000);
+
+    std::mt19937 gen(2468);
+    std::uniform_real_distribution<double> dist(0, 1000);
+    CoordinateSequence seq = CoordinateSequence::XY(0);
+    for (int i = 0; i < 500; i++) {
+        seq.add(CoordinateXY(dist(gen), dist(gen)));
+    }
+    seq.closeRing();
+    //-- a self-intersecting ring, located by the even-odd rule
+    auto poly = factory_->createPolygon(std::move(seq));
+    checkLocate(*poly, 20000);
+}
+
+// Empty and collapsed geometries
+template<>
+template<>
+void object::test<4>
+()
+{
+    checkLocate(*reader_.read("POLYGON EMPTY"), 100);
+    checkLocate(*reader_.read("POLYGON ((0 0, 10 0, 5 0, 0 0))"), 100);
+    checkLocate(*reader_.read("POLYGON ((0 0, 0 10, 0 5, 0 0))"), 100);
+}
+
+} // namespace tut
@@ -615,4 +615,43 @@ void object::test<24>
     ensure(result_ == nullptr);
 }
 
+// Buffer many geometries
+template<>
+template<>
+void object::test<25>
+()
+{
+    const char* wkts[] = {
+        "POINT (0 0)",
+        "POINT (10 5)",
+        "LINESTRING (0 0, 10 0)",
+        "POLYGON EMPTY"
+    };
+    GEOSGeometry* geoms[4];
+    GEOSGeometry* results[4];
+    for (int i = 0; i < 4; i++) {
+        geoms[i] = fromWKT(wkts[i]);
+        GEOSSetSRID(geoms[i], 4326);
+    }
+
+    bp_ = GEOSBufferParams_create();
+    GEOSBufferParams_setQuadrantSegments(bp_, 4);
+
+    ensure_equals(GEOSBufferMany(geoms, 4, bp_, 2.0, 2, results), 1);
+    for (int i = 0; i < 4; i++) {
+        GEOSGeometry* expected = GEOSBufferWithParams(geoms[i], bp_, 2.0);
+        ensure(results[i] != nullptr);
+        ensure_equals(GEOSEqualsExact(results[i], expected, 0), 1);
+        ensure_equals(GEOSGetSRID(results[i]), 4326);
+        GEOSGeom_destroy(expected);
+        GEOSGeom_destroy(results[i]);
+    }
+
+    ensure_equals(GEOSBufferMany(geoms, 4, bp_, std::numeric_limits<double>::infinity(), 1, results), 0);
+    for (int i = 0; i < 4; i++) {
+        ensure(results[i] == nullptr);
+        GEOSGeom_destroy(geoms[i]);
+    }
+}
+
 } // namespace tut
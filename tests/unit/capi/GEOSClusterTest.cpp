@@ -0,0 +1,118 @@
+//
+// Test Suite for C-API GEOSClusterDBSCAN and GEOSClusterWithinDistance
+
+#include <tut/tut.hpp>
+// geos
+#include <geos_c.h>
+// std
+#include <vector>
+
+#include "capi_test_utils.h"
+
+namespace tut {
+//
+// Test Group
+//
+
+// Common data used in test cases.
+struct test_capigeoscluster_data : public capitest::utility {
+    std::vector<GEOSGeometry*> geoms_;
+
+    ~test_capigeoscluster_data()
+    {
+        for (GEOSGeometry* g : geoms_) {
+            GEOSGeom_destroy(g);
+        }
+    }
+
+    void read(std::initializer_list<const char*> wkts)
+    {
+        for (const char* wkt : wkts) {
+            geoms_.push_back(fromWKT(wkt));
+        }
+    }
+
+    unsigned int size() const
+    {
+        return static_cast<unsigned int>(geoms_.size());
+    }
+};
+
+typedef test_group<test_capigeoscluster_data> group;
+typedef group::object object;
+
+group test_capigeoscluster_group("capi::GEOSCluster");
+
+//
+// Test Cases
+//
+
+// DBSCAN with noise
+template<>
+template<>
+void object::test<1>
+()
+{
+    read({
+        "POINT (0 0)",
+        "POINT (1 0)",
+        "POINT (2 0)",
+        "POINT (10 0)",
+        "POINT (11 0)",
+        "POINT (11 1)",
+        "POINT (50 50)"
+    });
+
+    std::vector<unsigned int> ids(geoms_.size());
+    int numClusters = GEOSClusterDBSCAN(geoms_.data(), size(), 1.01, 3, 1, ids.data());
+    ensure_equals(numClusters, 2);
+    ensure_equals(ids[0], ids[1]);
+    ensure_equals(ids[1], ids[2]);
+    ensure_equals(ids[3], ids[4]);
+    ensure_equals(ids[4], ids[5]);
+    ensure(ids[0] != ids[3]);
+    ensure(ids[0] < 2u && ids[3] < 2u);
+    ensure_equals(ids[6], GEOS_CLUSTER_NONE);
+
+    std::vector<unsigned int> parallelIds(geoms_.size());
+    ensure_equals(GEOSClusterDBSCAN(geoms_.data(), size(), 1.01, 3, 4, parallelIds.data()), 2);
+    ensure(parallelIds == ids);
+}
+
+// Distance clustering
+template<>
+template<>
+void object::test<2>
+()
+{
+    read({
+        "LINESTRING (0 0, 10 0)",
+        "POINT (5 1)",
+        "POLYGON ((20 0, 30 0, 30 10, 20 10, 20 0))",
+        "POINT (12 0)",
+        "POINT (100 100)"
+    });
+
+    std::vector<unsigned int> ids(geoms_.size());
+    for (unsigned int numThreads : { 1u, 0u }) {
+        int numClusters = GEOSClusterWithinDistance(geoms_.data(), size(), 2.0, numThreads, ids.data());
+        ensure_equals(numClusters, 3);
+        ensure_equals(ids[0], ids[1]);
+        ensure_equals(ids[0], ids[3]);
+        ensure(ids[2] != ids[0]);
+        ensure(ids[4] != ids[0]);
+        ensure(ids[4] != ids[2]);
+    }
+}
+
+// Empty input
+template<>
+template<>
+void object::test<3>
+()
+{
+    ensure_equals(GEOSClusterWithinDistance(nullptr, 0, 1.0, 1, nullptr), 0);
+    ensure_equals(GEOSClusterDBSCAN(nullptr, 0, 1.0, 2, 1, nullptr), 0);
+}
+
+} // namespace tut
@@ -766,4 +766,129 @@ void object::test<21>()
     GEOS_finish_r(handle);
 }
 
+static void
+countRelease(void* userdata)
+{
+    ++*static_cast<int*>(userdata);
+}
+
+// test 3D buffer used in place
+template<>
+template<>
+void object::test<22>()
+{
+    std::vector<double> values = { 0, 1, 2, 3, 4, 5, 6, 7, 8 };
+    int released = 0;
+
+    cs_ = GEOSCoordSeq_wrapBuffer(values.data(), 3, true, false, countRelease, &released);
+    ensure(cs_ != nullptr);
+
+    double x, y, z;
+    ensure(GEOSCoordSeq_getXYZ(cs_, 2, &x, &y, &z));
+    ensure_equals(x, 6.0);
+    ensure_equals(y, 7.0);
+    ensure_equals(z, 8.0);
+
+    // the buffer is still used by a geometry constructed from the sequence
+    geom1_ = GEOSGeom_createLineString(cs_);
+    cs_ = nullptr;
+    ensure_equals(released, 0);
+    ensure_equals(GEOSGeomGetLength(geom1_, &x), 1);
+
+    // coordinates are read from the buffer
+    values[6] = 100;
+    geom2_ = GEOSGeomGetEndPoint(geom1_);
+    ensure_equals(GEOSGeomGetX(geom2_, &x), 1);
+    ensure_equals(x, 100.0);
+
+    GEOSGeom_destroy(geom1_);
+    geom1_ = nullptr;
+    ensure_equals(released, 1);
+}
+
+// test modification of a sequence using a buffer
+template<>
+template<>
+void object::test<23>()
+{
+    std::vector<double> values = { 0, 1, 2, 3, 4, 5, 6, 7 };
+    int released = 0;
+
+    cs_ = GEOSCoordSeq_wrapBuffer(values.data(), 2, true, true, countRelease, &released);
+    ensure(cs_ != nullptr);
+
+    ensure(GEOSCoordSeq_setX(cs_, 0, 10));
+    ensure_equals(released, 1);
+    ensure_equals(values[0], 0.0);
+
+    double x, m;
+    ensure(GEOSCoordSeq_getX(cs_, 0, &x));
+    ensure_equals(x, 10.0);
+    ensure(GEOSCoordSeq_getOrdinate(cs_, 1, 3, &m));
+    ensure_equals(m, 7.0);
+
+    GEOSCoordSeq_destroy(cs_);
+    cs_ = nullptr;
+    ensure_equals(released, 1);
+}
+
+// test 2D buffer, which is copied
+template<>
+template<>
+void object::test<24>()
+{
+    std::vector<double> values = { 0, 1, 2, 3 };
+    int released = 0;
+
+    cs_ = GEOSCoordSeq_wrapBuffer(values.data(), 2, false, false, countRelease, &released);
+    ensure(cs_ != nullptr);
+    ensure_equals(released, 1);
+
+    values[2] = 100;
+    double x, y;
+    ensure(GEOSCoordSeq_getXY(cs_, 1, &x, &y));
+    ensure_equals(x, 2.0);
+    ensure_equals(y, 3.0);
+
+    unsigned int dim;
+    ensure(GEOSCoordSeq_getDimensions(cs_, &dim));
+    ensure_equals(dim, 2u);
+}
+
+// test operations on a geometry using a buffer
+template<>
+template<>
+void object::test<25>()
+{
+    std::vector<double> values = { 0, 0, 1, 10, 0, 2, 10, 10, 3, 0, 10, 4, 0, 0, 1 };
+    const std::vector<double> expected = values;
+
+    cs_ = GEOSCoordSeq_wrapBuffer(values.data(), 5, true, false, nullptr, nullptr);
+    ensure(cs_ != nullptr);
+    GEOSGeometry* shell = GEOSGeom_createLinearRing(cs_);
+    cs_ = nullptr;
+    geom1_ = GEOSGeom_createPolygon(shell, nullptr, 0);
+
+    ensure_equals(GEOSisValid(geom1_), 1);
+
+    geom2_ = fromWKT("POLYGON ((5 5, 15 5, 15 15, 5 15, 5 5))");
+    result_ = GEOSIntersection(geom1_, geom2_);
+    ensure_geometry_equals(result_, "POLYGON ((5 10, 10 10, 10 5, 5 5, 5 10))");
+    GEOSGeom_destroy(result_);
+
+    result_ = GEOSBuffer(geom1_, 1, 8);
+    ensure(result_ != nullptr);
+    GEOSGeom_destroy(result_);
+
+    result_ = GEOSGeom_setPrecision(geom1_, 5, 0);
+    ensure(result_ != nullptr);
+    GEOSGeom_destroy(result_);
+    result_ = nullptr;
+
+    ensure_equals(GEOSNormalize(geom1_), 0);
+    ensure_geometry_equals(geom1_, "POLYGON ((0 0, 0 10, 10 10, 10 0, 0 0))");
+
+    ensure(values == expected);
+}
+
 } // namespace tut
@@ -145,5 +145,90 @@ void object::test<6>
                       "MULTILINESTRING ((10 0, 10 10), (0 0, 10 10), (0 0, 10 0))");
 }
 
-} // namespace tut
+// Indexed output
+template<>
+template<>
+void object::test<7>
+()
+{
+    geom1_ = GEOSGeomFromWKT("MULTIPOINT ((10 10), (0 0), (10 0), (0 10), (4 6), (0 0))");
+
+    double* coords = nullptr;
+    unsigned int* tris = nullptr;
+    unsigned int numCoords = 0;
+    unsigned int numTris = 0;
+    ensure_equals(GEOSDelaunayTriangulationIndexed(geom1_, 0, &coords, &numCoords, &tris, &numTris), 1);
+
+    // unique sites, sorted by X and Y
+    ensure_equals(numCoords, 5u);
+    const double expectedCoords[] = { 0, 0, 0, 10, 4, 6, 10, 0, 10, 10 };
+    for (unsigned int i = 0; i < 2 * numCoords; i++) {
+        ensure_equals(coords[i], expectedCoords[i]);
+    }
+
+    ensure_equals(numTris, 4u);
+    for (unsigned int i = 0; i < numTris; i++) {
+        const double* p0 = coords + 2 * tris[3 * i];
+        const double* p1 = coords + 2 * tris[3 * i + 1];
+        const double* p2 = coords + 2 * tris[3 * i + 2];
+        // counter-clockwise
+        ensure_equals(GEOSOrientationIndex(p0[0], p0[1], p1[0], p1[1], p2[0], p2[1]), 1);
+        // each triangle has the interior site as a vertex
+        ensure(tris[3 * i] == 2 || tris[3 * i + 1] == 2 || tris[3 * i + 2] == 2);
+    }
+
+    GEOSFree(coords);
+    GEOSFree(tris);
+}
+
+// Indexed output for empty and degenerate inputs
+template<>
+template<>
+void object::test<8>
+()
+{
+    double* coords = nullptr;
+    unsigned int* tris = nullptr;
+    unsigned int numCoords = 99;
+    unsigned int numTris = 99;
 
+    geom1_ = GEOSGeomFromWKT("POLYGON EMPTY");
+    ensure_equals(GEOSDelaunayTriangulationIndexed(geom1_, 0, &coords, &numCoords, &tris, &numTris), 1);
+    ensure_equals(numCoords, 0u);
+    ensure_equals(numTris, 0u);
+    ensure(coords == nullptr);
+    ensure(tris == nullptr);
+
+    geom2_ = GEOSGeomFromWKT("LINESTRING (0 0, 1 1, 2 2)");
+    ensure_equals(GEOSDelaunayTriangulationIndexed(geom2_, 0, &coords, &numCoords, &tris, &numTris), 1);
+    ensure_equals(numCoords, 3u);
+    ensure_equals(numTris, 0u);
+    ensure(tris == nullptr);
+    GEOSFree(coords);
+}
+
+// Indexed output with a tolerance making one site collapse
+template<>
+template<>
+void object::test<9>
+()
+{
+    geom1_ = GEOSGeomFromWKT("MULTIPOINT((0 0), (10 0), (10 10), (11 10))");
+
+    double* coords = nullptr;
+    unsigned int* tris = nullptr;
+    unsigned int numCoords = 0;
+    unsigned int numTris = 0;
+    ensure_equals(GEOSDelaunayTriangulationIndexed(geom1_, 2, &coords, &numCoords, &tris, &numTris), 1);
+
+    ensure_equals(numCoords, 4u);
+    ensure_equals(numTris, 1u);
+    for (unsigned int i = 0; i < 3; i++) {
+        ensure(tris[i] < 3);
+    }
+
+    GEOSFree(coords);
+    GEOSFree(tris);
+}
+
+} // namespace tut
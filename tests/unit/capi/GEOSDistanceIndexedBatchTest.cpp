@@ -0,0 +1,93 @@
+//
+// Test Suite for C-API GEOSDistanceIndexedBatch
+
+#include <tut/tut.hpp>
+// geos
+#include <geos_c.h>
+// std
+#include <vector>
+
+#include "capi_test_utils.h"
+
+namespace tut {
+//
+// Test Group
+//
+
+// Common data used in test cases.
+struct test_capigeosdistanceindexedbatch_data : public capitest::utility {
+    std::vector<GEOSGeometry*> geoms_;
+
+    ~test_capigeosdistanceindexedbatch_data()
+    {
+        for (GEOSGeometry* g : geoms_) {
+            GEOSGeom_destroy(g);
+        }
+    }
+};
+
+typedef test_group<test_capigeosdistanceindexedbatch_data> group;
+typedef group::object object;
+
+group test_capigeosdistanceindexedbatch_group("capi::GEOSDistanceIndexedBatch");
+
+//
+// Test Cases
+//
+
+// Distances from a line network to points and lines
+template<>
+template<>
+void object::test<1>
+()
+{
+    geom1_ = fromWKT("MULTILINESTRING ((0 0, 10 0), (10 0, 10 10))");
+    geoms_.push_back(fromWKT("POINT (5 3)"));
+    geoms_.push_back(fromWKT("POINT (14 5)"));
+    geoms_.push_back(fromWKT("POINT (10 0)"));
+    geoms_.push_back(fromWKT("LINESTRING (0 20, 20 20)"));
+
+    std::vector<double> dists(geoms_.size());
+    int ret = GEOSDistanceIndexedBatch(geom1_, geoms_.data(),
+                                       static_cast<unsigned int>(geoms_.size()), 0, dists.data());
+    ensure_equals(ret, 1);
+    ensure_equals(dists[0], 3.0);
+    ensure_equals(dists[1], 4.0);
+    ensure_equals(dists[2], 0.0);
+    ensure_equals(dists[3], 10.0);
+
+    for (std::size_t i = 0; i < geoms_.size(); i++) {
+        double dist;
+        ensure_equals(GEOSDistanceIndexed(geom1_, geoms_[i], &dist), 1);
+        ensure_equals(dists[i], dist);
+    }
+}
+
+// No geometries
+template<>
+template<>
+void object::test<2>
+()
+{
+    geom1_ = fromWKT("LINESTRING (0 0, 10 0)");
+
+    ensure_equals(GEOSDistanceIndexedBatch(geom1_, nullptr, 0, 1, nullptr), 1);
+}
+
+// Empty geometry
+template<>
+template<>
+void object::test<3>
+()
+{
+    geom1_ = fromWKT("LINESTRING (0 0, 10 0)");
+    geoms_.push_back(fromWKT("POINT (5 3)"));
+    geoms_.push_back(fromWKT("POINT EMPTY"));
+
+    std::vector<double> dists(geoms_.size());
+    int ret = GEOSDistanceIndexedBatch(geom1_, geoms_.data(),
+                                       static_cast<unsigned int>(geoms_.size()), 2, dists.data());
+    ensure_equals(ret, 0);
+}
+
+} // namespace tut
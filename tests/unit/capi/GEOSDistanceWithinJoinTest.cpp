@@ -0,0 +1,124 @@
+//
+// Test Suite for C-API GEOSDistanceWithinJoin
+
+#include <tut/tut.hpp>
+// geos
+#include <geos_c.h>
+// std
+#include <utility>
+#include <vector>
+
+#include "capi_test_utils.h"
+
+namespace tut {
+//
+// Test Group
+//
+
+// Common data used in test cases.
+struct test_capigeosdistancewithinjoin_data : public capitest::utility {
+    typedef std::vector<std::pair<unsigned int, unsigned int>> PairList;
+
+    std::vector<GEOSGeometry*> geomsA_;
+    std::vector<GEOSGeometry*> geomsB_;
+
+    ~test_capigeosdistancewithinjoin_data()
+    {
+        for (GEOSGeometry* g : geomsA_) {
+            GEOSGeom_destroy(g);
+        }
+        for (GEOSGeometry* g : geomsB_) {
+            GEOSGeom_destroy(g);
+        }
+    }
+
+    static void
+    collect(unsigned int indexA, unsigned int indexB, void* userdata)
+    {
+        static_cast<PairList*>(userdata)->emplace_back(indexA, indexB);
+    }
+};
+
+typedef test_group<test_capigeosdistancewithinjoin_data> group;
+typedef group::object object;
+
+group test_capigeosdistancewithinjoin_group("capi::GEOSDistanceWithinJoin");
+
+//
+// Test Cases
+//
+
+// Points against lines and polygons
+template<>
+template<>
+void object::test<1>
+()
+{
+    geomsA_.push_back(fromWKT("POINT (5 3)"));
+    geomsA_.push_back(fromWKT("POINT (50 50)"));
+    geomsA_.push_back(fromWKT("POINT (12 5)"));
+    geomsB_.push_back(fromWKT("LINESTRING (0 0, 10 0, 10 10)"));
+    geomsB_.push_back(fromWKT("POLYGON ((20 20, 80 20, 80 80, 20 80, 20 20))"));
+    geomsB_.push_back(fromWKT("POINT (5 5)"));
+
+    for (unsigned int numThreads : { 1u, 0u }) {
+        PairList pairs;
+        int ret = GEOSDistanceWithinJoin(geomsA_.data(), static_cast<unsigned int>(geomsA_.size()),
+                                         geomsB_.data(), static_cast<unsigned int>(geomsB_.size()),
+                                         2, numThreads, collect, &pairs);
+        ensure_equals(ret, 1);
+
+        PairList expected { { 0, 2 }, { 1, 1 }, { 2, 0 } };
+        ensure(pairs == expected);
+    }
+}
+
+// Results match GEOSDistanceWithin for every pair
+template<>
+template<>
+void object::test<2>
+()
+{
+    for (int i = 0; i < 20; i++) {
+        for (int j = 0; j < 20; j++) {
+            geomsA_.push_back(GEOSGeom_createPointFromXY(i * 5, j * 5));
+        }
+    }
+    geomsB_.push_back(fromWKT("LINESTRING (0 0, 40 60, 90 10)"));
+    geomsB_.push_back(fromWKT("POLYGON ((30 30, 70 30, 70 70, 30 70, 30 30), (40 40, 60 40, 60 60, 40 60, 40 40))"));
+    geomsB_.push_back(fromWKT("MULTIPOINT ((12 12), (77 3))"));
+    geomsB_.push_back(fromWKT("POINT EMPTY"));
+
+    PairList pairs;
+    int ret = GEOSDistanceWithinJoin(geomsA_.data(), static_cast<unsigned int>(geomsA_.size()),
+                                     geomsB_.data(), static_cast<unsigned int>(geomsB_.size()),
+                                     3.5, 4, collect, &pairs);
+    ensure_equals(ret, 1);
+
+    PairList expected;
+    for (unsigned int i = 0; i < geomsA_.size(); i++) {
+        for (unsigned int j = 0; j < geomsB_.size(); j++) {
+            if (GEOSDistanceWithin(geomsA_[i], geomsB_[j], 3.5) == 1) {
+                expected.emplace_back(i, j);
+            }
+        }
+    }
+    ensure(! expected.empty());
+    ensure(pairs == expected);
+}
+
+// Empty inputs produce no pairs
+template<>
+template<>
+void object::test<3>
+()
+{
+    geomsB_.push_back(fromWKT("POINT (0 0)"));
+
+    PairList pairs;
+    int ret = GEOSDistanceWithinJoin(nullptr, 0, geomsB_.data(), 1, 1, 1, collect, &pairs);
+    ensure_equals(ret, 1);
+    ensure(pairs.empty());
+}
+
+} // namespace tut
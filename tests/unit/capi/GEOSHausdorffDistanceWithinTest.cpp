@@ -0,0 +1,75 @@
+//
+// Test Suite for C-API GEOSHausdorffDistanceWithin
+
+#include <tut/tut.hpp>
+// geos
+#include <geos_c.h>
+
+#include "capi_test_utils.h"
+
+namespace tut {
+//
+// Test Group
+//
+
+// Common data used in test cases.
+struct test_capigeoshausdorffdistancewithin_data : public capitest::utility {
+};
+
+typedef test_group<test_capigeoshausdorffdistancewithin_data> group;
+typedef group::object object;
+
+group test_capigeoshausdorffdistancewithin_group("capi::GEOSHausdorffDistanceWithin");
+
+//
+// Test Cases
+//
+
+// Vertices only
+template<>
+template<>
+void object::test<1>
+()
+{
+    geom1_ = GEOSGeomFromWKT("LINESTRING (130 0, 0 0, 0 150)");
+    geom2_ = GEOSGeomFromWKT("LINESTRING (10 10, 10 150, 130 10)");
+
+    double dist;
+    ensure_equals(GEOSHausdorffDistance(geom1_, geom2_, &dist), 1);
+
+    ensure_equals(GEOSHausdorffDistanceWithin(geom1_, geom2_, 0, dist), 1);
+    ensure_equals(GEOSHausdorffDistanceWithin(geom1_, geom2_, 0, dist - 0.01), 0);
+}
+
+// Densified
+template<>
+template<>
+void object::test<2>
+()
+{
+    geom1_ = GEOSGeomFromWKT("LINESTRING (0 0, 100 0, 10 100, 10 100)");
+    geom2_ = GEOSGeomFromWKT("LINESTRING (0 100, 0 10, 80 10)");
+
+    double dist;
+    ensure_equals(GEOSHausdorffDistanceDensify(geom1_, geom2_, 0.01, &dist), 1);
+
+    ensure_equals(GEOSHausdorffDistanceWithin(geom1_, geom2_, 0.01, dist), 1);
+    ensure_equals(GEOSHausdorffDistanceWithin(geom1_, geom2_, 0.01, dist - 0.01), 0);
+    //-- the vertices alone are closer
+    ensure_equals(GEOSHausdorffDistanceWithin(geom1_, geom2_, 0, dist - 0.01), 1);
+}
+
+// Empty input and invalid fraction
+template<>
+template<>
+void object::test<3>
+()
+{
+    geom1_ = GEOSGeomFromWKT("LINESTRING EMPTY");
+    geom2_ = GEOSGeomFromWKT("LINESTRING (0 0, 1 1)");
+
+    ensure_equals(GEOSHausdorffDistanceWithin(geom1_, geom2_, 0, 100), 0);
+    ensure_equals(GEOSHausdorffDistanceWithin(geom2_, geom2_, 2, 100), 2);
+}
+
+} // namespace tut
@@ -0,0 +1,83 @@
+//
+// Test Suite for C-API GEOSMaximumInscribedCircleBatch
+
+#include <tut/tut.hpp>
+// geos
+#include <geos_c.h>
+// std
+#include <vector>
+
+#include "capi_test_utils.h"
+
+namespace tut {
+//
+// Test Group
+//
+
+// Common data used in test cases.
+struct test_capimaximuminscribedcirclebatch_data : public capitest::utility {
+    std::vector<GEOSGeometry*> geoms_;
+    std::vector<GEOSGeometry*> lines_;
+
+    ~test_capimaximuminscribedcirclebatch_data()
+    {
+        for (GEOSGeometry* g : geoms_) {
+            GEOSGeom_destroy(g);
+        }
+        for (GEOSGeometry* g : lines_) {
+            if (g) {
+                GEOSGeom_destroy(g);
+            }
+        }
+    }
+};
+
+typedef test_group<test_capimaximuminscribedcirclebatch_data> group;
+typedef group::object object;
+
+group test_capimaximuminscribedcirclebatch_group("capi::GEOSMaximumInscribedCircleBatch");
+
+//
+// Test Cases
+//
+
+template<>
+template<>
+void object::test<1>
+()
+{
+    geoms_.push_back(fromWKT("POLYGON ((100 200, 200 200, 200 100, 100 100, 100 200))"));
+    geoms_.push_back(fromWKT("POLYGON EMPTY"));
+    geoms_.push_back(fromWKT("POLYGON ((150 250, 50 150, 150 50, 250 150, 150 250))"));
+    GEOSSetSRID(geoms_[2], 4326);
+    lines_.resize(geoms_.size());
+
+    int ret = GEOSMaximumInscribedCircleBatch(geoms_.data(), static_cast<unsigned int>(geoms_.size()),
+                                              0.001, 2, lines_.data());
+    ensure_equals(ret, 1);
+
+    ensure(lines_[1] == nullptr);
+    for (std::size_t i : { 0u, 2u }) {
+        GEOSGeometry* expected = GEOSMaximumInscribedCircle(geoms_[i], 0.001);
+        ensure_geometry_equals(lines_[i], expected);
+        GEOSGeom_destroy(expected);
+    }
+    ensure_equals(GEOSGetSRID(lines_[2]), 4326);
+}
+
+// Non-polygonal input
+template<>
+template<>
+void object::test<2>
+()
+{
+    geoms_.push_back(fromWKT("POLYGON ((100 200, 200 200, 200 100, 100 100, 100 200))"));
+    geoms_.push_back(fromWKT("LINESTRING (0 0, 1 1)"));
+    lines_.resize(geoms_.size());
+
+    int ret = GEOSMaximumInscribedCircleBatch(geoms_.data(), static_cast<unsigned int>(geoms_.size()),
+                                              0.001, 1, lines_.data());
+    ensure_equals(ret, 0);
+}
+
+} // namespace tut
@@ -0,0 +1,190 @@
+//
+// Test Suite for C-API GEOSPreparedRelate and GEOSPreparedRelatePattern
+
+#include <tut/tut.hpp>
+// geos
+#include <geos_c.h>
+// std
+#include <cstdlib>
+#include <string>
+
+#include "capi_test_utils.h"
+
+namespace tut {
+//
+// Test Group
+//
+
+// Common data used in test cases.
+struct test_capigeospreparedrelate_data : public capitest::utility {
+    const GEOSPreparedGeometry* pgeom1_;
+
+    test_capigeospreparedrelate_data()
+        : pgeom1_(nullptr)
+    {}
+
+    ~test_capigeospreparedrelate_data()
+    {
+        GEOSPreparedGeom_destroy(pgeom1_);
+    }
+
+    void prepare(const char* wkt1, const char* wkt2)
+    {
+        geom1_ = fromWKT(wkt1);
+        ensure(nullptr != geom1_);
+        pgeom1_ = GEOSPrepare(geom1_);
+        ensure(nullptr != pgeom1_);
+        geom2_ = fromWKT(wkt2);
+        ensure(nullptr != geom2_);
+    }
+
+    void checkRelate(const char* wkt1, const char* wkt2)
+    {
+        prepare(wkt1, wkt2);
+
+        char* expected = GEOSRelate(geom1_, geom2_);
+        char* actual = GEOSPreparedRelate(pgeom1_, geom2_);
+        ensure(nullptr != actual);
+        ensure_equals(std::string(actual), std::string(expected));
+        GEOSFree(expected);
+        GEOSFree(actual);
+    }
+};
+
+typedef test_group<test_capigeospreparedrelate_data> group;
+typedef group::object object;
+
+group test_capigeospreparedrelate_group("capi::GEOSPreparedRelate");
+
+//
+// Test Cases
+//
+
+// Polygon / overlapping polygon
+template<>
+template<>
+void object::test<1>
+()
+{
+    checkRelate(
+        "POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))",
+        "POLYGON ((5 5, 15 5, 15 15, 5 15, 5 5))");
+}
+
+// Polygon / line crossing hole
+template<>
+template<>
+void object::test<2>
+()
+{
+    checkRelate(
+        "POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0), (2 2, 8 2, 8 8, 2 8, 2 2))",
+        "LINESTRING (-1 5, 11 5)");
+}
+
+// Point on polygon boundary
+template<>
+template<>
+void object::test<3>
+()
+{
+    checkRelate(
+        "POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))",
+        "POINT (10 5)");
+}
+
+// Prepared geometry is reused for several relates
+template<>
+template<>
+void object::test<4>
+()
+{
+    prepare("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))",
+            "POINT (5 5)");
+
+    char* im = GEOSPreparedRelate(pgeom1_, geom2_);
+    ensure_equals(std::string(im), std::string("0F2FF1FF2"));
+    GEOSFree(im);
+
+    GEOSGeometry* line = fromWKT("LINESTRING (5 5, 20 5)");
+    im = GEOSPreparedRelate(pgeom1_, line);
+    ensure_equals(std::string(im), std::string("1020F1102"));
+    GEOSFree(im);
+    GEOSGeom_destroy(line);
+}
+
+// Pattern matching
+template<>
+template<>
+void object::test<5>
+()
+{
+    prepare("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))",
+            "LINESTRING (1 1, 9 9)");
+
+    ensure_equals(GEOSPreparedRelatePattern(pgeom1_, geom2_, "T*****FF*"), 1);
+    ensure_equals(GEOSPreparedRelatePattern(pgeom1_, geom2_, "FF*FF****"), 0);
+    ensure_equals(GEOSPreparedRelatePattern(pgeom1_, geom2_, "1FF0FF212"), 0);
+    ensure_equals(GEOSPreparedRelatePattern(pgeom1_, geom2_, "1020F1102"), 0);
+    ensure_equals(GEOSPreparedRelatePattern(pgeom1_, geom2_, "102FF1FF2"), 1);
+}
+
+// Invalid pattern
+template<>
+template<>
+void object::test<6>
+()
+{
+    prepare("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))",
+            "POINT (5 5)");
+
+    ensure_equals(GEOSPreparedRelatePattern(pgeom1_, geom2_, "T**"), 2);
+}
+
+// Empty inputs
+template<>
+template<>
+void object::test<7>
+()
+{
+    checkRelate("POLYGON EMPTY", "POINT (1 1)");
+    ensure_equals(GEOSPreparedRelatePattern(pgeom1_, geom2_, "FF*FF****"), 1);
+}
+
+// Prepared pattern matching agrees with GEOSRelatePattern
+// for a range of targets
+template<>
+template<>
+void object::test<8>
+()
+{
+    prepare("POLYGON ((0 0, 100 0, 100 100, 0 100, 0 0), (40 40, 60 40, 60 60, 40 60, 40 40))",
+            "POINT (0 0)");
+
+    const char* targets[] = {
+        "POINT (50 50)",
+        "POINT (10 10)",
+        "POINT (40 50)",
+        "LINESTRING (40 40, 60 40)",
+        "LINESTRING (-10 50, 110 50)",
+        "LINESTRING (200 200, 300 300)",
+        "POLYGON ((40 40, 60 40, 60 60, 40 60, 40 40))",
+        "POLYGON ((90 90, 110 90, 110 110, 90 110, 90 90))",
+        "GEOMETRYCOLLECTION (POINT (50 50), LINESTRING (0 0, 0 100))"
+    };
+    const char* patterns[] = {
+        "F***T****", "T*****FF*", "FF*FF****", "F***1****", "****T****", "*T*******", "T*T******", "2********"
+    };
+
+    for (const char* wkt : targets) {
+        GEOSGeometry* g = fromWKT(wkt);
+        for (const char* pattern : patterns) {
+            char expected = GEOSRelatePattern(geom1_, g, pattern);
+            char actual = GEOSPreparedRelatePattern(pgeom1_, g, pattern);
+            ensure_equals(std::string(wkt) + " " + pattern, actual, expected);
+        }
+        GEOSGeom_destroy(g);
+    }
+}
+
+} // namespace tut
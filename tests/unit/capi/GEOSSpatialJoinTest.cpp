@@ -0,0 +1,158 @@
+//
+// Test Suite for C-API GEOSSpatialJoin and GEOSSpatialJoinPairs
+
+#include <tut/tut.hpp>
+// geos
+#include <geos_c.h>
+// std
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "capi_test_utils.h"
+
+namespace tut {
+//
+// Test Group
+//
+
+// Common data used in test cases.
+struct test_capigeosspatialjoin_data : public capitest::utility {
+    typedef std::vector<std::pair<unsigned int, unsigned int>> PairList;
+
+    std::vector<GEOSGeometry*> geomsA_;
+    std::vector<GEOSGeometry*> geomsB_;
+
+    ~test_capigeosspatialjoin_data()
+    {
+        for (GEOSGeometry* g : geomsA_) {
+            GEOSGeom_destroy(g);
+        }
+        for (GEOSGeometry* g : geomsB_) {
+            GEOSGeom_destroy(g);
+        }
+    }
+
+    static void
+    collect(unsigned int indexA, unsigned int indexB, void* userdata)
+    {
+        static_cast<PairList*>(userdata)->emplace_back(indexA, indexB);
+    }
+
+    void
+    setUp()
+    {
+        geomsA_.push_back(fromWKT("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))"));
+        geomsA_.push_back(fromWKT("POLYGON ((10 0, 20 0, 20 10, 10 10, 10 0))"));
+        geomsB_.push_back(fromWKT("POINT (5 5)"));
+        geomsB_.push_back(fromWKT("POINT (10 5)"));
+        geomsB_.push_back(fromWKT("POINT (25 5)"));
+        geomsB_.push_back(fromWKT("LINESTRING (8 8, 12 8)"));
+    }
+
+    PairList
+    joinPairs(int predicate, double dist)
+    {
+        unsigned int* indexesA = nullptr;
+        unsigned int* indexesB = nullptr;
+        unsigned int npairs = 0;
+        int ret = GEOSSpatialJoinPairs(geomsA_.data(), static_cast<unsigned int>(geomsA_.size()),
+                                       geomsB_.data(), static_cast<unsigned int>(geomsB_.size()),
+                                       predicate, dist, 2, &indexesA, &indexesB, &npairs);
+        ensure_equals(ret, 1);
+
+        PairList pairs;
+        for (unsigned int k = 0; k < npairs; k++) {
+            pairs.emplace_back(indexesA[k], indexesB[k]);
+        }
+        GEOSFree(indexesA);
+        GEOSFree(indexesB);
+        return pairs;
+    }
+};
+
+typedef test_group<test_capigeosspatialjoin_data> group;
+typedef group::object object;
+
+group test_capigeosspatialjoin_group("capi::GEOSSpatialJoin");
+
+//
+// Test Cases
+//
+
+// Callback join
+template<>
+template<>
+void object::test<1>
+()
+{
+    setUp();
+
+    PairList pairs;
+    int ret = GEOSSpatialJoin(geomsA_.data(), static_cast<unsigned int>(geomsA_.size()),
+                              geomsB_.data(), static_cast<unsigned int>(geomsB_.size()),
+                              GEOS_JOIN_INTERSECTS, 0, 0, collect, &pairs);
+    ensure_equals(ret, 1);
+
+    std::sort(pairs.begin(), pairs.end());
+    PairList expected { { 0, 0 }, { 0, 1 }, { 0, 3 }, { 1, 1 }, { 1, 3 } };
+    ensure(pairs == expected);
+}
+
+// Array output for each predicate
+template<>
+template<>
+void object::test<2>
+()
+{
+    setUp();
+
+    PairList contains { { 0, 0 } };
+    ensure(joinPairs(GEOS_JOIN_CONTAINS, 0) == contains);
+
+    PairList covers { { 0, 0 }, { 0, 1 }, { 1, 1 } };
+    ensure(joinPairs(GEOS_JOIN_COVERS, 0) == covers);
+
+    ensure(joinPairs(GEOS_JOIN_WITHIN, 0).empty());
+    ensure(joinPairs(GEOS_JOIN_COVEREDBY, 0).empty());
+
+    PairList dwithin { { 0, 0 }, { 0, 1 }, { 0, 3 }, { 1, 0 }, { 1, 1 }, { 1, 2 }, { 1, 3 } };
+    ensure(joinPairs(GEOS_JOIN_DWITHIN, 5) == dwithin);
+}
+
+// Empty result
+template<>
+template<>
+void object::test<3>
+()
+{
+    geomsA_.push_back(fromWKT("POINT (0 0)"));
+    geomsB_.push_back(fromWKT("POINT (1 1)"));
+
+    unsigned int* indexesA = nullptr;
+    unsigned int* indexesB = nullptr;
+    unsigned int npairs = 1;
+    int ret = GEOSSpatialJoinPairs(geomsA_.data(), 1, geomsB_.data(), 1, GEOS_JOIN_INTERSECTS, 0, 1,
+                                   &indexesA, &indexesB, &npairs);
+    ensure_equals(ret, 1);
+    ensure_equals(npairs, 0u);
+    ensure(indexesA == nullptr);
+    ensure(indexesB == nullptr);
+}
+
+// Invalid predicate
+template<>
+template<>
+void object::test<4>
+()
+{
+    setUp();
+
+    PairList pairs;
+    int ret = GEOSSpatialJoin(geomsA_.data(), static_cast<unsigned int>(geomsA_.size()),
+                              geomsB_.data(), static_cast<unsigned int>(geomsB_.size()),
+                              99, 0, 1, collect, &pairs);
+    ensure_equals(ret, 0);
+}
+
+} // namespace tut
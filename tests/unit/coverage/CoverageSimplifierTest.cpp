@@ -6,8 +6,16 @@
 
 // geos
 #include <geos/coverage/CoverageSimplifier.h>
+#include <geos/coverage/CoverageUnion.h>
+#include <geos/coverage/CoverageValidator.h>
+
+// std
+#include <cmath>
+#include <iomanip>
 
 using geos::coverage::CoverageSimplifier;
+using geos::coverage::CoverageUnion;
+using geos::coverage::CoverageValidator;
 
 namespace tut {
 //
@@ -69,6 +77,88 @@ struct test_coveragesimplifier_data {
         return geometries;
     }
 
+    /**
+     * Creates a coverage of n x n cells with wiggly shared edges.
+     */
+    std::vector<std::unique_ptr<Geometry>>
+    createWigglyGrid(int n)
+    {
+        const int segs = 8;
+        auto hEdge = [&](int i, int j, std::ostringstream& os, bool reverse) {
+            for (int t = 0; t < segs; t++) {
+                int k = reverse ? segs - t : t;
+                double x = i + double(k) / segs;
+                double y = j + ((k == 0 || k == segs) ? 0 : 0.02 * std::sin(x * 7 + j * 3));
+                os << x << " " << y << ", ";
+            }
+        };
+        auto vEdge = [&](int i, int j, std::ostringstream& os, bool reverse) {
+            for (int t = 0; t < segs; t++) {
+                int k = reverse ? segs - t : t;
+                double y = j + double(k) / segs;
+                double x = i + ((k == 0 || k == segs) ? 0 : 0.02 * std::cos(y * 5 + i * 3));
+                os << x << " " << y << ", ";
+            }
+        };
+        std::vector<std::unique_ptr<Geometry>> geoms;
+        for (int i = 0; i < n; i++) {
+            for (int j = 0; j < n; j++) {
+                std::ostringstream os;
+                os << std::setprecision(17) << "POLYGON ((";
+                hEdge(i, j, os, false);
+                vEdge(i + 1, j, os, false);
+                hEdge(i, j + 1, os, true);
+                vEdge(i, j, os, true);
+                os << i << " " << j << "))";
+                geoms.push_back(r.read(os.str()));
+            }
+        }
+        return geoms;
+    }
+
+    static std::size_t
+    numPoints(const std::vector<std::unique_ptr<Geometry>>& geoms)
+    {
+        std::size_t n = 0;
+        for (const auto& g : geoms) {
+            n += g->getNumPoints();
+        }
+        return n;
+    }
+
+    void
+    checkParallel(const std::vector<std::unique_ptr<Geometry>>& input,
+                  double tolerance, bool isInner)
+    {
+        std::vector<const Geometry*> coverage;
+        for (const auto& g : input) {
+            coverage.push_back(g.get());
+        }
+        std::vector<std::unique_ptr<Geometry>> first;
+        for (std::size_t numThreads : { 2u, 3u, 8u }) {
+            CoverageSimplifier simplifier(coverage);
+            simplifier.setNumThreads(numThreads);
+            std::vector<std::unique_ptr<Geometry>> actual = isInner
+                ? simplifier.simplifyInner(tolerance)
+                : simplifier.simplify(tolerance);
+
+            ensure_equals(actual.size(), input.size());
+            ensure(numPoints(actual) < numPoints(input));
+            std::vector<const Geometry*> actualCoverage;
+            for (const auto& g : actual) {
+                ensure(g->isValid());
+                actualCoverage.push_back(g.get());
+            }
+            ensure(CoverageValidator::isValid(actualCoverage));
+
+            //-- result does not depend on the number of threads
+            if (first.empty())
+                first = std::move(actual);
+            else
+                checkArrayEqual(first, actual);
+        }
+    }
+
     void
     checkArrayEqual(
         const std::vector<std::unique_ptr<Geometry>>& input,
@@ -463,4 +553,51 @@ void object::test<26> ()
     );
   }
 
+// Multi-threaded simplification produces a valid, deterministic coverage
+template<>
+template<>
+void object::test<27> ()
+{
+    checkParallel(createWigglyGrid(8), 0.1, false);
+}
+
+// Multi-threaded inner simplification preserves the outer boundary
+template<>
+template<>
+void object::test<28> ()
+{
+    auto input = createWigglyGrid(8);
+    checkParallel(input, 0.1, true);
+
+    std::vector<const Geometry*> coverage;
+    for (const auto& g : input) {
+        coverage.push_back(g.get());
+    }
+    CoverageSimplifier simplifier(coverage);
+    simplifier.setNumThreads(4);
+    auto actual = simplifier.simplifyInner(0.1);
+    std::vector<const Geometry*> actualCoverage;
+    for (const auto& g : actual) {
+        actualCoverage.push_back(g.get());
+    }
+    auto expectedUnion = CoverageUnion::Union(coverage);
+    auto actualUnion = CoverageUnion::Union(actualCoverage);
+    ensure(actualUnion->equalsExact(expectedUnion.get()));
+}
+
+// Multi-threaded simplification with zero tolerance is a no-op
+template<>
+template<>
+void object::test<29> ()
+{
+    auto input = createWigglyGrid(4);
+    std::vector<const Geometry*> coverage;
+    for (const auto& g : input) {
+        coverage.push_back(g.get());
+    }
+    CoverageSimplifier simplifier(coverage);
+    simplifier.setNumThreads(4);
+    checkArrayEqual(input, simplifier.simplify(0));
+}
+
 } // namespace tut
@@ -0,0 +1,105 @@
+//
+// Test Suite for geos::coverage::CoverageUnion class.
+
+#include <tut/tut.hpp>
+#include <utility.h>
+
+// geos
+#include <geos/coverage/CoverageUnion.h>
+
+using geos::coverage::CoverageUnion;
+
+namespace tut {
+//
+// Test Group
+//
+
+// Common data used by all tests
+struct test_coverageunion_data {
+
+    WKTReader r;
+
+    /**
+     * Creates a coverage of nx x ny square cells,
+     * omitting some cells to create holes and separate components.
+     */
+    std::vector<std::unique_ptr<Geometry>>
+    createGrid(int nx, int ny)
+    {
+        std::vector<std::unique_ptr<Geometry>> geoms;
+        for (int i = 0; i < nx; i++) {
+            for (int j = 0; j < ny; j++) {
+                if ((i % 5 == 2 && j % 4 == 1) || i == nx / 2)
+                    continue;
+                std::ostringstream wkt;
+                wkt << "POLYGON ((" << i << " " << j << ", " << i + 1 << " " << j << ", "
+                    << i + 1 << " " << j + 1 << ", " << i << " " << j + 1 << ", "
+                    << i << " " << j << "))";
+                geoms.push_back(r.read(wkt.str()));
+            }
+        }
+        return geoms;
+    }
+
+    void
+    checkParallel(const std::vector<std::unique_ptr<Geometry>>& geoms)
+    {
+        std::vector<const Geometry*> coverage;
+        for (const auto& g : geoms) {
+            coverage.push_back(g.get());
+        }
+        std::unique_ptr<Geometry> expected = CoverageUnion::Union(coverage);
+        for (std::size_t numThreads : { 1u, 2u, 3u, 8u }) {
+            std::unique_ptr<Geometry> actual = CoverageUnion::Union(coverage, numThreads);
+            ensure(actual->isValid());
+            ensure_equals_geometry(expected.get(), actual.get());
+        }
+    }
+};
+
+typedef test_group<test_coverageunion_data> group;
+typedef group::object object;
+
+group test_coverageunion_group("geos::coverage::CoverageUnion");
+
+//
+// Test Cases
+//
+
+// Multi-threaded union matches single-threaded union
+template<>
+template<>
+void object::test<1> ()
+{
+    checkParallel(createGrid(20, 20));
+}
+
+// Small coverages are unioned directly
+template<>
+template<>
+void object::test<2> ()
+{
+    checkParallel(createGrid(4, 3));
+}
+
+// Collection input
+template<>
+template<>
+void object::test<3> ()
+{
+    auto geoms = createGrid(16, 16);
+    std::vector<const Geometry*> coverage;
+    for (const auto& g : geoms) {
+        coverage.push_back(g.get());
+    }
+    auto col = geoms[0]->getFactory()->createGeometryCollection(coverage);
+    std::unique_ptr<Geometry> expected = CoverageUnion::Union(col.get());
+    std::unique_ptr<Geometry> actual = CoverageUnion::Union(col.get(), 4);
+    ensure_equals_geometry(expected.get(), actual.get());
+
+    auto empty = geoms[0]->getFactory()->createGeometryCollection();
+    ensure_equals_geometry(CoverageUnion::Union(empty.get()).get(),
+                           CoverageUnion::Union(empty.get(), 4).get());
+}
+
+} // namespace tut
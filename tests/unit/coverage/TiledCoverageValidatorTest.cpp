@@ -0,0 +1,242 @@
+//
+// Test Suite for geos::coverage::TiledCoverageValidator class.
+
+#include <tut/tut.hpp>
+#include <utility.h>
+
+// geos
+#include <geos/coverage/CoverageValidator.h>
+#include <geos/coverage/TiledCoverageValidator.h>
+
+// std
+#include <map>
+
+using geos::coverage::CoverageValidator;
+using geos::coverage::TiledCoverageValidator;
+using geos::geom::Envelope;
+
+namespace tut {
+//
+// Test Group
+//
+
+// Common data used by all tests
+struct test_tiledcoveragevalidator_data {
+
+    WKTReader r;
+
+    std::vector<std::unique_ptr<Geometry>>
+    readList(const std::vector<std::string> &wkt_geoms)
+    {
+        std::vector<std::unique_ptr<Geometry>> geoms;
+        for (const auto& wkt : wkt_geoms) {
+            geoms.push_back(r.read(wkt));
+        }
+        return geoms;
+    }
+
+    std::vector<const Geometry*>
+    toCoverage(const std::vector<std::unique_ptr<Geometry>> &geoms)
+    {
+        std::vector<const Geometry*> coverage;
+        for (const auto& geom : geoms) {
+            coverage.push_back(geom.get());
+        }
+        return coverage;
+    }
+
+    /**
+     * Creates a grid of square cells, with some cells perturbed
+     * so that they overlap or leave narrow gaps.
+     */
+    std::vector<std::unique_ptr<Geometry>>
+    createGrid(int nx, int ny)
+    {
+        std::vector<std::unique_ptr<Geometry>> geoms;
+        for (int i = 0; i < nx; i++) {
+            for (int j = 0; j < ny; j++) {
+                double x0 = i * 10;
+                double y0 = j * 10;
+                double x1 = x0 + 10;
+                double y1 = y0 + 10;
+                int k = i * ny + j;
+                if (k % 7 == 3) x1 += 0.5;  // overlap
+                if (k % 11 == 5) y1 -= 0.5; // gap
+                std::ostringstream wkt;
+                wkt << "POLYGON ((" << x0 << " " << y0 << ", " << x1 << " " << y0 << ", "
+                    << x1 << " " << y1 << ", " << x0 << " " << y1 << ", " << x0 << " " << y0 << "))";
+                geoms.push_back(r.read(wkt.str()));
+            }
+        }
+        return geoms;
+    }
+
+    std::map<std::size_t, std::unique_ptr<Geometry>>
+    validateTiled(TiledCoverageValidator& validator, bool& isValid)
+    {
+        std::map<std::size_t, std::unique_ptr<Geometry>> result;
+        isValid = validator.validate([&result](std::size_t i, std::unique_ptr<Geometry> invalid) {
+            ensure("element reported more than once", result.find(i) == result.end());
+            result[i] = std::move(invalid);
+        });
+        return result;
+    }
+
+    void
+    checkSame(const std::vector<std::unique_ptr<Geometry>>& expected,
+              const std::map<std::size_t, std::unique_ptr<Geometry>>& actual,
+              bool isValid)
+    {
+        std::size_t numInvalid = 0;
+        for (std::size_t i = 0; i < expected.size(); i++) {
+            auto it = actual.find(i);
+            if (expected[i] == nullptr) {
+                ensure("unexpected invalid element", it == actual.end());
+                continue;
+            }
+            numInvalid++;
+            ensure("missing invalid element", it != actual.end());
+            ensure_equals_geometry(expected[i].get(), it->second.get());
+        }
+        ensure_equals(actual.size(), numInvalid);
+        ensure_equals(isValid, numInvalid == 0);
+    }
+
+    void
+    checkTiled(const std::vector<std::unique_ptr<Geometry>>& geoms, double gapWidth)
+    {
+        std::vector<const Geometry*> coverage = toCoverage(geoms);
+        std::vector<std::unique_ptr<Geometry>> expected = CoverageValidator::validate(coverage, gapWidth);
+
+        for (std::size_t batchSize : { 1u, 3u, 16u, 1000u }) {
+            for (std::size_t numThreads : { 1u, 4u }) {
+                TiledCoverageValidator validator(coverage);
+                validator.setGapWidth(gapWidth);
+                validator.setBatchSize(batchSize);
+                validator.setNumThreads(numThreads);
+                bool isValid;
+                auto actual = validateTiled(validator, isValid);
+                checkSame(expected, actual, isValid);
+            }
+        }
+    }
+};
+
+typedef test_group<test_tiledcoveragevalidator_data> group;
+typedef group::object object;
+
+group test_tiledcoveragevalidator_group("geos::coverage::TiledCoverageValidator");
+
+//
+// Test Cases
+//
+
+// Valid coverage
+template<>
+template<>
+void object::test<1> ()
+{
+    std::vector<std::unique_ptr<Geometry>> geoms = readList({
+        "POLYGON ((1 9, 5 9, 5 5, 1 5, 1 9))",
+        "POLYGON ((5 9, 9 9, 9 5, 5 5, 5 9))",
+        "POLYGON ((1 5, 5 5, 5 1, 1 1, 1 5))",
+        "POLYGON ((5 5, 9 5, 9 1, 5 1, 5 5))"
+    });
+    std::vector<const Geometry*> coverage = toCoverage(geoms);
+
+    TiledCoverageValidator validator(coverage);
+    validator.setBatchSize(1);
+    bool isValid;
+    auto actual = validateTiled(validator, isValid);
+    ensure(isValid);
+    ensure(actual.empty());
+}
+
+// Invalid coverage matches CoverageValidator
+template<>
+template<>
+void object::test<2> ()
+{
+    checkTiled(createGrid(12, 9), 0.0);
+}
+
+// Gap detection matches CoverageValidator
+template<>
+template<>
+void object::test<3> ()
+{
+    checkTiled(createGrid(12, 9), 1.0);
+}
+
+// Geometries are loaded on demand and released after use
+template<>
+template<>
+void object::test<4> ()
+{
+    std::vector<std::unique_ptr<Geometry>> geoms = createGrid(30, 30);
+    std::vector<const Geometry*> coverage = toCoverage(geoms);
+    std::vector<std::unique_ptr<Geometry>> expected = CoverageValidator::validate(coverage);
+
+    std::vector<Envelope> envelopes;
+    for (const auto& g : geoms) {
+        envelopes.push_back(*g->getEnvelopeInternal());
+    }
+    std::vector<int> loadCount(geoms.size(), 0);
+    TiledCoverageValidator validator(envelopes, [&](std::size_t i) {
+        loadCount[i]++;
+        return geoms[i]->clone();
+    });
+    validator.setBatchSize(50);
+    bool isValid;
+    auto actual = validateTiled(validator, isValid);
+    checkSame(expected, actual, isValid);
+
+    for (int count : loadCount) {
+        ensure_equals(count, 1);
+    }
+    ensure(validator.getMaxResident() < geoms.size() / 2);
+}
+
+// Empty elements
+template<>
+template<>
+void object::test<5> ()
+{
+    std::vector<std::unique_ptr<Geometry>> geoms = readList({
+        "POLYGON ((1 9, 5 9, 5 5, 1 5, 1 9))",
+        "POLYGON EMPTY",
+        "POLYGON ((5 9, 9 9, 9 5, 4 5, 5 9))"
+    });
+    checkTiled(geoms, 0.0);
+}
+
+// Empty coverage
+template<>
+template<>
+void object::test<6> ()
+{
+    std::vector<const Geometry*> coverage;
+    TiledCoverageValidator validator(coverage);
+    bool isValid;
+    auto actual = validateTiled(validator, isValid);
+    ensure(isValid);
+    ensure(actual.empty());
+}
+
+// The coverage vector need not outlive the validator
+template<>
+template<>
+void object::test<7> ()
+{
+    std::vector<std::unique_ptr<Geometry>> geoms = createGrid(5, 5);
+    std::vector<const Geometry*> coverage = toCoverage(geoms);
+    std::vector<std::unique_ptr<Geometry>> expected = CoverageValidator::validate(coverage);
+
+    TiledCoverageValidator validator(toCoverage(geoms));
+    validator.setBatchSize(4);
+    bool isValid;
+    auto actual = validateTiled(validator, isValid);
+    checkSame(expected, actual, isValid);
+}
+
+} // namespace tut
@@ -7,6 +7,7 @@
 #include <geos/geom/CoordinateFilter.h>
 #include <geos/geom/CoordinateSequence.h>
 #include <geos/util.h>
+#include <geos/util/IllegalArgumentException.h>
 #include <geos/constants.h>
 #include <utility.h>
 // std
@@ -1510,4 +1511,87 @@ void object::test<55>
     ensure_equals(seq1, expected);
 }
 
+// test wrapBuffer
+template<>
+template<>
+void object::test<56>
+()
+{
+    double buf[] = { 1, 2, 3, 4, 5, 6 };
+    int released = 0;
+    auto release = [](void* userdata) { ++*static_cast<int*>(userdata); };
+
+    {
+        auto seq = CoordinateSequence::wrapBuffer(buf, 2, true, false, release, &released);
+        ensure(seq.isBorrowed());
+        ensure_equals(seq.size(), 2u);
+        ensure(seq.hasZ());
+        ensure(!seq.hasM());
+
+        const CoordinateSequence& cseq = seq;
+        ensure_equals(cseq.getAt(1), Coordinate(4, 5, 6));
+
+        // copies do not share the buffer
+        CoordinateSequence copy(seq);
+        ensure(!copy.isBorrowed());
+        ensure_equals(copy, seq);
+
+        CoordinateSequence moved(std::move(seq));
+        ensure(moved.isBorrowed());
+        ensure_equals(released, 0);
+
+        // the buffer is copied before modification
+        moved.setAt(Coordinate(7, 8, 9), 0);
+        ensure(!moved.isBorrowed());
+        ensure_equals(released, 1);
+        ensure_equals(buf[0], 1.0);
+        ensure_equals(moved.getAt(0), Coordinate(7, 8, 9));
+        ensure_equals(moved.getAt(1), Coordinate(4, 5, 6));
+    }
+    ensure_equals(released, 1);
+
+    {
+        const auto seq = CoordinateSequence::wrapBuffer(buf, 1, true, true, release, &released);
+        ensure_equals(seq.getAt<CoordinateXYZM>(0), CoordinateXYZM(1, 2, 3, 4));
+    }
+    ensure_equals(released, 2);
+
+    // XY coordinates are stored with a Z value
+    try {
+        CoordinateSequence::wrapBuffer(buf, 3, false, false, release, &released);
+        fail("IllegalArgumentException not thrown");
+    } catch (const geos::util::IllegalArgumentException&) {}
+    ensure_equals(released, 2);
+}
+
+// test modification of a sequence using a buffer
+template<>
+template<>
+void object::test<57>
+()
+{
+    double buf[] = { 1, 2, 3, 4, 5, 6 };
+
+    auto seq = CoordinateSequence::wrapBuffer(buf, 2, true, false);
+    const CoordinateSequence& cseq = seq;
+    ensure_equals(&cseq.getAt(1).x, static_cast<const double*>(&buf[3]));
+
+    seq.reverse();
+    ensure(!seq.isBorrowed());
+    ensure_equals(seq.getAt(0), Coordinate(4, 5, 6));
+    ensure_equals(buf[0], 1.0);
+
+    auto seq2 = CoordinateSequence::wrapBuffer(buf, 2, true, false);
+    seq2.closeRing();
+    ensure_equals(seq2.size(), 3u);
+    ensure_equals(seq2.back(), Coordinate(1, 2, 3));
+
+    auto seq3 = CoordinateSequence::wrapBuffer(buf, 2, true, false);
+    seq3.own();
+    ensure(!seq3.isBorrowed());
+    seq3.getAt(0).x = 10;
+    ensure_equals(seq3.getX(0), 10.0);
+    ensure_equals(buf[0], 1.0);
+}
+
 } // namespace tut
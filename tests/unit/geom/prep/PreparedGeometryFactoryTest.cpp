@@ -503,5 +503,36 @@ void object::test<29>
     ensure_equals_geometry(g_.get(), pg_.get());
 }
 
-} // namespace tut
+// Test create POLYGON with grid point locator
+template<>
+template<>
+void object::test<30>
+()
+{
+    g_ = reader_.read("MULTIPOLYGON(((0 0, 10 0, 10 10, 0 10, 0 0),(2 2, 2 6, 6 4, 2 2)),((60 60, 60 50, 70 40, 60 60)))");
+    ensure(nullptr != g_);
 
+    prep::PreparedGeometryFactory pgf;
+    pgf.setUseGridLocator(true);
+    pg_ = pgf.create(g_.get());
+    ensure(nullptr != pg_);
+
+    ensure_equals_geometry(g_.get(), pg_.get());
+
+    const char* wkts[] = {
+        "POINT (1 1)", "POINT (3 4)", "POINT (10 5)", "POINT (65 52)", "POINT (20 20)",
+        "LINESTRING (1 1, 9 9)", "LINESTRING (1 1, 5 4)", "MULTIPOINT ((1 1), (62 55))"
+    };
+    for (const char* wkt : wkts) {
+        auto g = reader_.read(wkt);
+        auto defaultPg = prep::PreparedGeometryFactory::prepare(g_.get());
+        //-- the second predicate call uses the indexed locator
+        for (int i = 0; i < 2; i++) {
+            ensure_equals(wkt, pg_->contains(g.get()), defaultPg->contains(g.get()));
+            ensure_equals(wkt, pg_->covers(g.get()), defaultPg->covers(g.get()));
+            ensure_equals(wkt, pg_->intersects(g.get()), defaultPg->intersects(g.get()));
+        }
+    }
+}
+
+} // namespace tut
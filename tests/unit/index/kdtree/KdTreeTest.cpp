@@ -1,8 +1,12 @@
 #include <tut/tut.hpp>
 // geos
 #include <geos/index/kdtree/KdTree.h>
+#include <geos/geom/CoordinateSequence.h>
 #include <geos/geom/Envelope.h>
 #include <geos/io/WKTReader.h>
+// std
+#include <algorithm>
+#include <random>
 
 using namespace geos::index::kdtree;
 using namespace geos::geom;
@@ -189,8 +193,132 @@ void object::test<8> ()
     ensure(node->isRepeated());
 }
 
+//
+// testBulkInsertBalanced
+//
+template<>
+template<>
+void object::test<9> ()
+{
+    // a sorted grid produces a degenerate tree when inserted one point at a time
+    CoordinateSequence pts;
+    for (int i = 0; i < 64; i++) {
+        for (int j = 0; j < 64; j++) {
+            pts.add(Coordinate(i, j));
+        }
+    }
 
+    KdTree incremental;
+    for (std::size_t i = 0; i < pts.size(); i++) {
+        incremental.insert(pts.getAt<Coordinate>(i));
+    }
+    KdTree bulk;
+    bulk.insert(pts);
+
+    ensure_equals(bulk.size(), pts.size());
+    ensure_equals(incremental.size(), pts.size());
+    // log2(4096) = 12; ties on the splitting ordinate add a little
+    ensure("bulk-loaded tree is balanced", bulk.depth() <= 16);
+    ensure("incremental tree is not balanced", incremental.depth() > 64);
+
+    Envelope env(10.5, 20.5, 30.5, 35.5);
+    std::vector<KdNode*> result;
+    bulk.query(env, result);
+    ensure_equals(result.size(), 10u * 5u);
+
+    for (std::size_t i = 0; i < pts.size(); i += 97) {
+        const Coordinate& p = pts.getAt<Coordinate>(i);
+        KdNode* node = bulk.query(p);
+        ensure(node != nullptr);
+        ensure(node->getCoordinate().equals2D(p));
+    }
+}
 
+//
+// testBulkInsertTolerance
+//
+template<>
+template<>
+void object::test<10> ()
+{
+    CoordinateSequence pts;
+    pts.add(Coordinate(10, 60));
+    pts.add(Coordinate(20, 60));
+    pts.add(Coordinate(20.5, 60));
+    pts.add(Coordinate(10, 60));
+    pts.add(Coordinate(30, 60));
+
+    KdTree index(1.0);
+    index.insert(pts);
+
+    ensure_equals(index.size(), 3u);
+    std::vector<KdNode*> result;
+    index.query(Envelope(0, 99, 0, 99), result);
+    ensure_equals(result.size(), 3u);
+    std::size_t count = 0;
+    for (KdNode* node : result) {
+        count += node->getCount();
+    }
+    ensure_equals(count, 5u);
+}
 
-} // namespace tut
+//
+// testNearestNeighbors
+//
+template<>
+template<>
+void object::test<11> ()
+{
+    std::mt19937 gen(1234);
+    std::uniform_real_distribution<double> dist(0, 100);
+
+    CoordinateSequence pts;
+    for (int i = 0; i < 500; i++) {
+        pts.add(Coordinate(dist(gen), dist(gen)));
+    }
+    KdTree index;
+    index.insert(pts);
+
+    for (int q = 0; q < 50; q++) {
+        CoordinateXY queryPt(dist(gen), dist(gen));
+
+        std::vector<double> expected;
+        for (std::size_t i = 0; i < pts.size(); i++) {
+            expected.push_back(queryPt.distance(pts.getAt<CoordinateXY>(i)));
+        }
+        std::sort(expected.begin(), expected.end());
+
+        std::vector<KdNode*> knn = index.nearestNeighbors(queryPt, 7);
+        ensure_equals(knn.size(), 7u);
+        for (std::size_t i = 0; i < knn.size(); i++) {
+            ensure_equals(queryPt.distance(knn[i]->getCoordinate()), expected[i]);
+        }
 
+        KdNode* nearest = index.nearestNeighbor(queryPt);
+        ensure_equals(queryPt.distance(nearest->getCoordinate()), expected[0]);
+
+        double radius = 12.5;
+        std::vector<KdNode*> inRadius;
+        index.queryRadius(queryPt, radius, inRadius);
+        std::size_t expectedCount = static_cast<std::size_t>(
+            std::upper_bound(expected.begin(), expected.end(), radius) - expected.begin());
+        ensure_equals(inRadius.size(), expectedCount);
+        for (KdNode* node : inRadius) {
+            ensure(queryPt.distance(node->getCoordinate()) <= radius);
+        }
+    }
+
+    // fewer points than requested
+    KdTree small;
+    small.insert(Coordinate(1, 1));
+    small.insert(Coordinate(2, 2));
+    ensure_equals(small.nearestNeighbors(CoordinateXY(0, 0), 5).size(), 2u);
+    ensure(small.nearestNeighbors(CoordinateXY(0, 0), 5)[0]->getCoordinate().equals2D(Coordinate(1, 1)));
+
+    KdTree empty;
+    ensure(empty.nearestNeighbor(CoordinateXY(0, 0)) == nullptr);
+    ensure(empty.nearestNeighbors(CoordinateXY(0, 0), 3).empty());
+    ensure_equals(empty.depth(), 0u);
+}
+
+} // namespace tut
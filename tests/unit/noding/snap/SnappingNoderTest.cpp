@@ -146,9 +146,31 @@ void object::test<7> ()
     checkRounding(wkt1, wkt2, 1, expected);
 }
 
+//  balanced seeding of the snap index on spatially sorted input
+template<>
+template<>
+void object::test<8> ()
+{
+    std::string wkt = "MULTILINESTRING (";
+    for (int i = 0; i < 10; i++) {
+        wkt += i == 0 ? "(" : ", (";
+        for (int j = 0; j <= 200; j++) {
+            wkt += (j == 0 ? "" : ", ") + std::to_string(j) + " " + std::to_string(i * 10);
+        }
+        wkt += ")";
+    }
+    wkt += ", (100.5 -5, 100.5 95))";
+    std::unique_ptr<Geometry> geom = r.read(wkt);
 
+    SnappingNoder noder(0.01);
+    std::unique_ptr<Geometry> expected = geos::NodingTestUtil::nodeValidated(geom.get(), nullptr, &noder);
 
+    SnappingNoder balancedNoder(0.01);
+    balancedNoder.setBalancedSeed(true);
+    std::unique_ptr<Geometry> result = geos::NodingTestUtil::nodeValidated(geom.get(), nullptr, &balancedNoder);
 
-
+    ensure_equals(result->getNumGeometries(), 31u);
+    ensure_equals_geometry(expected.get(), result.get());
+}
 
 } // namespace tut
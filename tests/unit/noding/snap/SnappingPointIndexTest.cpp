@@ -0,0 +1,77 @@
+//
+// Test Suite for geos::noding::snap::SnappingPointIndex class.
+
+#include <tut/tut.hpp>
+
+// geos
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/noding/snap/SnappingPointIndex.h>
+
+using geos::geom::Coordinate;
+using geos::geom::CoordinateSequence;
+using geos::noding::snap::SnappingPointIndex;
+
+namespace tut {
+//
+// Test Group
+//
+
+struct test_snappingpointindex_data {
+
+    static CoordinateSequence
+    sortedGrid(int n)
+    {
+        CoordinateSequence pts;
+        for (int i = 0; i < n; i++) {
+            for (int j = 0; j < n; j++) {
+                pts.add(Coordinate(i, j));
+            }
+        }
+        return pts;
+    }
+};
+
+typedef test_group<test_snappingpointindex_data> group;
+typedef group::object object;
+
+group test_snappingpointindex_group("geos::noding::snap::SnappingPointIndex");
+
+//
+// Test Cases
+//
+
+// points already in the index are snap targets
+template<>
+template<>
+void object::test<1> ()
+{
+    SnappingPointIndex index(0.5);
+    ensure_equals(index.snap(Coordinate(1, 1)), Coordinate(1, 1));
+    ensure_equals(index.snap(Coordinate(1.2, 0.9)), Coordinate(1, 1));
+    ensure_equals(index.snap(Coordinate(2, 1)), Coordinate(2, 1));
+}
+
+// addAll keeps the index balanced for sorted input
+template<>
+template<>
+void object::test<2> ()
+{
+    CoordinateSequence pts = sortedGrid(64);
+
+    SnappingPointIndex incremental(0.1);
+    for (std::size_t i = 0; i < pts.size(); i++) {
+        incremental.snap(pts.getAt<Coordinate>(i));
+    }
+    SnappingPointIndex bulk(0.1);
+    bulk.addAll(pts);
+
+    // log2(4096) = 12; ties on the splitting ordinate add a little
+    ensure("bulk-loaded index is balanced", bulk.depth() <= 16);
+    ensure("incremental index is not balanced", incremental.depth() > 64);
+
+    ensure_equals(bulk.snap(Coordinate(10.05, 20)), Coordinate(10, 20));
+    ensure_equals(bulk.snap(Coordinate(63, 63)), Coordinate(63, 63));
+}
+
+} // namespace tut
@@ -592,4 +592,69 @@ void object::test<22>
     ensure_equals(result->getArea(), 200);
 }
 
+// bufferMany matches bufferOp for points and other geometries
+template<>
+template<>
+void object::test<23>
+()
+{
+    using geos::operation::buffer::BufferOp;
+    using geos::operation::buffer::BufferParameters;
+
+    std::vector<GeomPtr> geoms;
+    for (int i = 0; i < 600; i++) {
+        std::ostringstream wkt;
+        wkt << "POINT (" << i * 0.37 << " " << (i % 17) * 1.3 << ")";
+        geoms.push_back(wktreader.read(wkt.str()));
+    }
+    geoms.push_back(wktreader.read("POINT EMPTY"));
+    geoms.push_back(wktreader.read("LINESTRING (0 0, 10 0, 10 10)"));
+    geoms.push_back(wktreader.read("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0), (2 2, 2 8, 8 8, 8 2, 2 2))"));
+    geoms.push_back(wktreader.read("MULTIPOINT ((0 0), (1 0))"));
+
+    std::vector<const Geometry*> input;
+    for (const auto& g : geoms) {
+        input.push_back(g.get());
+    }
+
+    for (int capStyle : { BufferParameters::CAP_ROUND, BufferParameters::CAP_FLAT, BufferParameters::CAP_SQUARE }) {
+        BufferParameters bp;
+        bp.setEndCapStyle(static_cast<BufferParameters::EndCapStyle>(capStyle));
+        bp.setQuadrantSegments(6);
+        for (double distance : { 1.5, 0.0, -1.0 }) {
+            for (std::size_t numThreads : { 1u, 3u }) {
+                std::vector<GeomPtr> result = BufferOp::bufferMany(input, distance, bp, numThreads);
+                ensure_equals(result.size(), input.size());
+                for (std::size_t i = 0; i < input.size(); i++) {
+                    GeomPtr expected = BufferOp::bufferOp(input[i], distance, bp);
+                    ensure(result[i]->equalsExact(expected.get()));
+                }
+            }
+        }
+    }
+}
+
+// bufferMany rethrows errors
+template<>
+template<>
+void object::test<24>
+()
+{
+    using geos::operation::buffer::BufferOp;
+    using geos::operation::buffer::BufferParameters;
+
+    GeomPtr geom(wktreader.read("POINT (1 1)"));
+    std::vector<const Geometry*> input { geom.get() };
+    BufferParameters bp;
+    std::vector<GeomPtr> empty = BufferOp::bufferMany({}, 1.0, bp);
+    ensure(empty.empty());
+    try {
+        BufferOp::bufferMany(input, std::numeric_limits<double>::infinity(), bp);
+        fail("expected exception");
+    }
+    catch (const geos::util::IllegalArgumentException&) {
+    }
+}
+
 } // namespace tut
+
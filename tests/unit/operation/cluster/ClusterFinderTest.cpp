@@ -8,8 +8,12 @@
 #include <geos/operation/cluster/GeometryIntersectsClusterFinder.h>
 #include <geos/operation/cluster/EnvelopeIntersectsClusterFinder.h>
 #include <geos/operation/cluster/GeometryDistanceClusterFinder.h>
+#include <geos/operation/cluster/EnvelopeDistanceClusterFinder.h>
 #include <geos/io/WKTReader.h>
 
+#include <map>
+#include <sstream>
+
 using geos::geom::Geometry;
 
 template<typename T, typename U>
@@ -27,6 +31,53 @@ namespace tut {
 // Common data used by tests
 struct test_cluster_data {
     geos::io::WKTReader reader;
+
+    // points on a jittered grid, with denser and sparser areas
+    std::vector<std::unique_ptr<Geometry>> createPoints(int n) {
+        std::vector<std::unique_ptr<Geometry>> geoms;
+        for (int i = 0; i < n; i++) {
+            double x = (i * 37) % 101 + ((i * 13) % 7) * 0.1;
+            double y = (i * 53) % 97 + ((i * 29) % 11) * 0.1;
+            if (i % 3 == 0) {
+                x *= 0.25;
+            }
+            std::ostringstream wkt;
+            if (i % 5 == 0) {
+                wkt << "LINESTRING (" << x << " " << y << ", " << x + 1.5 << " " << y + 0.5 << ")";
+            } else {
+                wkt << "POINT (" << x << " " << y << ")";
+            }
+            geoms.push_back(reader.read(wkt.str()));
+        }
+        return geoms;
+    }
+
+    // checks that cluster ids define the same partition
+    void checkSamePartition(const std::vector<std::size_t>& expected, const std::vector<std::size_t>& actual) {
+        ensure_equals(actual.size(), expected.size());
+        std::map<std::size_t, std::size_t> fwd, rev;
+        for (std::size_t i = 0; i < expected.size(); i++) {
+            auto f = fwd.emplace(expected[i], actual[i]);
+            auto r = rev.emplace(actual[i], expected[i]);
+            ensure("same partition", f.first->second == actual[i] && r.first->second == expected[i]);
+        }
+    }
+
+    void checkParallel(geos::operation::cluster::AbstractClusterFinder& serial,
+                       geos::operation::cluster::AbstractClusterFinder& parallel,
+                       const std::vector<std::unique_ptr<Geometry>>& geoms) {
+        std::vector<const Geometry*> components;
+        for (const auto& g : geoms) {
+            components.push_back(g.get());
+        }
+        auto expected = serial.cluster(components);
+        for (std::size_t numThreads : { 2u, 4u }) {
+            parallel.setNumThreads(numThreads);
+            auto actual = parallel.cluster(components);
+            ensure_equals(actual.getNumClusters(), expected.getNumClusters());
+            checkSamePartition(expected.getClusterIds(), actual.getClusterIds());
+        }
+    }
 };
 
 typedef test_group<test_cluster_data> group;
@@ -210,6 +261,41 @@ void object::test<5>() {
     ensure_equals(cluster_id_vec[0], 0u);
 }
 
-} // namespace tut
+// Multi-threaded DBSCAN finds the same clusters
+template<>
+template<>
+void object::test<6>() {
+    using geos::operation::cluster::DBSCANClusterFinder;
 
+    auto geoms = createPoints(3000);
+    for (std::size_t minPoints : { 1u, 3u, 6u }) {
+        DBSCANClusterFinder serial(1.2, minPoints);
+        DBSCANClusterFinder parallel(1.2, minPoints);
+        checkParallel(serial, parallel, geoms);
+    }
+}
 
+// Multi-threaded distance clustering finds the same clusters
+template<>
+template<>
+void object::test<7>() {
+    using geos::operation::cluster::GeometryDistanceClusterFinder;
+    using geos::operation::cluster::GeometryIntersectsClusterFinder;
+    using geos::operation::cluster::EnvelopeDistanceClusterFinder;
+
+    auto geoms = createPoints(3000);
+    {
+        GeometryDistanceClusterFinder serial(0.8), parallel(0.8);
+        checkParallel(serial, parallel, geoms);
+    }
+    {
+        GeometryIntersectsClusterFinder serial, parallel;
+        checkParallel(serial, parallel, geoms);
+    }
+    {
+        EnvelopeDistanceClusterFinder serial(0.5), parallel(0.5);
+        checkParallel(serial, parallel, geoms);
+    }
+}
+
+} // namespace tut
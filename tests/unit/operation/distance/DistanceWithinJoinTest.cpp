@@ -0,0 +1,233 @@
+//
+// Test Suite for geos::operation::distance::DistanceWithinJoin class.
+
+// tut
+#include <tut/tut.hpp>
+// geos
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/io/WKTReader.h>
+#include <geos/operation/distance/DistanceWithinJoin.h>
+// std
+#include <cmath>
+#include <memory>
+#include <random>
+#include <utility>
+#include <vector>
+
+using geos::geom::Coordinate;
+using geos::geom::CoordinateSequence;
+using geos::geom::Geometry;
+using geos::operation::distance::DistanceWithinJoin;
+
+namespace tut {
+//
+// Test Group
+//
+
+struct test_distancewithinjoin_data {
+
+    typedef std::unique_ptr<Geometry> GeomPtr;
+    typedef std::vector<std::pair<std::size_t, std::size_t>> PairList;
+
+    geos::geom::GeometryFactory::Ptr factory_;
+    geos::io::WKTReader reader_;
+
+    test_distancewithinjoin_data()
+        : factory_(geos::geom::GeometryFactory::create())
+        , reader_(factory_.get())
+    {}
+
+    static std::vector<const Geometry*>
+    toList(const std::vector<GeomPtr>& geoms)
+    {
+        std::vector<const Geometry*> list;
+        for (const auto& g : geoms) {
+            list.push_back(g.get());
+        }
+        return list;
+    }
+
+    std::vector<GeomPtr>
+    read(const std::vector<std::string>& wkts)
+    {
+        std::vector<GeomPtr> geoms;
+        for (const auto& wkt : wkts) {
+            geoms.push_back(reader_.read(wkt));
+        }
+        return geoms;
+    }
+
+    static PairList
+    bruteForce(const std::vector<const Geometry*>& a,
+               const std::vector<const Geometry*>& b,
+               double distance)
+    {
+        PairList pairs;
+        for (std::size_t i = 0; i < a.size(); i++) {
+            for (std::size_t j = 0; j < b.size(); j++) {
+                if (a[i]->isWithinDistance(b[j], distance)) {
+                    pairs.emplace_back(i, j);
+                }
+            }
+        }
+        return pairs;
+    }
+
+    static void
+    checkJoin(const std::vector<const Geometry*>& a,
+              const std::vector<const Geometry*>& b,
+              double distance)
+    {
+        PairList expected = bruteForce(a, b, distance);
+
+        for (std::size_t indexThreshold : { 4u, 1000u }) {
+            for (std::size_t numThreads : { 1u, 4u }) {
+                DistanceWithinJoin dwj(a, b, distance);
+                dwj.setIndexThreshold(indexThreshold);
+                dwj.setNumThreads(numThreads);
+                ensure(dwj.join() == expected);
+            }
+        }
+    }
+};
+
+typedef test_group<test_distancewithinjoin_data> group;
+typedef group::object object;
+
+group test_distancewithinjoin_group("geos::operation::distance::DistanceWithinJoin");
+
+//
+// Test Cases
+//
+
+// Points
+template<>
+template<>
+void object::test<1>
+()
+{
+    auto a = read({ "POINT (0 0)", "POINT (10 0)", "POINT (20 0)" });
+    auto b = read({ "POINT (1 1)", "POINT (11 0)", "POINT (0 3)", "POINT (30 30)" });
+
+    PairList pairs = DistanceWithinJoin::join(toList(a), toList(b), 2);
+
+    PairList expected { { 0, 0 }, { 1, 1 } };
+    ensure(pairs == expected);
+}
+
+// Geometries inside polygons are within any distance,
+// even though they are far from the polygon boundary
+template<>
+template<>
+void object::test<2>
+()
+{
+    auto a = read({
+        "POLYGON ((0 0, 100 0, 100 100, 0 100, 0 0), (40 40, 60 40, 60 60, 40 60, 40 40))",
+        "MULTIPOLYGON (((200 0, 210 0, 210 10, 200 10, 200 0)), ((300 0, 400 0, 400 100, 300 100, 300 0)))",
+        "LINESTRING (150 50, 160 50, 170 60, 180 50)"
+    });
+    auto b = read({
+        "POINT (10 10)",
+        "POINT (50 50)",
+        "LINESTRING (20 20, 30 30, 20 30)",
+        "POLYGON ((310 10, 320 10, 320 20, 310 20, 310 10))",
+        "POLYGON ((140 0, 190 0, 190 100, 140 100, 140 0))",
+        "POLYGON ((-10 -10, 500 -10, 500 500, -10 500, -10 -10))",
+        "GEOMETRYCOLLECTION (POINT (205 5), LINESTRING (0 200, 10 200))",
+        "POINT (101 50)"
+    });
+
+    checkJoin(toList(a), toList(b), 0);
+    checkJoin(toList(a), toList(b), 1);
+    checkJoin(toList(b), toList(a), 1);
+    checkJoin(toList(a), toList(b), 15);
+}
+
+// Random mix of points, lines and polygons
+template<>
+template<>
+void object::test<3>
+()
+{
+    std::mt19937 gen(1234);
+    std::uniform_real_distribution<double> coord(0, 1000);
+    std::uniform_real_distribution<double> step(-20, 20);
+    std::uniform_int_distribution<int> kind(0, 2);
+
+    std::vector<GeomPtr> geoms;
+    for (int i = 0; i < 600; i++) {
+        Coordinate c(coord(gen), coord(gen));
+        switch (kind(gen)) {
+        case 0:
+            geoms.push_back(factory_->createPoint(c));
+            break;
+        case 1: {
+            CoordinateSequence seq;
+            for (int k = 0; k < 10; k++) {
+                seq.add(c);
+                c.x += step(gen);
+                c.y += step(gen);
+            }
+            geoms.push_back(factory_->createLineString(std::move(seq)));
+            break;
+        }
+        default: {
+            GeomPtr pt = factory_->createPoint(c);
+            geoms.push_back(pt->buffer(std::abs(step(gen)) + 1));
+        }
+        }
+    }
+    auto list = toList(geoms);
+    std::vector<const Geometry*> a(list.begin(), list.begin() + 300);
+    std::vector<const Geometry*> b(list.begin() + 300, list.end());
+
+    checkJoin(a, b, 10);
+    checkJoin(b, a, 25);
+}
+
+// Empty geometries are not joined
+template<>
+template<>
+void object::test<4>
+()
+{
+    auto a = read({ "POINT EMPTY", "POINT (0 0)", "POLYGON EMPTY" });
+    auto b = read({ "POINT (0 0)", "LINESTRING EMPTY", "GEOMETRYCOLLECTION EMPTY" });
+
+    PairList expected { { 1, 0 } };
+    ensure(DistanceWithinJoin::join(toList(a), toList(b), 100) == expected);
+    ensure(DistanceWithinJoin::join(toList(a), toList(b), 100, 2) == expected);
+    ensure(DistanceWithinJoin::join({}, toList(b), 100).empty());
+    ensure(DistanceWithinJoin::join(toList(a), {}, 100).empty());
+}
+
+// Pairs are visited in order of A and then B,
+// independent of the number of threads
+template<>
+template<>
+void object::test<5>
+()
+{
+    std::vector<GeomPtr> a;
+    std::vector<GeomPtr> b;
+    for (int i = 0; i < 2000; i++) {
+        a.push_back(factory_->createPoint(Coordinate(i % 50, i / 50)));
+        b.push_back(factory_->createPoint(Coordinate((i * 7) % 50 + 0.5, (i * 13) % 40 + 0.5)));
+    }
+
+    DistanceWithinJoin dwj(toList(a), toList(b), 1);
+    dwj.setNumThreads(0);
+    PairList visited;
+    dwj.join([&visited](std::size_t i, std::size_t j) {
+        visited.emplace_back(i, j);
+    });
+
+    ensure(! visited.empty());
+    ensure(visited == bruteForce(toList(a), toList(b), 1));
+}
+
+} // namespace tut
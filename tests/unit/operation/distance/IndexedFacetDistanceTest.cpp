@@ -475,6 +475,63 @@ void object::test<16>
     );
 }
 
+// Batch distances match the distance computed for each geometry
+template<>
+template<>
+void object::test<17>
+()
+{
+    GeomPtr base(_wktreader.read("MULTILINESTRING ((0 0, 10 10, 20 0), (30 30, 40 30, 40 40))"));
+    std::vector<GeomPtr> geoms;
+    for (int i = 0; i < 50; i++) {
+        double x = -10 + i;
+        geoms.emplace_back(_factory->createPoint(Coordinate(x, 0.7 * x + 3)));
+    }
+    geoms.emplace_back(_wktreader.read("LINESTRING (5 20, 25 25)"));
+    geoms.emplace_back(_wktreader.read("POLYGON ((35 0, 45 0, 45 10, 35 10, 35 0))"));
+    geoms.emplace_back(_wktreader.read("MULTIPOINT ((100 100), (12 3))"));
+    geoms.emplace_back(_wktreader.read("POINT (10 10)"));
+
+    std::vector<const geos::geom::Geometry*> geomList;
+    for (const auto& g : geoms) {
+        geomList.push_back(g.get());
+    }
+
+    IndexedFacetDistance ifd(base.get());
+    for (std::size_t numThreads : { 1u, 4u }) {
+        std::vector<double> dists = ifd.distance(geomList, numThreads);
+        ensure_equals(dists.size(), geoms.size());
+        for (std::size_t i = 0; i < geoms.size(); i++) {
+            ensure(std::abs(dists[i] - base->distance(geoms[i].get())) < 1e-12);
+        }
+
+        std::vector<bool> isWithin = ifd.isWithinDistance(geomList, 2.5, numThreads);
+        ensure_equals(isWithin.size(), geoms.size());
+        for (std::size_t i = 0; i < geoms.size(); i++) {
+            ensure_equals(isWithin[i], dists[i] <= 2.5);
+        }
+    }
+}
+
+// Batch distance to an empty geometry throws
+template<>
+template<>
+void object::test<18>
+()
+{
+    GeomPtr base(_wktreader.read("LINESTRING (0 0, 10 10)"));
+    GeomPtr pt(_wktreader.read("POINT (1 1)"));
+    GeomPtr empty(_wktreader.read("POINT EMPTY"));
+    std::vector<const geos::geom::Geometry*> geomList { pt.get(), empty.get() };
+
+    IndexedFacetDistance ifd(base.get());
+    ensure_THROW(ifd.distance(geomList, 2), geos::util::GEOSException);
+
+    std::vector<bool> isWithin = ifd.isWithinDistance(geomList, 1, 2);
+    ensure(isWithin[0]);
+    ensure(! isWithin[1]);
+}
+
 // TODO: finish the tests by adding:
 // 	LINESTRING - *all*
 // 	MULTILINESTRING - *all*
@@ -0,0 +1,279 @@
+//
+// Test Suite for geos::operation::join::SpatialJoin class.
+
+// tut
+#include <tut/tut.hpp>
+// geos
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/Envelope.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/io/WKTReader.h>
+#include <geos/operation/join/SpatialJoin.h>
+// std
+#include <cmath>
+#include <memory>
+#include <random>
+#include <utility>
+#include <vector>
+
+using geos::geom::Coordinate;
+using geos::geom::CoordinateSequence;
+using geos::geom::Envelope;
+using geos::geom::Geometry;
+using geos::operation::join::SpatialJoin;
+
+namespace tut {
+//
+// Test Group
+//
+
+struct test_spatialjoin_data {
+
+    typedef std::unique_ptr<Geometry> GeomPtr;
+    typedef std::vector<std::pair<std::size_t, std::size_t>> PairList;
+
+    geos::geom::GeometryFactory::Ptr factory_;
+    geos::io::WKTReader reader_;
+
+    test_spatialjoin_data()
+        : factory_(geos::geom::GeometryFactory::create())
+        , reader_(factory_.get())
+    {}
+
+    static std::vector<const Geometry*>
+    toList(const std::vector<GeomPtr>& geoms)
+    {
+        std::vector<const Geometry*> list;
+        for (const auto& g : geoms) {
+            list.push_back(g.get());
+        }
+        return list;
+    }
+
+    std::vector<GeomPtr>
+    read(const std::vector<std::string>& wkts)
+    {
+        std::vector<GeomPtr> geoms;
+        for (const auto& wkt : wkts) {
+            geoms.push_back(reader_.read(wkt));
+        }
+        return geoms;
+    }
+
+    static bool
+    evaluate(const Geometry* a, const Geometry* b, SpatialJoin::Predicate predicate, double distance)
+    {
+        switch (predicate) {
+        case SpatialJoin::INTERSECTS:
+            return a->intersects(b);
+        case SpatialJoin::CONTAINS:
+            return a->contains(b);
+        case SpatialJoin::COVERS:
+            return a->covers(b);
+        case SpatialJoin::WITHIN:
+            return a->within(b);
+        case SpatialJoin::COVEREDBY:
+            return a->coveredBy(b);
+        case SpatialJoin::DWITHIN:
+            return a->isWithinDistance(b, distance);
+        }
+        return false;
+    }
+
+    static void
+    checkJoin(const std::vector<const Geometry*>& a,
+              const std::vector<const Geometry*>& b,
+              SpatialJoin::Predicate predicate,
+              double distance = 0)
+    {
+        PairList expected;
+        for (std::size_t i = 0; i < a.size(); i++) {
+            for (std::size_t j = 0; j < b.size(); j++) {
+                if (evaluate(a[i], b[j], predicate, distance)) {
+                    expected.emplace_back(i, j);
+                }
+            }
+        }
+
+        for (std::size_t numThreads : { 1u, 3u }) {
+            SpatialJoin sj(a, b, predicate);
+            sj.setDistance(distance);
+            sj.setNumThreads(numThreads);
+            ensure(sj.join() == expected);
+        }
+    }
+};
+
+typedef test_group<test_spatialjoin_data> group;
+typedef group::object object;
+
+group test_spatialjoin_group("geos::operation::join::SpatialJoin");
+
+//
+// Test Cases
+//
+
+// Points in polygons
+template<>
+template<>
+void object::test<1>
+()
+{
+    auto polys = read({
+        "POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))",
+        "POLYGON ((10 0, 20 0, 20 10, 10 10, 10 0))",
+        "POLYGON ((0 10, 20 10, 20 20, 0 20, 0 10), (5 12, 15 12, 15 18, 5 18, 5 12))"
+    });
+    auto pts = read({ "POINT (5 5)", "POINT (15 5)", "POINT (10 5)", "POINT (10 15)", "POINT (30 30)", "POINT EMPTY" });
+
+    PairList contains = SpatialJoin::join(toList(polys), toList(pts), SpatialJoin::CONTAINS);
+    PairList expectedContains { { 0, 0 }, { 1, 1 } };
+    ensure(contains == expectedContains);
+
+    PairList covers = SpatialJoin::join(toList(polys), toList(pts), SpatialJoin::COVERS);
+    PairList expectedCovers { { 0, 0 }, { 0, 2 }, { 1, 1 }, { 1, 2 } };
+    ensure(covers == expectedCovers);
+
+    PairList within = SpatialJoin::join(toList(pts), toList(polys), SpatialJoin::WITHIN);
+    PairList expectedWithin { { 0, 0 }, { 1, 1 } };
+    ensure(within == expectedWithin);
+}
+
+// All predicates agree with the Geometry predicates,
+// whichever side is indexed
+template<>
+template<>
+void object::test<2>
+()
+{
+    std::mt19937 gen(4321);
+    std::uniform_real_distribution<double> coord(0, 500);
+    std::uniform_real_distribution<double> step(-15, 15);
+
+    std::vector<GeomPtr> areas;
+    std::vector<GeomPtr> mixed;
+    for (int i = 0; i < 80; i++) {
+        GeomPtr pt = factory_->createPoint(Coordinate(coord(gen), coord(gen)));
+        areas.push_back(pt->buffer(std::abs(step(gen)) * 3 + 5));
+    }
+    for (int i = 0; i < 300; i++) {
+        Coordinate c(coord(gen), coord(gen));
+        switch (i % 3) {
+        case 0:
+            mixed.push_back(factory_->createPoint(c));
+            break;
+        case 1: {
+            CoordinateSequence seq;
+            for (int k = 0; k < 3; k++) {
+                seq.add(c);
+                c.x += step(gen);
+                c.y += step(gen);
+            }
+            mixed.push_back(factory_->createLineString(std::move(seq)));
+            break;
+        }
+        default: {
+            GeomPtr pt = factory_->createPoint(c);
+            mixed.push_back(pt->buffer(std::abs(step(gen)) / 3 + 1, 2));
+        }
+        }
+    }
+    //-- a point on a polygon boundary
+    mixed.push_back(factory_->createPoint(*areas[0]->getCoordinate()));
+
+    auto a = toList(areas);
+    auto b = toList(mixed);
+    for (auto predicate : { SpatialJoin::INTERSECTS, SpatialJoin::CONTAINS, SpatialJoin::COVERS,
+                            SpatialJoin::WITHIN, SpatialJoin::COVEREDBY }) {
+        checkJoin(a, b, predicate);
+        checkJoin(b, a, predicate);
+    }
+    checkJoin(a, b, SpatialJoin::DWITHIN, 12);
+    checkJoin(b, a, SpatialJoin::DWITHIN, 12);
+}
+
+// Visited pairs do not depend on the number of threads
+template<>
+template<>
+void object::test<3>
+()
+{
+    std::vector<GeomPtr> cells;
+    std::vector<GeomPtr> pts;
+    for (int i = 0; i < 20; i++) {
+        for (int j = 0; j < 20; j++) {
+            Envelope env(i * 10, i * 10 + 10, j * 10, j * 10 + 10);
+            cells.push_back(factory_->toGeometry(&env));
+        }
+    }
+    for (int i = 0; i < 5000; i++) {
+        pts.push_back(factory_->createPoint(Coordinate((i * 37) % 200 + 0.5, (i * 91) % 200 + 0.5)));
+    }
+
+    PairList visited1;
+    PairList visited4;
+    SpatialJoin sj(toList(pts), toList(cells), SpatialJoin::INTERSECTS);
+    sj.join([&visited1](std::size_t i, std::size_t j) {
+        visited1.emplace_back(i, j);
+    });
+    sj.setNumThreads(4);
+    sj.join([&visited4](std::size_t i, std::size_t j) {
+        visited4.emplace_back(i, j);
+    });
+
+    ensure_equals(visited1.size(), pts.size());
+    ensure(visited1 == visited4);
+}
+
+// Empty inputs
+template<>
+template<>
+void object::test<4>
+()
+{
+    auto a = read({ "POLYGON EMPTY", "POLYGON ((0 0, 1 0, 1 1, 0 0))" });
+    auto b = read({ "POINT EMPTY", "GEOMETRYCOLLECTION EMPTY" });
+
+    ensure(SpatialJoin::join(toList(a), toList(b), SpatialJoin::INTERSECTS).empty());
+    ensure(SpatialJoin::join(toList(a), {}, SpatialJoin::COVERS).empty());
+    ensure(SpatialJoin::join({}, toList(a), SpatialJoin::WITHIN).empty());
+}
+
+// More indexed geometries than the prepared geometry cache holds,
+// each matched by queries before and after it is evicted
+template<>
+template<>
+void object::test<5>
+()
+{
+    const int n = 50;
+    std::vector<GeomPtr> cells;
+    std::vector<GeomPtr> pts;
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            Envelope env(i * 10, i * 10 + 10, j * 10, j * 10 + 10);
+            cells.push_back(factory_->toGeometry(&env));
+        }
+    }
+    for (int pass = 0; pass < 2; pass++) {
+        for (const auto& cell : cells) {
+            pts.push_back(cell->getCentroid());
+        }
+    }
+
+    PairList expected;
+    for (std::size_t i = 0; i < cells.size(); i++) {
+        expected.emplace_back(i, i);
+        expected.emplace_back(i, i + cells.size());
+    }
+
+    for (std::size_t numThreads : { 1u, 3u }) {
+        SpatialJoin sj(toList(cells), toList(pts), SpatialJoin::CONTAINS);
+        sj.setNumThreads(numThreads);
+        ensure(sj.join() == expected);
+    }
+}
+
+} // namespace tut
@@ -0,0 +1,204 @@
+//
+// Test Suite for geos::operation::overlayng::OverlayNG rectangle clip mode.
+
+#include <tut/tut.hpp>
+#include <utility.h>
+
+// geos
+#include <geos/geom/Point.h>
+#include <geos/operation/overlayng/OverlayNG.h>
+
+// std
+#include <memory>
+
+using namespace geos::geom;
+using namespace geos::operation::overlayng;
+using geos::io::WKTReader;
+using geos::io::WKTWriter;
+
+namespace tut {
+//
+// Test Group
+//
+
+// Common data used by all tests
+struct test_overlayngrectangleclip_data {
+
+    WKTReader r;
+    WKTWriter w;
+
+    std::unique_ptr<Geometry>
+    clip(const Geometry* geom, const Geometry* rect)
+    {
+        OverlayNG ov(geom, rect, OverlayNG::INTERSECTION);
+        ov.setRectangleClipMode(true);
+        return ov.getResult();
+    }
+
+    void
+    checkClip(const Geometry* geom, const Geometry* rect)
+    {
+        std::unique_ptr<Geometry> expected = OverlayNG::overlay(geom, rect, OverlayNG::INTERSECTION);
+        std::unique_ptr<Geometry> actual = clip(geom, rect);
+        ensure("result is not valid", actual->isValid());
+        if (expected->isEmpty()) {
+            ensure("result should be empty", actual->isEmpty());
+            return;
+        }
+        ensure_equals_geometry(actual.get(), expected.get());
+
+        // operand order does not matter
+        std::unique_ptr<Geometry> actualRev = clip(rect, geom);
+        ensure_equals_geometry(actualRev.get(), expected.get());
+    }
+
+    void
+    checkClip(const std::string& wkt, const std::string& rectWkt)
+    {
+        std::unique_ptr<Geometry> geom = r.read(wkt);
+        std::unique_ptr<Geometry> rect = r.read(rectWkt);
+        checkClip(geom.get(), rect.get());
+    }
+
+    void
+    checkClip(const std::string& wkt, const std::string& rectWkt, const std::string& expectedWkt)
+    {
+        std::unique_ptr<Geometry> geom = r.read(wkt);
+        std::unique_ptr<Geometry> rect = r.read(rectWkt);
+        std::unique_ptr<Geometry> expected = r.read(expectedWkt);
+        std::unique_ptr<Geometry> actual = clip(geom.get(), rect.get());
+        ensure_equals_geometry(actual.get(), expected.get());
+    }
+
+};
+
+typedef test_group<test_overlayngrectangleclip_data> group;
+typedef group::object object;
+
+group test_overlayngrectangleclip_group("geos::operation::overlayng::OverlayNGRectangleClip");
+
+//
+// Test Cases
+//
+
+// Polygon crossing the rectangle
+template<>
+template<>
+void object::test<1> ()
+{
+    checkClip("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))",
+              "POLYGON ((5 5, 15 5, 15 15, 5 15, 5 5))",
+              "POLYGON ((5 5, 5 10, 10 10, 10 5, 5 5))");
+}
+
+// Polygon with hole crossing the rectangle
+template<>
+template<>
+void object::test<2> ()
+{
+    checkClip("POLYGON ((0 0, 20 0, 20 20, 0 20, 0 0), (5 5, 5 15, 15 15, 15 5, 5 5))",
+              "POLYGON ((10 -5, 30 -5, 30 10, 10 10, 10 -5))");
+}
+
+// Rectangle inside the polygon, inside a hole, and containing the polygon
+template<>
+template<>
+void object::test<3> ()
+{
+    std::string poly = "POLYGON ((0 0, 20 0, 20 20, 0 20, 0 0), (5 5, 5 15, 15 15, 15 5, 5 5))";
+    checkClip(poly, "POLYGON ((1 1, 4 1, 4 4, 1 4, 1 1))", "POLYGON ((1 1, 4 1, 4 4, 1 4, 1 1))");
+    checkClip(poly, "POLYGON ((6 6, 14 6, 14 14, 6 14, 6 6))", "POLYGON EMPTY");
+    checkClip(poly, "POLYGON ((-1 -1, 21 -1, 21 21, -1 21, -1 -1))");
+}
+
+// Polygon edges and vertices lying on the rectangle sides
+template<>
+template<>
+void object::test<4> ()
+{
+    checkClip("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))",
+              "POLYGON ((0 0, 5 0, 5 10, 0 10, 0 0))");
+    checkClip("POLYGON ((0 0, 4 0, 5 3, 6 0, 10 0, 10 10, 0 10, 0 0))",
+              "POLYGON ((2 0, 8 0, 8 5, 2 5, 2 0))");
+    checkClip("MULTIPOLYGON (((0 0, 5 0, 5 5, 0 5, 0 0)), ((5 5, 10 5, 10 10, 5 10, 5 5)))",
+              "POLYGON ((2 2, 8 2, 8 8, 2 8, 2 2))");
+}
+
+// Polygon touching the rectangle only along its boundary
+template<>
+template<>
+void object::test<5> ()
+{
+    checkClip("POLYGON ((10 0, 20 0, 20 10, 10 10, 10 0))",
+              "POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))");
+    checkClip("POLYGON ((10 10, 20 10, 20 20, 10 20, 10 10))",
+              "POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))");
+}
+
+// Polygon which wraps around the rectangle
+template<>
+template<>
+void object::test<6> ()
+{
+    checkClip("POLYGON ((0 0, 30 0, 30 30, 0 30, 0 20, 20 20, 20 10, 0 10, 0 0))",
+              "POLYGON ((5 5, 25 5, 25 25, 5 25, 5 5))");
+    checkClip("POLYGON ((-5 -5, 35 -5, 35 35, -5 35, -5 -5), (2 2, 2 28, 28 28, 28 2, 2 2))",
+              "POLYGON ((1 1, 29 1, 29 29, 1 29, 1 1))");
+    checkClip("POLYGON ((0 0, 30 0, 30 30, 0 30, 0 0), (3 3, 3 27, 27 27, 27 3, 3 3))",
+              "POLYGON ((1 1, 29 1, 29 29, 1 29, 1 1))");
+}
+
+// Non-rectangular operands are overlaid in full
+template<>
+template<>
+void object::test<7> ()
+{
+    checkClip("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))",
+              "POLYGON ((5 5, 15 5, 15 15, 5 5))");
+    checkClip("LINESTRING (0 0, 10 10)",
+              "POLYGON ((5 5, 15 5, 15 15, 5 15, 5 5))");
+}
+
+// Curved polygon clipped by a grid of tiles
+template<>
+template<>
+void object::test<8> ()
+{
+    std::unique_ptr<Geometry> geom = r.read(
+        "POLYGON ((0 0, 100 0, 100 100, 0 100, 0 0), (20 20, 20 80, 80 80, 80 20, 20 20))");
+    std::unique_ptr<Geometry> buf = r.read("POINT (50 50)")->buffer(45, 16);
+    std::unique_ptr<Geometry> poly = buf->symDifference(geom.get());
+
+    for (int i = -1; i < 10; i++) {
+        for (int j = -1; j < 10; j++) {
+            Envelope env(i * 11.5, (i + 1) * 11.5, j * 11.5, (j + 1) * 11.5);
+            std::unique_ptr<Geometry> rect = poly->getFactory()->toGeometry(&env);
+            checkClip(poly.get(), rect.get());
+        }
+    }
+}
+
+// Rings touching inside the rectangle
+template<>
+template<>
+void object::test<9> ()
+{
+    // hole touching the shell in the interior of a shell segment
+    checkClip("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0), (5 0, 7 3, 3 3, 5 0))",
+              "POLYGON ((4 -1, 6 -1, 6 1, 4 1, 4 -1))");
+    // holes touching at a vertex
+    checkClip("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0), (2 2, 5 2, 5 5, 2 2), (5 5, 8 5, 8 8, 5 5))",
+              "POLYGON ((4 4, 6 4, 6 6, 4 6, 4 4))");
+    // self-touching shell
+    checkClip("POLYGON ((0 0, 10 0, 5 5, 10 10, 0 10, 5 5, 0 0))",
+              "POLYGON ((4 4, 6 4, 6 6, 4 6, 4 4))");
+    // polygons touching at a vertex and in the interior of a segment
+    checkClip("MULTIPOLYGON (((0 0, 5 5, 0 10, 0 0)), ((10 0, 5 5, 10 10, 10 0)))",
+              "POLYGON ((4 4, 6 4, 6 6, 4 6, 4 4))");
+    checkClip("MULTIPOLYGON (((0 0, 10 0, 5 5, 0 0)), ((5 5, 10 10, 0 10, 5 5)))",
+              "POLYGON ((4 4, 6 4, 6 6, 4 6, 4 4))");
+    checkClip("MULTIPOLYGON (((0 0, 10 0, 10 5, 0 5, 0 0)), ((5 5, 10 10, 0 10, 5 5)))",
+              "POLYGON ((4 4, 6 4, 6 6, 4 6, 4 4))");
+}
+
+} // namespace tut
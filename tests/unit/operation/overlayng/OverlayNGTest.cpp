@@ -6,6 +6,7 @@
 
 // geos
 #include <geos/operation/overlayng/OverlayNG.h>
+#include <geos/util/Arena.h>
 
 // std
 #include <memory>
@@ -582,4 +583,25 @@ void object::test<45> ()
     testOverlay(a, b, exp, OverlayNG::INTERSECTION, 0);
 }
 
+template<>
+template<>
+void object::test<46> ()
+{
+    set_test_name("testCallerSuppliedArena");
+    std::unique_ptr<Geometry> a = r.read("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0), (2 2, 2 4, 4 4, 4 2, 2 2))");
+    std::unique_ptr<Geometry> b = r.read("POLYGON ((5 5, 15 5, 15 15, 5 15, 5 5))");
+    std::unique_ptr<Geometry> expected = OverlayNG::overlay(a.get(), b.get(), OverlayNG::UNION);
+
+    geos::util::Arena arena;
+    for (int i = 0; i < 3; i++) {
+        OverlayNG ov(a.get(), b.get(), OverlayNG::UNION);
+        ov.setArena(&arena);
+        std::unique_ptr<Geometry> result = ov.getResult();
+        ensure(arena.getBytesUsed() > 0);
+        ensure(result->equalsExact(expected.get()));
+        arena.reset();
+    }
+    ensure_equals(arena.getNumBlocks(), 1u);
+}
+
 } // namespace tut
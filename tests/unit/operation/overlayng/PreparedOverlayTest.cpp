@@ -0,0 +1,224 @@
+//
+// Test Suite for geos::operation::overlayng::PreparedOverlay class.
+
+#include <tut/tut.hpp>
+#include <utility.h>
+
+// geos
+#include <geos/operation/overlayng/OverlayNG.h>
+#include <geos/operation/overlayng/OverlayNGRobust.h>
+#include <geos/operation/overlayng/PreparedOverlay.h>
+#include <geos/util/IllegalArgumentException.h>
+
+// std
+#include <memory>
+
+using namespace geos::geom;
+using namespace geos::operation::overlayng;
+using geos::io::WKTReader;
+
+namespace tut {
+//
+// Test Group
+//
+
+// Common data used by all tests
+struct test_preparedoverlay_data {
+
+    WKTReader r;
+
+    const char* maskWKT = "POLYGON ((0 0, 100 0, 100 100, 0 100, 0 0), (40 40, 40 60, 60 60, 60 40, 40 40))";
+
+    void
+    checkOverlay(const std::string& maskWkt, const std::string& wkt)
+    {
+        std::unique_ptr<Geometry> mask = r.read(maskWkt);
+        std::unique_ptr<Geometry> geom = r.read(wkt);
+        PreparedOverlay prepOverlay(*mask);
+
+        checkResult(prepOverlay.intersection(geom.get()),
+            OverlayNGRobust::Overlay(geom.get(), mask.get(), OverlayNG::INTERSECTION));
+        checkResult(prepOverlay.difference(geom.get()),
+            OverlayNGRobust::Overlay(geom.get(), mask.get(), OverlayNG::DIFFERENCE));
+    }
+
+    void
+    checkResult(std::unique_ptr<Geometry> actual, std::unique_ptr<Geometry> expected)
+    {
+        if (expected->isEmpty()) {
+            ensure("result should be empty", actual->isEmpty());
+            return;
+        }
+        ensure_equals_geometry(actual.get(), expected.get());
+    }
+
+};
+
+typedef test_group<test_preparedoverlay_data> group;
+typedef group::object object;
+
+group test_preparedoverlay_group("geos::operation::overlayng::PreparedOverlay");
+
+//
+// Test Cases
+//
+
+// Polygon crossing the mask shell
+template<>
+template<>
+void object::test<1> ()
+{
+    checkOverlay(maskWKT, "POLYGON ((90 10, 110 10, 110 20, 90 20, 90 10))");
+}
+
+// Polygon crossing the mask hole
+template<>
+template<>
+void object::test<2> ()
+{
+    checkOverlay(maskWKT, "POLYGON ((35 35, 50 35, 50 50, 35 50, 35 35))");
+}
+
+// Polygon inside the mask interior, away from the boundary
+template<>
+template<>
+void object::test<3> ()
+{
+    checkOverlay(maskWKT, "POLYGON ((10 10, 20 10, 20 20, 10 20, 10 10))");
+}
+
+// Polygon inside the mask hole
+template<>
+template<>
+void object::test<4> ()
+{
+    checkOverlay(maskWKT, "POLYGON ((45 45, 55 45, 55 55, 45 55, 45 45))");
+}
+
+// Polygon outside the mask
+template<>
+template<>
+void object::test<5> ()
+{
+    checkOverlay(maskWKT, "POLYGON ((200 200, 210 200, 210 210, 200 210, 200 200))");
+}
+
+// Lines and points
+template<>
+template<>
+void object::test<6> ()
+{
+    checkOverlay(maskWKT, "LINESTRING (30 50, 70 51)");
+    checkOverlay(maskWKT, "MULTILINESTRING ((95 95, 105 105), (10 10, 11 12))");
+    checkOverlay(maskWKT, "MULTIPOINT ((10 10), (50 50), (40 45), (150 150))");
+    checkOverlay(maskWKT, "POINT (5 5)");
+}
+
+// Geometry covering most of the mask is overlaid in full
+template<>
+template<>
+void object::test<7> ()
+{
+    checkOverlay(maskWKT, "POLYGON ((-10 -10, 50 -10, 50 110, -10 110, -10 -10))");
+}
+
+// Feature boundary collinear with mask edges
+template<>
+template<>
+void object::test<8> ()
+{
+    checkOverlay(maskWKT, "POLYGON ((90 0, 100 0, 100 10, 90 10, 90 0))");
+    checkOverlay(maskWKT, "POLYGON ((38 40, 40 40, 40 42, 38 42, 38 40))");
+}
+
+// Multipolygon mask with many small features
+template<>
+template<>
+void object::test<9> ()
+{
+    std::string mask = "MULTIPOLYGON (((0 0, 10 0, 10 10, 0 10, 0 0)), ((20 0, 30 0, 25 10, 20 0)), ((5 20, 30 20, 30 30, 5 30, 5 20), (10 22, 10 28, 20 28, 20 22, 10 22)))";
+    for (int i = 0; i < 30; i++) {
+        for (int j = 0; j < 30; j++) {
+            double x = i * 1.1 - 1;
+            double y = j * 1.1 - 1;
+            std::string wkt = "POLYGON ((" +
+                std::to_string(x) + " " + std::to_string(y) + ", " +
+                std::to_string(x + 2) + " " + std::to_string(y) + ", " +
+                std::to_string(x + 1) + " " + std::to_string(y + 2) + ", " +
+                std::to_string(x) + " " + std::to_string(y) + "))";
+            checkOverlay(mask, wkt);
+        }
+    }
+}
+
+// Lineal mask
+template<>
+template<>
+void object::test<10> ()
+{
+    std::string mask = "MULTILINESTRING ((0 0, 10 10, 20 0, 30 10, 40 0), (0 5, 40 5))";
+    checkOverlay(mask, "POLYGON ((8 2, 12 2, 12 8, 8 8, 8 2))");
+    checkOverlay(mask, "LINESTRING (9 0, 9 20)");
+    checkOverlay(mask, "POLYGON ((30 20, 35 20, 35 25, 30 25, 30 20))");
+}
+
+// Empty inputs
+template<>
+template<>
+void object::test<11> ()
+{
+    checkOverlay(maskWKT, "POLYGON EMPTY");
+    checkOverlay("POLYGON EMPTY", "POLYGON ((0 0, 1 0, 1 1, 0 0))");
+}
+
+// Unsupported operation
+template<>
+template<>
+void object::test<12> ()
+{
+    std::unique_ptr<Geometry> mask = r.read(maskWKT);
+    std::unique_ptr<Geometry> geom = r.read("POINT (1 1)");
+    PreparedOverlay prepOverlay(*mask);
+
+    try {
+        prepOverlay.overlay(geom.get(), OverlayNG::UNION);
+        fail("IllegalArgumentException expected");
+    }
+    catch (const geos::util::IllegalArgumentException&) {
+    }
+}
+
+// Clipped mask is identical to the mask within the clip envelope
+template<>
+template<>
+void object::test<13> ()
+{
+    std::unique_ptr<Geometry> mask = r.read(maskWKT);
+    PreparedOverlay prepOverlay(*mask);
+
+    Envelope env(30, 50, 30, 50);
+    std::unique_ptr<Geometry> clipped = prepOverlay.clipMask(env);
+    std::unique_ptr<Geometry> envGeom(mask->getFactory()->toGeometry(&env));
+    std::unique_ptr<Geometry> expected = mask->intersection(envGeom.get());
+
+    ensure_equals_geometry(clipped.get(), expected.get());
+}
+
+// Clipped lineal mask keeps Z and M, interpolating them at the clip boundary
+template<>
+template<>
+void object::test<14> ()
+{
+    std::unique_ptr<Geometry> mask = r.read("LINESTRING ZM (0 100 100 40, 0 0 0 10, 100 0 100 20, 200 0 0 0, 200 100 0 0, 300 100 0 0, 300 0 0 0, 400 0 0 0, 400 100 0 0)");
+    PreparedOverlay prepOverlay(*mask);
+
+    std::unique_ptr<Geometry> clipped = prepOverlay.clipMask(Envelope(-10, 50, -10, 10));
+    ensure(clipped != nullptr);
+    ensure(clipped->hasZ());
+    ensure(clipped->hasM());
+
+    std::unique_ptr<Geometry> expected = r.read("LINESTRING ZM (0 10 10 13, 0 0 0 10, 50 0 50 15)");
+    ensure_equals_exact_geometry_xyzm(clipped.get(), expected.get(), 1e-12);
+}
+
+} // namespace tut
@@ -0,0 +1,362 @@
+//
+// Test Suite for geos::operation::relateng::RelateNG class.
+
+#include <tut/tut.hpp>
+#include <utility.h>
+
+// geos
+#include <geos/geom/IntersectionMatrix.h>
+#include <geos/operation/relateng/RelateMatrixPredicate.h>
+#include <geos/operation/relateng/RelateNG.h>
+#include <geos/operation/relateng/RelatePredicate.h>
+#include <geos/operation/relateng/TopologyPredicate.h>
+
+// std
+#include <memory>
+
+using namespace geos::geom;
+using namespace geos::operation::relateng;
+using geos::io::WKTReader;
+
+namespace tut {
+//
+// Test Group
+//
+
+// Common data used by all tests
+struct test_relateng_data {
+
+    WKTReader r;
+
+    void
+    checkRelate(const std::string& wkta, const std::string& wktb, const std::string& expectedIM)
+    {
+        std::unique_ptr<Geometry> a = r.read(wkta);
+        std::unique_ptr<Geometry> b = r.read(wktb);
+        auto im = RelateNG::relate(a.get(), b.get());
+        ensure_equals("relate " + wkta + " / " + wktb, im->toString(), expectedIM);
+
+        //-- prepared mode must give the same result
+        auto prep = RelateNG::prepare(a.get());
+        ensure_equals("prepared relate", prep->evaluate(b.get())->toString(), expectedIM);
+        //-- and repeated evaluation must not be affected by cached state
+        ensure_equals("prepared relate repeat", prep->evaluate(b.get())->toString(), expectedIM);
+
+        ensure("relate pattern", RelateNG::relate(a.get(), b.get(), expectedIM));
+    }
+
+    void
+    checkPredicate(std::unique_ptr<TopologyPredicate> pred,
+                   const std::string& wkta, const std::string& wktb, bool expected)
+    {
+        std::unique_ptr<Geometry> a = r.read(wkta);
+        std::unique_ptr<Geometry> b = r.read(wktb);
+        ensure_equals(pred->name() + " " + wkta + " / " + wktb,
+                      RelateNG::relate(a.get(), b.get(), *pred), expected);
+    }
+
+    void
+    checkIntersectsDisjoint(const std::string& wkta, const std::string& wktb, bool expected)
+    {
+        checkPredicate(RelatePredicate::intersects(), wkta, wktb, expected);
+        checkPredicate(RelatePredicate::intersects(), wktb, wkta, expected);
+        checkPredicate(RelatePredicate::disjoint(), wkta, wktb, ! expected);
+        checkPredicate(RelatePredicate::disjoint(), wktb, wkta, ! expected);
+    }
+
+    void
+    checkContainsWithin(const std::string& wkta, const std::string& wktb, bool expected)
+    {
+        checkPredicate(RelatePredicate::contains(), wkta, wktb, expected);
+        checkPredicate(RelatePredicate::within(), wktb, wkta, expected);
+    }
+
+    void
+    checkCoversCoveredBy(const std::string& wkta, const std::string& wktb, bool expected)
+    {
+        checkPredicate(RelatePredicate::covers(), wkta, wktb, expected);
+        checkPredicate(RelatePredicate::coveredBy(), wktb, wkta, expected);
+    }
+
+    /**
+     * A predicate which counts the matrix updates it receives,
+     * to check that evaluation stops early.
+     */
+    class CountingPredicate : public TopologyPredicate {
+    public:
+        std::unique_ptr<TopologyPredicate> pred;
+        int count = 0;
+
+        explicit CountingPredicate(std::unique_ptr<TopologyPredicate> p) : pred(std::move(p)) {}
+
+        std::string name() const override { return pred->name(); }
+        bool requireSelfNoding() const override { return pred->requireSelfNoding(); }
+        bool requireInteraction() const override { return pred->requireInteraction(); }
+        bool requireCovers(bool isSourceA) const override { return pred->requireCovers(isSourceA); }
+        bool requireExteriorCheck(bool isSourceA) const override { return pred->requireExteriorCheck(isSourceA); }
+        void init(int dimA, int dimB) override { pred->init(dimA, dimB); }
+        void init(const Envelope& envA, const Envelope& envB) override { pred->init(envA, envB); }
+        void updateDimension(Location locA, Location locB, int dim) override
+        {
+            count++;
+            pred->updateDimension(locA, locB, dim);
+        }
+        void finish() override { pred->finish(); }
+        bool isKnown() const override { return pred->isKnown(); }
+        bool value() const override { return pred->value(); }
+    };
+};
+
+typedef test_group<test_relateng_data> group;
+typedef group::object object;
+
+group test_relateng_group("geos::operation::relateng::RelateNG");
+
+//
+// Test Cases
+//
+
+// Point / Point
+template<>
+template<>
+void object::test<1> ()
+{
+    checkRelate("MULTIPOINT ((0 0), (1 1))", "POINT (1 1)", "0F0FFFFF2");
+    checkRelate("POINT (0 0)", "POINT (1 1)", "FF0FFF0F2");
+    checkIntersectsDisjoint("POINT (0 0)", "POINT (0 0)", true);
+    checkIntersectsDisjoint("POINT (0 0)", "POINT (1 0)", false);
+}
+
+// Point / Line
+template<>
+template<>
+void object::test<2> ()
+{
+    checkRelate("POINT (5 5)", "LINESTRING (0 0, 10 10)", "0FFFFF102");
+    checkRelate("POINT (0 0)", "LINESTRING (0 0, 10 10)", "F0FFFF102");
+    checkContainsWithin("LINESTRING (0 0, 10 10)", "POINT (5 5)", true);
+    checkContainsWithin("LINESTRING (0 0, 10 10)", "POINT (0 0)", false);
+    checkCoversCoveredBy("LINESTRING (0 0, 10 10)", "POINT (0 0)", true);
+}
+
+// Line / Line
+template<>
+template<>
+void object::test<3> ()
+{
+    checkRelate("LINESTRING (0 0, 10 10)", "LINESTRING (0 10, 10 0)", "0F1FF0102");
+    checkRelate("LINESTRING (20 20, 80 80)", "LINESTRING (80 80, 20 20)", "1FFF0FFF2");
+    checkPredicate(RelatePredicate::crosses(), "LINESTRING (0 0, 10 10)", "LINESTRING (0 10, 10 0)", true);
+    checkPredicate(RelatePredicate::touches(), "LINESTRING (0 0, 10 10)", "LINESTRING (10 10, 20 0)", true);
+    checkPredicate(RelatePredicate::overlaps(), "LINESTRING (0 0, 10 0)", "LINESTRING (5 0, 15 0)", true);
+    checkPredicate(RelatePredicate::equalsTopo(), "LINESTRING (0 0, 5 0, 10 0)", "LINESTRING (10 0, 0 0)", true);
+}
+
+// Self-crossing line against one of its segments
+template<>
+template<>
+void object::test<4> ()
+{
+    checkRelate("LINESTRING (0 0, 10 10, 10 0, 0 10)", "LINESTRING (0 0, 10 10)", "101F00FF2");
+}
+
+// Line / Area
+template<>
+template<>
+void object::test<5> ()
+{
+    checkRelate("LINESTRING (5 5, 20 5)", "POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))", "1010F0212");
+    checkContainsWithin("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))", "LINESTRING (1 1, 9 9)", true);
+    checkContainsWithin("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))", "LINESTRING (0 0, 10 0)", false);
+    checkCoversCoveredBy("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))", "LINESTRING (0 0, 10 0)", true);
+    //-- line in a hole
+    checkIntersectsDisjoint("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0), (2 2, 8 2, 8 8, 2 8, 2 2))",
+                            "LINESTRING (3 3, 7 7)", false);
+}
+
+// Area / Area
+template<>
+template<>
+void object::test<6> ()
+{
+    checkRelate("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))", "POLYGON ((5 5, 15 5, 15 15, 5 15, 5 5))", "212101212");
+    checkRelate("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))", "POLYGON ((10 0, 20 0, 20 10, 10 10, 10 0))", "FF2F11212");
+    //-- polygon in hole, sharing hole edges
+    checkRelate("POLYGON ((0 200, 0 0, 200 0, 200 200, 0 200), (20 180, 130 180, 130 30, 20 30, 20 180))",
+                "POLYGON ((60 90, 130 90, 130 30, 60 30, 60 90))", "FF2F11212");
+    checkPredicate(RelatePredicate::touches(), "POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))",
+                   "POLYGON ((10 0, 20 0, 20 10, 10 10, 10 0))", true);
+    checkPredicate(RelatePredicate::equalsTopo(), "POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))",
+                   "POLYGON ((10 10, 10 0, 0 0, 0 10, 10 10))", true);
+}
+
+// Adjacent polygons in a MultiPolygon/GeometryCollection
+template<>
+template<>
+void object::test<7> ()
+{
+    //-- point on shared edge of adjacent collection polygons is in the interior of the union
+    checkContainsWithin("GEOMETRYCOLLECTION (POLYGON ((0 0, 5 0, 5 10, 0 10, 0 0)), POLYGON ((5 0, 10 0, 10 10, 5 10, 5 0)))",
+                        "POINT (5 5)", true);
+    checkContainsWithin("GEOMETRYCOLLECTION (POLYGON ((0 0, 5 0, 5 10, 0 10, 0 0)), POLYGON ((5 0, 10 0, 10 10, 5 10, 5 0)))",
+                        "LINESTRING (2 5, 8 5)", true);
+    checkContainsWithin("MULTIPOLYGON (((0 0, 5 0, 5 10, 0 10, 0 0)), ((5 0, 10 0, 10 10, 5 10, 5 0)))",
+                        "POINT (5 5)", false);
+}
+
+// Mixed-dimension collections use union semantics
+template<>
+template<>
+void object::test<8> ()
+{
+    checkContainsWithin("GEOMETRYCOLLECTION (POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0)), LINESTRING (5 5, 15 5))",
+                        "POINT (12 5)", true);
+    //-- line end inside the polygon is not part of the boundary
+    checkContainsWithin("GEOMETRYCOLLECTION (POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0)), LINESTRING (5 5, 15 5))",
+                        "POINT (5 5)", true);
+    checkPredicate(RelatePredicate::touches(),
+                   "GEOMETRYCOLLECTION (POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0)), LINESTRING (5 5, 15 5))",
+                   "POINT (15 5)", true);
+}
+
+// Empty inputs
+template<>
+template<>
+void object::test<9> ()
+{
+    checkRelate("POLYGON EMPTY", "POINT (1 1)", "FFFFFF0F2");
+    checkRelate("LINESTRING (0 0, 1 1)", "POINT EMPTY", "FF1FF0FF2");
+    checkIntersectsDisjoint("POLYGON EMPTY", "POINT (1 1)", false);
+}
+
+// Zero-length lines are treated as points
+template<>
+template<>
+void object::test<10> ()
+{
+    checkPredicate(RelatePredicate::equalsTopo(), "POINT (1 1)", "LINESTRING (1 1, 1 1)", true);
+    checkCoversCoveredBy("LINESTRING (0 0, 10 10)", "LINESTRING (5 5, 5 5)", true);
+}
+
+// Pattern matching
+template<>
+template<>
+void object::test<11> ()
+{
+    std::unique_ptr<Geometry> a = r.read("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))");
+    std::unique_ptr<Geometry> b = r.read("LINESTRING (1 1, 9 9)");
+    ensure(RelateNG::relate(a.get(), b.get(), "T*****FF*"));
+    ensure(RelateNG::relate(a.get(), b.get(), "1*2**1***"));
+    ensure(! RelateNG::relate(a.get(), b.get(), "FF*FF****"));
+    ensure(! RelateNG::relate(a.get(), b.get(), "0********"));
+
+    try {
+        RelateNG::relate(a.get(), b.get(), "T*F");
+        fail("expected IllegalArgumentException");
+    }
+    catch (const geos::util::IllegalArgumentException&) {}
+}
+
+// Evaluation stops once the predicate value is known
+template<>
+template<>
+void object::test<12> ()
+{
+    std::unique_ptr<Geometry> a = r.read("POLYGON ((0 0, 100 0, 100 100, 0 100, 0 0))");
+    std::unique_ptr<Geometry> b = r.read("MULTIPOINT ((200 200), (50 50), (60 60), (70 70), (80 80))");
+
+    CountingPredicate disjoint(RelatePredicate::disjoint());
+    ensure(! RelateNG::relate(a.get(), b.get(), disjoint));
+
+    CountingPredicate full(std::unique_ptr<TopologyPredicate>(new RelateMatrixPredicate()));
+    RelateNG::relate(a.get(), b.get(), full);
+    ensure(disjoint.count < full.count);
+
+    //-- envelope disjoint: no topology is computed at all
+    std::unique_ptr<Geometry> c = r.read("POINT (500 500)");
+    CountingPredicate intersects(RelatePredicate::intersects());
+    ensure(! RelateNG::relate(a.get(), c.get(), intersects));
+    ensure_equals(intersects.count, 0);
+}
+
+// Prepared mode reused against many geometries
+template<>
+template<>
+void object::test<13> ()
+{
+    std::unique_ptr<Geometry> a = r.read("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0), (2 2, 8 2, 8 8, 2 8, 2 2))");
+    auto prep = RelateNG::prepare(a.get());
+
+    std::unique_ptr<Geometry> inHole = r.read("POINT (5 5)");
+    std::unique_ptr<Geometry> inArea = r.read("POINT (1 5)");
+    std::unique_ptr<Geometry> crossing = r.read("LINESTRING (-5 5, 15 5)");
+    std::unique_ptr<Geometry> onBoundary = r.read("LINESTRING (2 2, 8 2)");
+
+    ensure(! prep->intersects(inHole.get()));
+    ensure(prep->contains(inArea.get()));
+    ensure(prep->crosses(crossing.get()));
+    ensure(prep->intersects(crossing.get()));
+    ensure(prep->touches(onBoundary.get()));
+    ensure(prep->covers(onBoundary.get()));
+    ensure(! prep->contains(onBoundary.get()));
+    ensure_equals(prep->evaluate(crossing.get())->toString(), "1F20F1102");
+}
+
+// Pattern evaluation is short-circuited as soon as the result is decided
+template<>
+template<>
+void object::test<14> ()
+{
+    std::unique_ptr<Geometry> a = r.read("POLYGON ((0 0, 100 0, 100 100, 0 100, 0 0))");
+    std::unique_ptr<Geometry> b = r.read("MULTIPOINT ((10 10), (20 20), (30 30), (40 40), (200 200))");
+
+    CountingPredicate full(std::unique_ptr<TopologyPredicate>(new RelateMatrixPredicate()));
+    RelateNG::relate(a.get(), b.get(), full);
+
+    //-- false as soon as an F entry is exceeded, even if T entries are still unknown
+    CountingPredicate isFalse(RelatePredicate::matches("T*F******"));
+    ensure(! RelateNG::relate(a.get(), b.get(), isFalse));
+    ensure(isFalse.count < full.count);
+
+    //-- true as soon as all T entries are known
+    CountingPredicate isTrue(RelatePredicate::matches("T********"));
+    ensure(RelateNG::relate(a.get(), b.get(), isTrue));
+    ensure(isTrue.count < full.count);
+
+    //-- an unconstrained pattern needs no topology
+    CountingPredicate any(RelatePredicate::matches("*********"));
+    ensure(RelateNG::relate(a.get(), b.get(), any));
+    ensure_equals(any.count, 0);
+
+    //-- input dimensions cannot provide a 2-dimensional interior intersection
+    CountingPredicate dims(RelatePredicate::matches("2********"));
+    ensure(! RelateNG::relate(a.get(), b.get(), dims));
+    ensure_equals(dims.count, 0);
+}
+
+// Pattern evaluation agrees with the full matrix
+template<>
+template<>
+void object::test<15> ()
+{
+    std::unique_ptr<Geometry> a = r.read("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0), (2 2, 8 2, 8 8, 2 8, 2 2))");
+    std::unique_ptr<Geometry> empty = r.read("POINT EMPTY");
+    std::unique_ptr<Geometry> outside = r.read("LINESTRING (20 0, 30 10)");
+    std::unique_ptr<Geometry> onHole = r.read("LINESTRING (2 2, 8 2, 8 20)");
+    auto prep = RelateNG::prepare(a.get());
+
+    //-- pattern implying cover must still accept an empty target
+    ensure(prep->evaluate(empty.get(), "******FF*"));
+    ensure(! prep->evaluate(empty.get(), "T*****FF*"));
+    //-- envelope not covered
+    ensure(! prep->evaluate(outside.get(), "T*****FF*"));
+    ensure(prep->evaluate(outside.get(), "FF*FF****"));
+    //-- exterior entries are computed only when the pattern requires them
+    ensure(! prep->evaluate(onHole.get(), "F***T****"));
+    ensure(prep->evaluate(onHole.get(), "T***T****"));
+    ensure(prep->evaluate(onHole.get(), "1*21*1*0*"));
+    ensure(! prep->evaluate(onHole.get(), "1*21*1*F*"));
+    ensure_equals(prep->evaluate(onHole.get())->toString(), "1F2101102");
+}
+
+} // namespace tut
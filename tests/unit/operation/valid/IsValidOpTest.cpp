@@ -55,6 +55,30 @@ struct test_isvalidop_data {
         ensure(!g->isValid());
     }
 
+    void checkParallel(int errExpected, const char* wkt, bool isInvertedRingValid = false)
+    {
+        std::string wktstr(wkt);
+        auto geom = wktreader.read(wktstr);
+        IsValidOp serialOp(geom.get());
+        serialOp.setSelfTouchingRingFormingHoleValid(isInvertedRingValid);
+        bool isValidSerial = serialOp.isValid();
+        ensure_equals("serial validity", isValidSerial, errExpected < 0);
+
+        for (std::size_t numThreads : { 2u, 3u, 8u, 0u }) {
+            IsValidOp validOp(geom.get());
+            validOp.setSelfTouchingRingFormingHoleValid(isInvertedRingValid);
+            validOp.setNumThreads(numThreads);
+            const TopologyValidationError* err = validOp.getValidationError();
+            if (errExpected < 0) {
+                ensure("parallel result should be valid", err == nullptr);
+            }
+            else {
+                ensure("parallel result should be invalid", err != nullptr);
+                ensure_equals("error codes do not match", err->getErrorType(), errExpected);
+            }
+        }
+    }
+
     void checkInvalid(int errExpected, const char* wkt)
     {
         std::string wktstr(wkt);
@@ -398,4 +422,78 @@ void object::test<28> ()
 }
 
 
+// Parallel validation of MultiPolygons
+template<>
+template<>
+void object::test<30> ()
+{
+    //-- valid: polygons touching at points, polygon inside a hole
+    checkParallel(-1,
+        "MULTIPOLYGON (((0 0, 10 0, 10 10, 0 10, 0 0), (2 2, 2 8, 8 8, 8 2, 2 2)), ((10 10, 20 10, 20 20, 10 20, 10 10)), ((3 3, 7 3, 7 7, 3 7, 3 3)), ((20 0, 30 0, 30 10, 20 10, 20 0)))");
+    //-- invalid polygon component
+    checkParallel(TopologyValidationError::eSelfIntersection,
+        "MULTIPOLYGON (((0 0, 10 0, 10 10, 0 10, 0 0)), ((20 0, 30 10, 30 0, 20 10, 20 0)))");
+    checkParallel(TopologyValidationError::eHoleOutsideShell,
+        "MULTIPOLYGON (((0 0, 10 0, 10 10, 0 10, 0 0)), ((20 0, 30 0, 30 10, 20 10, 20 0), (40 1, 40 2, 41 2, 40 1)))");
+    //-- components crossing
+    checkParallel(TopologyValidationError::eSelfIntersection,
+        "MULTIPOLYGON (((0 0, 10 0, 10 10, 0 10, 0 0)), ((20 0, 30 0, 30 10, 20 10, 20 0)), ((5 5, 15 5, 15 15, 5 15, 5 5)))");
+    //-- components sharing an edge
+    checkParallel(TopologyValidationError::eSelfIntersection,
+        "MULTIPOLYGON (((0 0, 10 0, 10 10, 0 10, 0 0)), ((10 0, 20 0, 20 10, 10 10, 10 0)))");
+    //-- nested shells
+    checkParallel(TopologyValidationError::eNestedShells,
+        "MULTIPOLYGON (((0 0, 10 0, 10 10, 0 10, 0 0)), ((20 0, 30 0, 30 10, 20 10, 20 0)), ((2 2, 8 2, 8 8, 2 8, 2 2)))");
+    //-- nested shell touching outer shell at a vertex
+    checkParallel(TopologyValidationError::eNestedShells,
+        "MULTIPOLYGON (((0 0, 10 0, 10 10, 0 10, 0 0)), ((0 0, 8 2, 8 8, 2 8, 0 0)))");
+}
+
+// Parallel validation reports the error of the first invalid polygon
+template<>
+template<>
+void object::test<31> ()
+{
+    std::string wkt = "MULTIPOLYGON (";
+    for (int i = 0; i < 100; i++) {
+        int x = 20 * i;
+        if (i > 0) wkt += ", ";
+        //-- self-crossing polygons at 40 and 70
+        if (i == 40 || i == 70)
+            wkt += "((" + std::to_string(x) + " 0, " + std::to_string(x + 10) + " 10, "
+                + std::to_string(x + 10) + " 0, " + std::to_string(x) + " 10, " + std::to_string(x) + " 0))";
+        else
+            wkt += "((" + std::to_string(x) + " 0, " + std::to_string(x + 10) + " 0, "
+                + std::to_string(x + 10) + " 10, " + std::to_string(x) + " 10, " + std::to_string(x) + " 0))";
+    }
+    wkt += ")";
+    auto geom = wktreader.read(wkt);
+
+    ensure(! IsValidOp::isValid(geom.get()));
+
+    for (std::size_t numThreads : { 2u, 4u, 16u }) {
+        IsValidOp validOp(geom.get());
+        validOp.setNumThreads(numThreads);
+        const TopologyValidationError* err = validOp.getValidationError();
+        ensure(err != nullptr);
+        ensure_equals(err->getErrorType(), static_cast<int>(TopologyValidationError::eSelfIntersection));
+        ensure_equals(err->getCoordinate().x, 805.0);
+        ensure_equals(err->getCoordinate().y, 5.0);
+    }
+}
+
+// Parallel validation of MultiPolygons with inverted rings
+template<>
+template<>
+void object::test<32> ()
+{
+    const char* wkt = "MULTIPOLYGON (((0 0, 10 0, 10 10, 5 10, 7 5, 3 5, 5 10, 0 10, 0 0)), ((20 0, 30 0, 30 10, 20 10, 20 0)))";
+    checkParallel(-1, wkt, true);
+    checkParallel(TopologyValidationError::eRingSelfIntersection, wkt, false);
+
+    //-- inverted ring crossing another polygon
+    checkParallel(TopologyValidationError::eSelfIntersection,
+        "MULTIPOLYGON (((0 0, 10 0, 10 10, 5 10, 7 5, 3 5, 5 10, 0 10, 0 0)), ((4 4, 6 4, 6 12, 4 12, 4 4)))", true);
+}
+
 } // namespace tut
@@ -11,6 +11,7 @@
 #include <geos/triangulate/quadedge/QuadEdgeSubdivision.h>
 #include <geos/triangulate/IncrementalDelaunayTriangulator.h>
 #include <geos/triangulate/DelaunayTriangulationBuilder.h>
+#include <geos/triangulate/quadedge/TriangleVisitor.h>
 //#include <geos/io/WKTWriter.h>
 #include <geos/io/WKTReader.h>
 #include <geos/geom/GeometryCollection.h>
@@ -18,6 +19,8 @@
 #include <geos/geom/CoordinateSequence.h>
 //#include <stdio.h>
 
+#include <random>
+
 using namespace geos::triangulate;
 using namespace geos::triangulate::quadedge;
 using namespace geos::geom;
@@ -370,4 +373,154 @@ void object::test<20>()
     checkDelaunayHull(wkt);
 }
 
+// Randomized insertion produces the same triangulation as sorted insertion
+template<>
+template<>
+void object::test<21>()
+{
+    std::mt19937 eng(42);
+    std::uniform_real_distribution<double> dist(0, 1000);
+    CoordinateSequence sites;
+    for (int i = 0; i < 5000; i++) {
+        sites.add(Coordinate(dist(eng), dist(eng)));
+    }
+    const GeometryFactory& geomFact(*GeometryFactory::getDefaultInstance());
+
+    DelaunayTriangulationBuilder builder;
+    builder.setSites(sites);
+    auto expected = builder.getTriangles(geomFact);
+
+    DelaunayTriangulationBuilder randBuilder;
+    randBuilder.setRandomizedInsertion(true);
+    randBuilder.setSites(sites);
+    auto actual = randBuilder.getTriangles(geomFact);
+
+    ensure_equals(actual->getNumGeometries(), expected->getNumGeometries());
+    expected->normalize();
+    actual->normalize();
+    ensure(actual->equalsExact(expected.get()));
+}
+
+// Randomized insertion of narrow and collinear inputs
+template<>
+template<>
+void object::test<22>()
+{
+    const char* wkts[] = {
+        "MULTIPOINT ((2 204), (3 66), (1 96), (0 236), (3 173), (2 114), (3 201), (0 46), (1 181))",
+        "MULTIPOINT ((584245.72096874 7549593.72686167), (584251.71398371 7549594.01629478), (584242.72446125 7549593.58214511), (584230.73978847 7549592.9760418), (584233.73581213 7549593.13045099), (584236.7318358 7549593.28486019), (584239.72795377 7549593.43742855), (584227.74314188 7549592.83423486))",
+        "LINESTRING (0 0, 1 0, 2 0, 3 0, 4 0, 5 0, 6 0, 7 0, 8 0, 9 0, 9 1, 9 2, 9 3)"
+    };
+    const GeometryFactory& geomFact(*GeometryFactory::getDefaultInstance());
+    WKTReader reader;
+
+    for (const char* wkt : wkts) {
+        auto sites = reader.read(wkt);
+
+        DelaunayTriangulationBuilder builder;
+        builder.setRandomizedInsertion(true);
+        builder.setSites(*sites);
+        auto tris = builder.getTriangles(geomFact);
+
+        std::unique_ptr<Geometry> hullTris = geos::coverage::CoverageUnion::Union(tris.get());
+        std::unique_ptr<Geometry> hullSites = sites->convexHull();
+        ensure(wkt, hullTris->equals(hullSites.get()));
+    }
+}
+
+// Triangles as vertex indices, and via a visitor
+template<>
+template<>
+void object::test<23>()
+{
+    WKTReader reader;
+    auto sites = reader.read("MULTIPOINT ((10 10), (0 0), (10 0), (0 10), (4 6))");
+    const GeometryFactory& geomFact(*GeometryFactory::getDefaultInstance());
+
+    DelaunayTriangulationBuilder builder;
+    builder.setSites(*sites);
+    auto tris = builder.getTriangles(geomFact);
+
+    std::vector<std::size_t> indices = builder.getTriangleIndices();
+    const CoordinateSequence* siteCoords = builder.getSiteCoordinates();
+    ensure_equals(siteCoords->size(), 5u);
+    ensure_equals(indices.size(), 3 * tris->getNumGeometries());
+
+    std::vector<std::unique_ptr<Geometry>> polys;
+    for (std::size_t i = 0; i < indices.size(); i += 3) {
+        CoordinateSequence ring;
+        ring.add(siteCoords->getAt(indices[i]));
+        ring.add(siteCoords->getAt(indices[i + 1]));
+        ring.add(siteCoords->getAt(indices[i + 2]));
+        ring.add(siteCoords->getAt(indices[i]));
+        polys.push_back(geomFact.createPolygon(geomFact.createLinearRing(std::move(ring))));
+    }
+    auto indexedTris = geomFact.createGeometryCollection(std::move(polys));
+    ensure(indexedTris->equalsExact(tris.get()));
+
+    struct CountVisitor : public TriangleVisitor {
+        std::size_t count = 0;
+        void visit(std::array<QuadEdge*, 3>&) override {
+            count++;
+        }
+    } visitor;
+    builder.visitTriangles(visitor);
+    ensure_equals(visitor.count, tris->getNumGeometries());
+
+    DelaunayTriangulationBuilder emptyBuilder;
+    emptyBuilder.setSites(*reader.read("MULTIPOINT EMPTY"));
+    ensure(emptyBuilder.getTriangleIndices().empty());
+    emptyBuilder.visitTriangles(visitor);
+}
+
+// Sorted input, inserted in the default (non-randomized) order
+template<>
+template<>
+void object::test<24>()
+{
+    const char* wkt = "MULTIPOINT ((0 0), (1 3), (2 1), (3 4), (4 2), (5 5), (6 0), (7 3))";
+    const char* expected = "GEOMETRYCOLLECTION (POLYGON ((4 2, 7 3, 6 0, 4 2)), POLYGON ((4 2, 5 5, 7 3, 4 2)), POLYGON ((3 4, 5 5, 4 2, 3 4)), POLYGON ((2 1, 4 2, 6 0, 2 1)), POLYGON ((2 1, 3 4, 4 2, 2 1)), POLYGON ((1 3, 3 4, 2 1, 1 3)), POLYGON ((0 0, 2 1, 6 0, 0 0)), POLYGON ((0 0, 1 3, 2 1, 0 0)))";
+    runDelaunay(wkt, true, expected);
+}
+
+// Cocircular input on a grid, inserted in the default (non-randomized) order
+template<>
+template<>
+void object::test<25>()
+{
+    const char* wkt = "MULTIPOINT ((0 0), (1 0), (2 0), (3 0), (0 1), (1 1), (2 1), (3 1), (0 2), (1 2), (2 2), (3 2), (0 3), (1 3), (2 3), (3 3))";
+    const char* expected = "GEOMETRYCOLLECTION (POLYGON ((2 3, 3 3, 3 2, 2 3)), POLYGON ((2 2, 3 2, 3 1, 2 2)), POLYGON ((2 2, 2 3, 3 2, 2 2)), POLYGON ((2 1, 3 1, 3 0, 2 1)), POLYGON ((2 1, 2 2, 3 1, 2 1)), POLYGON ((2 0, 2 1, 3 0, 2 0)), POLYGON ((1 3, 2 3, 2 2, 1 3)), POLYGON ((1 2, 2 2, 2 1, 1 2)), POLYGON ((1 2, 1 3, 2 2, 1 2)), POLYGON ((1 1, 2 1, 2 0, 1 1)), POLYGON ((1 1, 1 2, 2 1, 1 1)), POLYGON ((1 0, 1 1, 2 0, 1 0)), POLYGON ((0 3, 1 3, 1 2, 0 3)), POLYGON ((0 2, 1 2, 1 1, 0 2)), POLYGON ((0 2, 0 3, 1 2, 0 2)), POLYGON ((0 1, 1 1, 1 0, 0 1)), POLYGON ((0 1, 0 2, 1 1, 0 1)), POLYGON ((0 0, 0 1, 1 0, 0 0)))";
+    runDelaunay(wkt, true, expected);
+}
+
+// Cocircular input around a center point, inserted in the default (non-randomized) order
+template<>
+template<>
+void object::test<26>()
+{
+    const char* wkt = "MULTIPOINT ((10 0), (7.0710678118654755 7.0710678118654755), (0 10), (-7.0710678118654755 7.0710678118654755), (-10 0), (-7.0710678118654755 -7.0710678118654755), (0 -10), (7.0710678118654755 -7.0710678118654755), (0 0))";
+    const char* expected = "GEOMETRYCOLLECTION (POLYGON ((0 0, 10 0, 7.0710678118654755 -7.0710678118654755, 0 0)), POLYGON ((0 0, 7.0710678118654755 7.0710678118654755, 10 0, 0 0)), POLYGON ((0 0, 0 10, 7.0710678118654755 7.0710678118654755, 0 0)), POLYGON ((0 -10, 0 0, 7.0710678118654755 -7.0710678118654755, 0 -10)), POLYGON ((-7.0710678118654755 7.0710678118654755, 0 10, 0 0, -7.0710678118654755 7.0710678118654755)), POLYGON ((-7.0710678118654755 -7.0710678118654755, 0 0, 0 -10, -7.0710678118654755 -7.0710678118654755)), POLYGON ((-10 0, 0 0, -7.0710678118654755 -7.0710678118654755, -10 0)), POLYGON ((-10 0, -7.0710678118654755 7.0710678118654755, 0 0, -10 0)))";
+    runDelaunay(wkt, true, expected);
+}
+
+// Collinear input with sites falling on existing edges, inserted in the default (non-randomized) order
+template<>
+template<>
+void object::test<27>()
+{
+    const char* wkt = "MULTIPOINT ((0 0), (10 0), (5 0), (2.5 0), (7.5 0), (5 5), (5 -5))";
+    const char* expected = "GEOMETRYCOLLECTION (POLYGON ((5 5, 10 0, 7.5 0, 5 5)), POLYGON ((5 0, 5 5, 7.5 0, 5 0)), POLYGON ((5 -5, 7.5 0, 10 0, 5 -5)), POLYGON ((5 -5, 5 0, 7.5 0, 5 -5)), POLYGON ((2.5 0, 5 5, 5 0, 2.5 0)), POLYGON ((2.5 0, 5 0, 5 -5, 2.5 0)), POLYGON ((0 0, 5 5, 2.5 0, 0 0)), POLYGON ((0 0, 2.5 0, 5 -5, 0 0)))";
+    runDelaunay(wkt, true, expected);
+}
+
+// Collinear input with a single off-line site, inserted in the default (non-randomized) order
+template<>
+template<>
+void object::test<28>()
+{
+    const char* wkt = "MULTIPOINT ((0 0), (1 1), (2 2), (3 3), (4 4), (2 5))";
+    const char* expected = "GEOMETRYCOLLECTION (POLYGON ((2 5, 4 4, 3 3, 2 5)), POLYGON ((2 2, 2 5, 3 3, 2 2)), POLYGON ((1 1, 2 5, 2 2, 1 1)), POLYGON ((0 0, 2 5, 1 1, 0 0)))";
+    runDelaunay(wkt, true, expected);
+}
+
 } // namespace tut
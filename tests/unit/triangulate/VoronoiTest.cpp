@@ -21,6 +21,7 @@
 
 //#include <stdio.h>
 #include <iostream>
+#include <random>
 using namespace geos::triangulate;
 using namespace geos::triangulate::quadedge;
 using namespace geos::geom;
@@ -341,4 +342,76 @@ void object::test<15>
     runVoronoi(wkt, expected, 0, false, false);
 }
 
+// Randomized insertion produces the same diagram as sorted insertion
+template<>
+template<>
+void object::test<16>
+()
+{
+    std::mt19937 eng(42);
+    std::uniform_real_distribution<double> dist(0, 1000);
+    CoordinateSequence sites;
+    for (int i = 0; i < 5000; i++) {
+        sites.add(Coordinate(dist(eng), dist(eng)));
+    }
+    const GeometryFactory& geomFact(*GeometryFactory::getDefaultInstance());
+
+    VoronoiDiagramBuilder builder;
+    builder.setSites(sites);
+    auto expected = builder.getDiagram(geomFact);
+
+    VoronoiDiagramBuilder randBuilder;
+    randBuilder.setRandomizedInsertion(true);
+    randBuilder.setSites(sites);
+    auto actual = randBuilder.getDiagram(geomFact);
+
+    ensure_equals(actual->getNumGeometries(), expected->getNumGeometries());
+    expected->normalize();
+    actual->normalize();
+    ensure(actual->equalsExact(expected.get()));
+}
+
+// Visiting cells gives the same cells as getDiagram
+template<>
+template<>
+void object::test<17>
+()
+{
+    WKTReader reader;
+    auto sites = reader.read("MULTIPOINT ((150 200), (180 270), (275 163), (200 200), (280 300))");
+    Envelope clip(0, 300, 0, 300);
+    const GeometryFactory& geomFact(*GeometryFactory::getDefaultInstance());
+
+    VoronoiDiagramBuilder builder;
+    builder.setSites(*sites);
+    builder.setClipEnvelope(&clip);
+    auto expected = builder.getDiagram(geomFact);
+
+    VoronoiDiagramBuilder visitBuilder;
+    visitBuilder.setSites(*sites);
+    visitBuilder.setClipEnvelope(&clip);
+    std::vector<std::unique_ptr<Geometry>> cells;
+    visitBuilder.visitDiagram(geomFact, [&](const CoordinateXY& site, std::unique_ptr<Geometry> cell) {
+        ensure(cell->getUserData() == nullptr);
+        ensure(cell->contains(geomFact.createPoint(site).get()));
+        cells.push_back(std::move(cell));
+    });
+    auto actual = geomFact.createGeometryCollection(std::move(cells));
+
+    expected->normalize();
+    actual->normalize();
+    ensure(actual->equalsExact(expected.get()));
+}
+
+// Cocircular grid input
+template<>
+template<>
+void object::test<18>
+()
+{
+    const char* wkt = "MULTIPOINT ((0 0), (1 0), (2 0), (3 0), (0 1), (1 1), (2 1), (3 1), (0 2), (1 2), (2 2), (3 2), (0 3), (1 3), (2 3), (3 3))";
+    const char* expected = "GEOMETRYCOLLECTION (POLYGON ((2.5 2.5, 2.5 6, 6 6, 6 2.5, 2.5 2.5)), POLYGON ((2.5 1.5, 2.5 2.5, 6 2.5, 6 1.5, 2.5 1.5)), POLYGON ((2.5 0.5, 2.5 1.5, 6 1.5, 6 0.5, 2.5 0.5)), POLYGON ((2.5 -3, 2.5 0.5, 6 0.5, 6 -3, 2.5 -3)), POLYGON ((1.5 2.5, 1.5 6, 2.5 6, 2.5 2.5, 1.5 2.5)), POLYGON ((1.5 1.5, 1.5 2.5, 2.5 2.5, 2.5 1.5, 1.5 1.5)), POLYGON ((1.5 0.5, 1.5 1.5, 2.5 1.5, 2.5 0.5, 1.5 0.5)), POLYGON ((1.5 -3, 1.5 0.5, 2.5 0.5, 2.5 -3, 1.5 -3)), POLYGON ((0.5 2.5, 0.5 6, 1.5 6, 1.5 2.5, 0.5 2.5)), POLYGON ((0.5 1.5, 0.5 2.5, 1.5 2.5, 1.5 1.5, 0.5 1.5)), POLYGON ((0.5 0.5, 0.5 1.5, 1.5 1.5, 1.5 0.5, 0.5 0.5)), POLYGON ((0.5 -3, 0.5 0.5, 1.5 0.5, 1.5 -3, 0.5 -3)), POLYGON ((-3 2.5, -3 6, 0.5 6, 0.5 2.5, -3 2.5)), POLYGON ((-3 1.5, -3 2.5, 0.5 2.5, 0.5 1.5, -3 1.5)), POLYGON ((-3 0.5, -3 1.5, 0.5 1.5, 0.5 0.5, -3 0.5)), POLYGON ((-3 -3, -3 0.5, 0.5 0.5, 0.5 -3, -3 -3)))";
+    runVoronoi(wkt, expected, 0);
+}
+
 } // namespace tut
@@ -161,4 +161,45 @@ template<> template<> void object::test<3>
     }
 }
 
+// Vertices are owned by the subdivision and shared by the edges at a site
+template<> template<> void object::test<4>
+()
+{
+    Envelope env(0, 10, 0, 10);
+    QuadEdgeSubdivision subdiv(env, 0);
+    {
+        // vertices go out of scope after insertion
+        IncrementalDelaunayTriangulator::VertexList vertices {
+            Vertex(0, 0), Vertex(10, 0), Vertex(10, 10), Vertex(0, 10), Vertex(4, 6)
+        };
+        IncrementalDelaunayTriangulator triangulator(&subdiv);
+        triangulator.insertSites(vertices);
+    }
+
+    auto edges = subdiv.getVertexUniqueEdges(false);
+    ensure_equals(edges->size(), 5u);
+    for(const QuadEdge* qe : *edges) {
+        const QuadEdge* e = qe;
+        do {
+            ensure(&e->orig() == &qe->orig());
+            e = &e->oNext();
+        }
+        while(e != qe);
+    }
+
+    const GeometryFactory& geomFact(*GeometryFactory::getDefaultInstance());
+    std::unique_ptr<Geometry> tris = subdiv.getTriangles(geomFact);
+    std::unique_ptr<Geometry> expectedTris(reader.read(
+        "GEOMETRYCOLLECTION (POLYGON ((0 10, 0 0, 4 6, 0 10)), POLYGON ((0 10, 4 6, 10 10, 0 10)), POLYGON ((0 0, 10 0, 4 6, 0 0)), POLYGON ((4 6, 10 0, 10 10, 4 6)))"));
+    tris->normalize();
+    expectedTris->normalize();
+    ensure(tris->toString(), tris->equalsExact(expectedTris.get()));
+
+    // repeated Voronoi computation gives the same result
+    std::unique_ptr<Geometry> cells1 = subdiv.getVoronoiDiagram(geomFact);
+    std::unique_ptr<Geometry> cells2 = subdiv.getVoronoiDiagram(geomFact);
+    ensure(cells1->equalsExact(cells2.get()));
+    ensure_equals(cells1->getNumGeometries(), 5u);
+}
+
 } // namespace tut
@@ -148,6 +148,35 @@ void object::test<3>
     ensure(r0->dest().equals(u0->dest()));
     ensure(u0->orig().equals(q0->dest()));
 }
+
+// 4 - QuadEdge::makeEdge() and connect() copy the vertices
+template<>
+template<>
+void object::test<4>
+()
+{
+    std::deque<QuadEdgeQuartet> edges;
+    QuadEdge* q0;
+    QuadEdge* r0;
+    {
+        Vertex v1(0, 0);
+        Vertex v2(0, 1);
+        Vertex v3(1, 0);
+        Vertex v4(1, 1);
+        q0 = QuadEdge::makeEdge(v1, v2, edges);
+        r0 = QuadEdge::makeEdge(v3, v4, edges);
+        v1 = Vertex(9, 9);
+        v2 = Vertex(9, 9);
+    }
+    ensure(q0->orig().equals(Vertex(0, 0)));
+    ensure(q0->dest().equals(Vertex(0, 1)));
+    ensure(r0->dest().equals(Vertex(1, 1)));
+
+    auto s0 = QuadEdge::connect(*q0, *r0, edges);
+    ensure(&s0->orig() != &q0->dest());
+    ensure(s0->orig().equals(Vertex(0, 1)));
+    ensure(s0->dest().equals(Vertex(1, 0)));
+}
 } // namespace tut
 
 
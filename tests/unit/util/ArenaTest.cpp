@@ -0,0 +1,161 @@
+//
+// Test Suite for geos::util::Arena class.
+
+// tut
+#include <tut/tut.hpp>
+// geos
+#include <geos/util/Arena.h>
+// std
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+using geos::util::Arena;
+using geos::util::ArenaAllocator;
+
+namespace tut {
+//
+// Test Group
+//
+
+struct test_arena_data {
+};
+
+typedef test_group<test_arena_data> group;
+typedef group::object object;
+
+group test_arena_group("geos::util::Arena");
+
+//
+// Test Cases
+//
+
+// Allocations respect the requested alignment
+template<>
+template<>
+void object::test<1>
+()
+{
+    Arena arena(64);
+
+    for (std::size_t i = 0; i < 100; i++) {
+        arena.allocate(1, 1);
+        void* p8 = arena.allocate(8, 8);
+        void* p16 = arena.allocate(24, 16);
+        ensure_equals(reinterpret_cast<std::uintptr_t>(p8) % 8, 0u);
+        ensure_equals(reinterpret_cast<std::uintptr_t>(p16) % 16, 0u);
+    }
+
+    ensure_equals(arena.getBytesUsed(), 100u * 33u);
+    ensure(arena.getNumBlocks() > 1);
+}
+
+// Reset consolidates blocks and reuses memory
+template<>
+template<>
+void object::test<2>
+()
+{
+    Arena arena(128);
+    for (std::size_t i = 0; i < 1000; i++) {
+        arena.allocate(16);
+    }
+    std::size_t capacity = arena.getCapacity();
+    ensure(capacity >= 16000u);
+
+    arena.reset();
+    ensure_equals(arena.getBytesUsed(), 0u);
+    ensure_equals(arena.getNumBlocks(), 1u);
+    ensure_equals(arena.getCapacity(), capacity);
+
+    // same workload fits in the retained block
+    for (std::size_t i = 0; i < 1000; i++) {
+        arena.allocate(16);
+    }
+    ensure_equals(arena.getNumBlocks(), 1u);
+
+    arena.release();
+    ensure_equals(arena.getNumBlocks(), 0u);
+    ensure_equals(arena.getCapacity(), 0u);
+}
+
+// Allocation larger than the block size
+template<>
+template<>
+void object::test<3>
+()
+{
+    Arena arena(16);
+    char* p = static_cast<char*>(arena.allocate(1000));
+    for (std::size_t i = 0; i < 1000; i++) {
+        p[i] = 'x';
+    }
+    ensure(arena.getCapacity() >= 1000u);
+}
+
+// ArenaAllocator backs standard containers
+template<>
+template<>
+void object::test<4>
+()
+{
+    Arena arena;
+
+    {
+        std::deque<int, ArenaAllocator<int>> d{ArenaAllocator<int>(&arena)};
+        std::vector<double, ArenaAllocator<double>> v{ArenaAllocator<double>(&arena)};
+        for (int i = 0; i < 10000; i++) {
+            d.push_back(i);
+            v.push_back(i);
+        }
+        ensure_equals(d.back(), 9999);
+        ensure_equals(v[5000], 5000.0);
+        ensure(arena.getBytesUsed() > 0);
+    }
+
+    arena.reset();
+    ensure_equals(arena.getBytesUsed(), 0u);
+}
+
+// ArenaAllocator with no arena uses the heap
+template<>
+template<>
+void object::test<5>
+()
+{
+    std::vector<int, ArenaAllocator<int>> v;
+    for (int i = 0; i < 1000; i++) {
+        v.push_back(i);
+    }
+    ensure_equals(v.size(), 1000u);
+    ensure(v.get_allocator().getArena() == nullptr);
+}
+
+// Reset frees memory above the retained size
+template<>
+template<>
+void object::test<6>
+()
+{
+    Arena arena(128);
+    for (std::size_t i = 0; i < 100; i++) {
+        arena.allocate(16);
+    }
+    std::size_t capacity = arena.getCapacity();
+
+    arena.reset(capacity);
+    ensure_equals(arena.getCapacity(), capacity);
+
+    for (std::size_t i = 0; i < 1000; i++) {
+        arena.allocate(16);
+    }
+    arena.reset(capacity);
+    ensure_equals(arena.getNumBlocks(), 0u);
+
+    // growth restarts from the initial block size
+    arena.allocate(16);
+    ensure_equals(arena.getCapacity(), 128u);
+}
+
+} // namespace tut
+
@@ -0,0 +1,179 @@
+//
+// Test Suite for geos::util::SmallVector class.
+
+// tut
+#include <tut/tut.hpp>
+// geos
+#include <geos/util/SmallVector.h>
+// std
+#include <utility>
+#include <vector>
+
+using geos::util::SmallVector;
+
+namespace tut {
+//
+// Test Group
+//
+
+struct test_smallvector_data {
+    typedef SmallVector<double, 4> Vector;
+
+    static std::vector<double>
+    toStd(const Vector& v)
+    {
+        return std::vector<double>(v.begin(), v.end());
+    }
+};
+
+typedef test_group<test_smallvector_data> group;
+typedef group::object object;
+
+group test_smallvector_group("geos::util::SmallVector");
+
+//
+// Test Cases
+//
+
+// Elements are stored inline up to the inline capacity
+template<>
+template<>
+void object::test<1>
+()
+{
+    Vector v(3);
+    ensure(v.isInline());
+    ensure_equals(v.size(), 3u);
+    ensure(toStd(v) == std::vector<double>({ 0, 0, 0 }));
+
+    double more[] = { 1, 2 };
+    v.insert(v.end(), more, more + 1);
+    ensure(v.isInline());
+
+    v.insert(v.end(), more, more + 2);
+    ensure(! v.isInline());
+    ensure(v.capacity() >= 6u);
+    ensure(toStd(v) == std::vector<double>({ 0, 0, 0, 1, 1, 2 }));
+
+    v.pop_back();
+    v.clear();
+    ensure(v.empty());
+}
+
+// Insertion in the middle, including from the container itself
+template<>
+template<>
+void object::test<2>
+()
+{
+    double init[] = { 1, 2, 3 };
+    Vector v;
+    v.assign(init, init + 3);
+
+    v.insert(v.begin() + 1, 2, v[2]);
+    ensure(toStd(v) == std::vector<double>({ 1, 3, 3, 2, 3 }));
+
+    v.insert(v.end(), v.begin(), v.begin() + 3);
+    ensure(toStd(v) == std::vector<double>({ 1, 3, 3, 2, 3, 1, 3, 3 }));
+
+    v.assign(v.begin() + 3, v.begin() + 5);
+    ensure(toStd(v) == std::vector<double>({ 2, 3 }));
+}
+
+// Copy and move, from inline and heap storage
+template<>
+template<>
+void object::test<3>
+()
+{
+    double init[] = { 1, 2, 3, 4, 5, 6 };
+    Vector small;
+    small.assign(init, init + 2);
+    Vector large;
+    large.assign(init, init + 6);
+
+    Vector smallCopy(small);
+    Vector largeCopy(large);
+    ensure(toStd(smallCopy) == toStd(small));
+    ensure(toStd(largeCopy) == toStd(large));
+    ensure(largeCopy.data() != large.data());
+
+    const double* largeData = large.data();
+    Vector largeMoved(std::move(large));
+    ensure_equals(largeMoved.data(), largeData);
+    ensure(large.empty());
+    ensure(large.isInline());
+
+    Vector smallMoved(std::move(small));
+    ensure(smallMoved.isInline());
+    ensure(toStd(smallMoved) == std::vector<double>({ 1, 2 }));
+
+    largeMoved = std::move(smallMoved);
+    ensure(largeMoved.isInline());
+    ensure(toStd(largeMoved) == std::vector<double>({ 1, 2 }));
+
+    largeMoved = largeCopy;
+    ensure(toStd(largeMoved) == std::vector<double>({ 1, 2, 3, 4, 5, 6 }));
+
+    largeMoved.resize(8);
+    ensure_equals(largeMoved[7], 0.0);
+    largeMoved.resize(1);
+    ensure(toStd(largeMoved) == std::vector<double>({ 1 }));
+}
+
+// Borrowed buffers are used in place until modified
+template<>
+template<>
+void object::test<4>
+()
+{
+    double buf[] = { 1, 2, 3, 4, 5, 6 };
+    int released = 0;
+    auto release = [](void* userdata) { ++*static_cast<int*>(userdata); };
+
+    Vector v;
+    v.borrow(buf, 6, release, &released);
+    ensure(v.isBorrowed());
+    const Vector& cv = v;
+    ensure_equals(cv.data(), static_cast<const double*>(buf));
+    ensure_equals(cv.capacity(), 6u);
+
+    Vector copy(v);
+    ensure(! copy.isBorrowed());
+    ensure(toStd(copy) == toStd(v));
+
+    Vector moved(std::move(v));
+    ensure(moved.isBorrowed());
+    ensure(v.empty());
+    ensure_equals(released, 0);
+
+    // the buffer is only read until it is copied
+    const Vector& cmoved = moved;
+    ensure_equals(cmoved.data(), static_cast<const double*>(buf));
+
+    moved.own();
+    moved[0] = 10;
+    ensure(! moved.isBorrowed());
+    ensure_equals(released, 1);
+    ensure_equals(buf[0], 1.0);
+    ensure(toStd(moved) == std::vector<double>({ 10, 2, 3, 4, 5, 6 }));
+
+    // small buffers are copied inline, and released on clear
+    Vector small;
+    small.borrow(buf, 2, release, &released);
+    small.insert(small.cbegin() + 1, small.cbegin(), small.cbegin() + 1);
+    ensure(small.isInline());
+    ensure_equals(released, 2);
+    ensure(toStd(small) == std::vector<double>({ 1, 1, 2 }));
+
+    small.borrow(buf, 2, release, &released);
+    small.clear();
+    ensure(small.isInline());
+    ensure_equals(released, 3);
+
+    small.borrow(buf, 3, nullptr, nullptr);
+    small.assign(small.cbegin() + 1, small.cend());
+    ensure(toStd(small) == std::vector<double>({ 2, 3 }));
+}
+
+} // namespace tut
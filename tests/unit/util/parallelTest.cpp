@@ -0,0 +1,146 @@
+//
+// Test Suite for geos::util::parallelFor and geos::util::ThreadPool (geos/util/parallel.h)
+
+// tut
+#include <tut/tut.hpp>
+// geos
+#include <geos/util/IllegalArgumentException.h>
+#include <geos/util/parallel.h>
+// std
+#include <atomic>
+#include <vector>
+
+using geos::util::parallelFor;
+using geos::util::ThreadPool;
+
+namespace tut {
+//
+// Test Group
+//
+
+struct test_parallel_data {
+};
+
+typedef test_group<test_parallel_data> group;
+typedef group::object object;
+
+group test_parallel_group("geos::util::parallel");
+
+//
+// Test Cases
+//
+
+// Every index is visited exactly once
+template<>
+template<>
+void object::test<1>
+()
+{
+    for (std::size_t numThreads : { 1u, 2u, 7u, 0u }) {
+        std::vector<std::atomic<int>> visits(1000);
+        for (auto& v : visits) v = 0;
+
+        parallelFor(visits.size(), numThreads, [&visits](std::size_t i) {
+            visits[i]++;
+        });
+
+        for (const auto& v : visits) {
+            ensure_equals(v.load(), 1);
+        }
+    }
+}
+
+// Empty and single item ranges
+template<>
+template<>
+void object::test<2>
+()
+{
+    int count = 0;
+    parallelFor(0, 4, [&count](std::size_t) { count++; });
+    ensure_equals(count, 0);
+
+    parallelFor(1, 4, [&count](std::size_t) { count++; });
+    ensure_equals(count, 1);
+
+    ensure(geos::util::defaultThreadCount() >= 1);
+}
+
+// Exceptions are propagated to the caller
+template<>
+template<>
+void object::test<3>
+()
+{
+    std::atomic<int> count(0);
+    try {
+        parallelFor(10000, 4, [&count](std::size_t i) {
+            count++;
+            if (i == 10) {
+                throw geos::util::IllegalArgumentException("bad item");
+            }
+        });
+        fail("expected exception");
+    }
+    catch (const geos::util::IllegalArgumentException&) {
+        //-- remaining items are abandoned
+        ensure(count.load() < 10000);
+    }
+}
+
+// A ThreadPool visits every index exactly once, for each of many loops
+template<>
+template<>
+void object::test<4>
+()
+{
+    for (std::size_t numThreads : { 1u, 3u, 0u }) {
+        ThreadPool pool(numThreads);
+        ensure(pool.getNumThreads() >= 1);
+
+        std::vector<std::atomic<int>> visits(100);
+        for (auto& v : visits) v = 0;
+
+        for (int loop = 0; loop < 200; loop++) {
+            std::size_t n = static_cast<std::size_t>(loop) % visits.size();
+            pool.parallelFor(n, [&visits](std::size_t i) {
+                visits[i]++;
+            });
+        }
+
+        //-- index i is visited by the loops with n > i
+        for (std::size_t i = 0; i < visits.size(); i++) {
+            ensure_equals(visits[i].load(), static_cast<int>(2 * (visits.size() - 1 - i)));
+        }
+    }
+}
+
+// ThreadPool exceptions are propagated to the caller, and the pool remains usable
+template<>
+template<>
+void object::test<5>
+()
+{
+    ThreadPool pool(4);
+    std::atomic<int> count(0);
+    try {
+        pool.parallelFor(10000, [&count](std::size_t i) {
+            count++;
+            if (i == 10) {
+                throw geos::util::IllegalArgumentException("bad item");
+            }
+        });
+        fail("expected exception");
+    }
+    catch (const geos::util::IllegalArgumentException&) {
+        ensure(count.load() < 10000);
+    }
+
+    count = 0;
+    pool.parallelFor(1000, [&count](std::size_t) {
+        count++;
+    });
+    ensure_equals(count.load(), 1000);
+}
+
+} // namespace tut